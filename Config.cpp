@@ -22,26 +22,30 @@ String g_otaPass    = "";
 // Dynamic parameters
 float    g_maxRangeMeters  = 2.1f;
 uint32_t g_holdIntervalMs  = 500;
+RadarPayloadMode g_payloadMode = RADAR_PAYLOAD_JSON;
+bool     g_publishOnChange  = false;
+uint16_t g_deadbandMm       = 100;
+uint16_t g_deadbandCdeg     = 500;
+uint16_t g_deadbandSpeedCmS = 10;
+uint32_t g_heartbeatMs      = 30000;
 
 // Timing & pins
 unsigned long lastRadarDataTime = 0;
 unsigned long lastRadarPub      = 0;
 unsigned long lastStatusPub     = 0;
+unsigned long lastMetricsPub    = 0;
 unsigned long lastWiFiCheck     = 0;
 unsigned long lastWiFiConnected = 0;
 unsigned long lastWiFiReconnectAttempt = 0;
 
 const unsigned long RADAR_INTERVAL_MS = 500;
 const unsigned long STATUS_INTERVAL   = 10000;
+const unsigned long METRICS_INTERVAL  = 30000;
 const unsigned long NO_DATA_TIMEOUT   = 5000;
 const unsigned long RESTART_TIMEOUT   = 60000;
 
 const int RADAR_BOOT_PIN = 0;
 
-// Radar internals
-uint8_t        radarBuf[64];
-uint8_t        radarCount = 0;
-
 bool           otaInProgress        = false;
 bool           startConfigPortal   = false;
 bool           rebootRequested     = false;
@@ -51,6 +55,9 @@ unsigned long  serialResetTime      = 0;
 uint32_t       wifiReconnectCount   = 0;
 uint32_t       radarTimeoutCount    = 0;
 uint32_t       radarSerialRestartCount = 0;
+uint32_t       radarBytesReceived   = 0; // Vom Ingest-Task gelesene UART-Bytes
+uint32_t       radarRxOverflowCount = 0; // UART-Treiber Buffer-Full/FIFO-Overflow Events
+uint32_t       radarPublishSuppressed = 0; // Change-Modus: geänderte Snapshots innerhalb der Deadbands
 bool           wifiReconnectIssued  = false; // Signalisiert, dass ein WiFi-Reconnect ausgelöst wurde
 bool           configPortalActive   = false; // Zeigt an, ob das WiFi-Config-Portal gerade läuft
 
@@ -63,12 +70,6 @@ bool           mqttTelemetryEnabled = true; // Schaltet periodische MQTT-Telemet
 const float    ALPHA             = 0.4f;
 const float    RANGE_GATE_SIZE   = 0.7f;
 
-const uint8_t  multiTargetCmd[12] = {
-  0xFD,0xFC,0xFB,0xFA,
-  0x02,0x00,0x90,0x00,
-  0x04,0x03,0x02,0x01
-};
-
 RadarTarget    smoothed[3];
 unsigned long  lastSeenTime[3] = {0,0,0};
 unsigned long  lastZeroPub = 0;
@@ -77,22 +78,27 @@ char           g_lastBssid[18] = "";
 static char serialLogLines[SERIAL_LOG_LINES][SERIAL_LOG_LINE_LEN];
 static uint8_t serialLogIndex = 0;
 static uint8_t serialLogCount = 0;
+static volatile uint32_t serialLogSeq = 0;
 static char serialLogCurrent[SERIAL_LOG_LINE_LEN];
 static uint8_t serialLogCurrentLen = 0;
+static portMUX_TYPE serialLogMux = portMUX_INITIALIZER_UNLOCKED; // Loop, Ingest- und MQTT-Connect-Task loggen
 
 //---------------------------------------------------------
 // Helper Functions
 //---------------------------------------------------------
 static void serialLogPush(const char* line) {
   if (!line) return;
-  strncpy(serialLogLines[serialLogIndex], line, SERIAL_LOG_LINE_LEN - 1);
-  serialLogLines[serialLogIndex][SERIAL_LOG_LINE_LEN - 1] = '\0';
+  size_t len = strnlen(line, SERIAL_LOG_LINE_LEN - 1);
+  memcpy(serialLogLines[serialLogIndex], line, len);
+  serialLogLines[serialLogIndex][len] = '\0';
   serialLogIndex = (serialLogIndex + 1) % SERIAL_LOG_LINES;
   if (serialLogCount < SERIAL_LOG_LINES) serialLogCount++;
+  serialLogSeq++;
 }
 
 static void serialLogAppend(const char* text) {
   if (!text) return;
+  portENTER_CRITICAL(&serialLogMux);
   for (const char* p = text; *p; p++) {
     if (*p == '\n') {
       serialLogCurrent[serialLogCurrentLen] = '\0';
@@ -107,6 +113,7 @@ static void serialLogAppend(const char* text) {
     }
     serialLogCurrent[serialLogCurrentLen++] = *p;
   }
+  portEXIT_CRITICAL(&serialLogMux);
 }
 
 void logPrint(const char* msg) {
@@ -145,16 +152,39 @@ uint8_t getSerialLogCount() {
   return serialLogCount;
 }
 
+uint32_t getSerialLogSeq() {
+  return serialLogSeq;
+}
+
+bool getSerialLogLineBySeq(uint32_t seq, char* buffer, size_t bufsize) {
+  if (!buffer || bufsize == 0) return false;
+  bool found = false;
+  portENTER_CRITICAL(&serialLogMux);
+  uint32_t back = serialLogSeq - seq;   // 0 = neueste Zeile
+  if (seq > 0 && seq <= serialLogSeq && back < serialLogCount) {
+    uint8_t pos = (serialLogIndex + SERIAL_LOG_LINES - 1 - back) % SERIAL_LOG_LINES;
+    strncpy(buffer, serialLogLines[pos], bufsize - 1);
+    buffer[bufsize - 1] = '\0';
+    found = true;
+  } else {
+    buffer[0] = '\0';
+  }
+  portEXIT_CRITICAL(&serialLogMux);
+  return found;
+}
+
 void getSerialLogLine(uint8_t idx, char* buffer, size_t bufsize) {
   if (!buffer || bufsize == 0) return;
+  portENTER_CRITICAL(&serialLogMux);
   if (idx >= serialLogCount) {
     buffer[0] = '\0';
-    return;
+  } else {
+    uint8_t start = (serialLogIndex + SERIAL_LOG_LINES - serialLogCount) % SERIAL_LOG_LINES;
+    uint8_t pos = (start + idx) % SERIAL_LOG_LINES;
+    strncpy(buffer, serialLogLines[pos], bufsize - 1);
+    buffer[bufsize - 1] = '\0';
   }
-  uint8_t start = (serialLogIndex + SERIAL_LOG_LINES - serialLogCount) % SERIAL_LOG_LINES;
-  uint8_t pos = (start + idx) % SERIAL_LOG_LINES;
-  strncpy(buffer, serialLogLines[pos], bufsize - 1);
-  buffer[bufsize - 1] = '\0';
+  portEXIT_CRITICAL(&serialLogMux);
 }
 
 char* buildMqttTopic(const char* suffix, char* buffer, size_t bufsize) {
@@ -162,14 +192,6 @@ char* buildMqttTopic(const char* suffix, char* buffer, size_t bufsize) {
   return buffer;
 }
 
-void nonBlockingDelay(unsigned long ms) {
-  unsigned long start = millis();
-  while (millis() - start < ms) {
-    mqttClient.loop();
-    yield();
-  }
-}
-
 void formatUptime(char* buffer, size_t bufsize) {
   if (!buffer || bufsize == 0) return;
   unsigned long totalMinutes = millis() / 60000UL;
@@ -12,9 +12,48 @@
 // Constants
 #define MQTT_TOPIC_BUFFER_SIZE 80
 #define JSON_BUFFER_SIZE 1536
-#define RADAR_CMD_DELAY_US 50000  // 50ms in microseconds
 #define SERIAL_LOG_LINES 10
 #define SERIAL_LOG_LINE_LEN 96
+#define STATUS_JSON_SIZE 2048
+#define MQTT_BUFFER_SIZE 2048
+#define RADAR_CHANGE_POLL_MS 100       // Prüftakt im Change-Modus (≈ Sensor-Framerate)
+#define RADAR_RX_BUFFER_SIZE 4096      // UART-Treiber RX-Ringpuffer (Bytes)
+#define RADAR_INGEST_STACK_SIZE 4096
+#define RADAR_INGEST_PRIORITY 3        // über loopTask (1), damit Netzwerk-Stalls das Radar nicht bremsen
+#define RADAR_INGEST_CORE 1            // APP_CPU wie loopTask (Publish, SSE/WS, Befehle); nur Wi-Fi/LwIP auf PRO_CPU
+#define MQTT_CONNECT_STACK_SIZE 4096
+#define MQTT_CONNECT_PRIORITY 1
+#define MQTT_CONNECT_CORE 0            // beim Netzwerk-Stack, weg vom Loop/Radar
+#define MQTT_BACKOFF_MIN_MS 1000       // Reconnect-Backoff: 1 s, 2 s, 4 s … (± Jitter)
+#define MQTT_BACKOFF_MAX_MS 60000
+#define RADAR_INGEST_IDLE_MS 50        // Fallback-Poll, falls ein UART-Event verloren geht
+#define RADAR_REPLAY_STEP_MS 5         // Ingest-Takt während eines Replays
+#define RADAR_CMD_QUEUE_LEN 8          // eingereihte Sensor-Befehle
+#define RADAR_CMD_ACK_TIMEOUT_MS 300   // Wartezeit je Befehlsschritt auf das ACK
+#define RADAR_CMD_POLL_MS 10           // Ingest-Takt, solange ein Befehl läuft
+#define RADAR_RECORDER_PSRAM_FRAMES 16384   // ~27 min bei 10 Frames/s, ~557 KB
+#define RADAR_RECORDER_INTERNAL_FRAMES 512  // ~51 s, ~17 KB ohne PSRAM
+#define EVENT_QUEUE_LEN 64             // Ereignisse im RAM-Ring (~7 KB)
+#define EVENT_BODY_LEN 96
+#define EVENT_FLUSH_INTERVAL_MS 100    // Nachliefern nach Reconnect: max. BURST je Intervall
+#define EVENT_FLUSH_BURST 4
+#define EVENT_SPILL_BATCH 8            // Ereignisse je NVS-Blob
+#define EVENT_SPILL_MAX_BLOBS 4        // 0 = kein Auslagern nach NVS (Standard-NVS ist nur 20 KB)
+#define SNAPSHOT_STATUS_SAMPLE_MS 2000 // Status-Felder (RSSI, Temperatur, Heap …) für den Snapshot-Cache
+#define SSE_TARGETS_MIN_MS 100         // SSE "targets": höchstens so oft pro Client
+#define SSE_LOG_MIN_MS 500             // SSE "log": neue Zeilen gesammelt
+#define SSE_KEEPALIVE_MS 5000          // SSE "ping", wenn sonst nichts gesendet wurde
+#define SSE_MAX_CLIENTS 4              // gleichzeitige /events-Streams
+#define SSE_CLIENT_MAX_PENDING 4       // ausstehende Nachrichten je Client, darüber entfallen Targets-Frames
+#define SSE_STALL_TIMEOUT_MS 10000     // so lange ohne Fortschritt in der Queue → Client trennen
+#define SSE_STATS_JSON_SIZE 640
+#define DASHBOARD_STATS_JSON_SIZE 512
+#define WS_MAX_CLIENTS 4               // gleichzeitige /ws-Streams (binär, RadarBinary)
+#define WS_MAX_RATE_HZ 50              // höchste aushandelbare Rate; 0 = jeder Frame
+#define WS_CLEANUP_MS 1000             // geschlossene /ws-Clients aufräumen
+#define WS_STATS_JSON_SIZE 512
+#define WEB_CMD_QUEUE_LEN 8            // /api/cmd → Loop
+#define WEB_CMD_MAX_LEN 256
 
 // Preferences & network clients
 extern Preferences  prefs;
@@ -30,10 +69,26 @@ extern String g_host, g_otaPass;
 extern float   g_maxRangeMeters;
 extern uint32_t g_holdIntervalMs;
 
+// Radar-Payload (setPayload): JSON auf <topic>, Binär (RadarBinary.h) auf <topic>/bin
+enum RadarPayloadMode : uint8_t {
+  RADAR_PAYLOAD_JSON,
+  RADAR_PAYLOAD_BIN,
+  RADAR_PAYLOAD_BOTH
+};
+extern RadarPayloadMode g_payloadMode;
+
+// Change-getriebenes Publizieren (setPublish:change)
+extern bool     g_publishOnChange;
+extern uint16_t g_deadbandMm;        // Positionsänderung
+extern uint16_t g_deadbandCdeg;      // Winkeländerung, 1/100°
+extern uint16_t g_deadbandSpeedCmS;  // Geschwindigkeitsänderung
+extern uint32_t g_heartbeatMs;       // spätestens dann wird trotzdem publiziert
+extern uint32_t radarPublishSuppressed;
+
 // Timing & pins
-extern unsigned long lastRadarDataTime, lastRadarPub, lastStatusPub, lastWiFiCheck;
+extern unsigned long lastRadarDataTime, lastRadarPub, lastStatusPub, lastMetricsPub, lastWiFiCheck;
 extern unsigned long lastWiFiConnected, lastWiFiReconnectAttempt;
-extern const unsigned long RADAR_INTERVAL_MS, STATUS_INTERVAL, NO_DATA_TIMEOUT, RESTART_TIMEOUT;
+extern const unsigned long RADAR_INTERVAL_MS, STATUS_INTERVAL, METRICS_INTERVAL, NO_DATA_TIMEOUT, RESTART_TIMEOUT;
 extern const int          RADAR_BOOT_PIN;
 
 // Forward declarations
@@ -42,7 +97,6 @@ void saveParamCallback();
 
 // Helper functions
 char* buildMqttTopic(const char* suffix, char* buffer, size_t bufsize);
-void nonBlockingDelay(unsigned long ms);
 void formatUptime(char* buffer, size_t bufsize);
 void logPrint(const char* msg);
 void logPrintln(const char* msg);
@@ -51,19 +105,31 @@ void logPrintln(const String& msg);
 void logPrintf(const char* fmt, ...);
 uint8_t getSerialLogCount();
 void getSerialLogLine(uint8_t idx, char* buffer, size_t bufsize);
+uint32_t getSerialLogSeq();          // Sequenznummer der neuesten Log-Zeile (0 = keine)
+// Zeile mit Sequenznummer seq; false, wenn sie schon aus dem Ring gefallen ist
+bool getSerialLogLineBySeq(uint32_t seq, char* buffer, size_t bufsize);
 
 // Radar internals
+// Ganzzahlige Darstellung; Floats entstehen erst beim Serialisieren
 struct RadarTarget {
-  bool presence;
-  float x, y, speed, distRaw, distanceXY, angleDeg;
+  bool     presence;
+  uint16_t id;           // persistente Track-ID (0 = kein Track)
+  int16_t  x, y;         // mm
+  int32_t  speed;        // mm/s
+  uint16_t distRaw;      // mm (Sensorwert)
+  uint16_t distanceXY;   // mm
+  int16_t  angleCdeg;    // 1/100°
+  uint16_t sigma;        // mm, 1σ Positionsunsicherheit (nur Kalman, sonst 0)
 };
 
-extern uint8_t           radarBuf[64];
-extern uint8_t           radarCount;
+inline long radarSpeedCmS(const RadarTarget& t) { return lroundf(t.speed / 10.0f); }
+inline long radarAngleDeg(const RadarTarget& t) { return lroundf(t.angleCdeg / 100.0f); }
+
 extern bool              otaInProgress, startConfigPortal, rebootRequested, serialResetAttempted;
 extern unsigned long     rebootRequestedAt;
 extern unsigned long     serialResetTime;
 extern uint32_t          wifiReconnectCount, radarTimeoutCount, radarSerialRestartCount;
+extern uint32_t          radarBytesReceived, radarRxOverflowCount;
 extern bool              wifiReconnectIssued;
 extern bool              configPortalActive;
 // Debug-Schalter
@@ -72,8 +138,7 @@ extern bool              otaEnabled;
 extern bool              radarSerialRestartEnabled;
 extern bool              mqttTelemetryEnabled;
 extern const float       ALPHA, RANGE_GATE_SIZE;
-extern const uint8_t     multiTargetCmd[12];
-extern RadarTarget       smoothed[3];
+extern RadarTarget       smoothed[3];      // nur Ingest-Task, sonst getRadarTargets()
 extern unsigned long     lastSeenTime[3];
 extern unsigned long     lastZeroPub;
 extern char              g_lastBssid[18];
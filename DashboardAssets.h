@@ -0,0 +1,878 @@
+// File: DashboardAssets.h
+// Generiert von host/gen_dashboard.py aus web/ – nicht von Hand ändern.
+
+#pragma once
+#include <Arduino.h>
+
+struct DashboardAsset {
+  const char*    path;
+  const char*    contentType;
+  const char*    etag;        // Hash des Rohinhalts, inkl. Anführungszeichen
+  const uint8_t* gz;
+  uint32_t       gzSize;
+  uint32_t       rawSize;
+  bool           immutable;   // über ?v=<hash> referenziert, lange cachebar
+};
+
+#define DASHBOARD_RAW_SIZE 50180
+#define DASHBOARD_GZ_SIZE  13445
+
+// dashboard.css: 13087 B roh, 2845 B gzip
+static const uint8_t DASHBOARD_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5a, 0x59, 0x8f, 0xdb, 0x38,
+  0x12, 0x7e, 0xcf, 0xaf, 0x20, 0xba, 0x31, 0x98, 0x76, 0x60, 0x39, 0x3a, 0x2c, 0x5b, 0x76, 0xbf,
+  0xec, 0x24, 0xb3, 0x33, 0x08, 0x30, 0x0b, 0x04, 0x9b, 0x59, 0x2c, 0xf6, 0x91, 0x96, 0x68, 0x5b,
+  0xdb, 0xb2, 0x64, 0x48, 0x72, 0x1f, 0x09, 0xfa, 0xbf, 0x4f, 0xb1, 0x78, 0x88, 0x94, 0x28, 0x77,
+  0xe7, 0xc2, 0x62, 0x81, 0xee, 0xc3, 0x96, 0xa8, 0x22, 0x59, 0xc5, 0x3a, 0xbe, 0x2a, 0x52, 0xaf,
+  0xc9, 0x67, 0x72, 0xa0, 0xf5, 0x2e, 0x2f, 0xd7, 0xc4, 0xbf, 0x26, 0x47, 0x9a, 0x65, 0x79, 0xb9,
+  0xc3, 0xeb, 0x4d, 0x75, 0xef, 0x35, 0xf9, 0x27, 0xbc, 0xdd, 0x54, 0x75, 0xc6, 0x6a, 0x0f, 0x9a,
+  0xae, 0xc9, 0xe3, 0xab, 0x57, 0xeb, 0xba, 0xaa, 0x5a, 0xf2, 0xf9, 0x15, 0x21, 0x1e, 0xb4, 0x65,
+  0x0f, 0xde, 0x06, 0x68, 0x2e, 0x7d, 0xfc, 0xb9, 0xee, 0x5a, 0x5b, 0x76, 0xdf, 0x42, 0xfb, 0x36,
+  0x86, 0xdf, 0xa5, 0x68, 0x3f, 0x9c, 0x5a, 0x96, 0xc9, 0x07, 0xf5, 0x6e, 0x43, 0xaf, 0xc2, 0x79,
+  0x3c, 0x25, 0xf2, 0x63, 0x39, 0x25, 0xfe, 0x6c, 0x39, 0x11, 0x94, 0x29, 0xad, 0x33, 0x1c, 0x57,
+  0x90, 0xad, 0x80, 0x00, 0xfe, 0xa3, 0x00, 0x69, 0x42, 0x8b, 0x08, 0x99, 0x53, 0x84, 0x31, 0x1f,
+  0x4a, 0x7f, 0xf8, 0xb3, 0x60, 0x48, 0xea, 0xed, 0xab, 0xdb, 0x33, 0x1d, 0x62, 0xb3, 0x87, 0x43,
+  0x06, 0x6c, 0x6f, 0xf6, 0x34, 0xab, 0xee, 0xd6, 0xa4, 0xac, 0x4a, 0x36, 0x68, 0x56, 0x13, 0xf8,
+  0x24, 0x39, 0xde, 0x93, 0x28, 0x84, 0x0f, 0x9c, 0xcb, 0x87, 0xf1, 0xc5, 0xdf, 0x2c, 0xd2, 0x93,
+  0x94, 0xb7, 0xb4, 0xe9, 0x04, 0x35, 0x48, 0xe6, 0x36, 0xc9, 0x36, 0x2f, 0x0a, 0xe0, 0x24, 0xa0,
+  0x01, 0x0d, 0xa9, 0xdd, 0xf9, 0xec, 0x02, 0xf8, 0x4a, 0x9e, 0xa6, 0xa5, 0xed, 0xa9, 0xf1, 0xd2,
+  0xaa, 0x2c, 0x59, 0xca, 0xd5, 0xa0, 0x27, 0x8d, 0xc3, 0x29, 0x09, 0x56, 0xb0, 0xbc, 0xc9, 0xca,
+  0x5a, 0x81, 0x61, 0x0f, 0x73, 0xa6, 0x5e, 0xaf, 0x68, 0xac, 0x93, 0x5c, 0xc2, 0x68, 0x9e, 0x2e,
+  0xe3, 0x95, 0x45, 0x93, 0xe5, 0x8d, 0x83, 0x1b, 0xe4, 0x7b, 0x01, 0x63, 0xc6, 0x89, 0x8b, 0x1b,
+  0xbb, 0xd3, 0x40, 0xf4, 0xae, 0x63, 0x74, 0xa6, 0x9f, 0x52, 0xeb, 0x76, 0x1e, 0x47, 0x72, 0x31,
+  0x37, 0x6d, 0xd9, 0xf1, 0xc0, 0xc5, 0x0a, 0xfc, 0x90, 0x5b, 0x65, 0x60, 0x31, 0xc1, 0xa9, 0x50,
+  0xbb, 0xe3, 0xb4, 0xa1, 0x49, 0xeb, 0xb0, 0x1f, 0x9c, 0xc8, 0xe4, 0xbb, 0x3f, 0x40, 0x64, 0x0e,
+  0x50, 0xe7, 0xc7, 0x63, 0xc1, 0x9e, 0xb2, 0x6e, 0xd6, 0x1c, 0xbd, 0xbc, 0xdc, 0x56, 0xde, 0xae,
+  0xa6, 0x59, 0xce, 0x4a, 0x98, 0xb3, 0xc8, 0x4b, 0x46, 0x6b, 0xdd, 0x70, 0x15, 0x44, 0x71, 0xc6,
+  0x76, 0x53, 0x6d, 0x66, 0x41, 0x18, 0x1a, 0xc3, 0x4c, 0xdd, 0x96, 0x30, 0x91, 0xe3, 0xc3, 0x20,
+  0x30, 0x56, 0xc3, 0xda, 0x16, 0xe2, 0x41, 0xf3, 0xdc, 0x59, 0x04, 0xa7, 0xfe, 0x5c, 0x1a, 0xb4,
+  0x9e, 0x05, 0xdb, 0x83, 0xf9, 0x4a, 0xb7, 0xcb, 0x59, 0xee, 0x68, 0x5d, 0x7e, 0xc9, 0xf8, 0x63,
+  0x52, 0x04, 0xfc, 0x41, 0x64, 0x3e, 0x50, 0x0b, 0x7a, 0x6a, 0xdb, 0xaa, 0xd4, 0xce, 0xeb, 0xc3,
+  0xb2, 0x83, 0x6f, 0x86, 0xbe, 0xc3, 0x41, 0xc3, 0xd8, 0x76, 0xbf, 0x5d, 0x9d, 0x67, 0x60, 0xd4,
+  0x45, 0x05, 0x5a, 0xbb, 0x0c, 0x69, 0x44, 0xe7, 0xb6, 0x13, 0xd2, 0x3a, 0xd5, 0x8f, 0xf9, 0xc3,
+  0xd8, 0x7e, 0x5c, 0xd0, 0x0d, 0x2b, 0x34, 0xc1, 0x82, 0x2e, 0x69, 0x22, 0x09, 0xb2, 0xfc, 0x36,
+  0xe7, 0x41, 0x49, 0x3e, 0x7b, 0xc2, 0x89, 0x69, 0x9a, 0xc2, 0x32, 0xe8, 0x81, 0x7c, 0x9a, 0xcc,
+  0xb7, 0x5b, 0xf1, 0xa8, 0x85, 0x38, 0xce, 0x5a, 0x1e, 0xa4, 0xbf, 0x48, 0x3f, 0x41, 0x8c, 0xe6,
+  0x37, 0x54, 0x90, 0xa9, 0xb8, 0x89, 0x35, 0x45, 0xd3, 0xd6, 0x55, 0xb9, 0xb3, 0x39, 0xee, 0xc7,
+  0xf1, 0x05, 0x74, 0x01, 0xa8, 0xe0, 0x40, 0x80, 0x48, 0xb1, 0xad, 0x80, 0xed, 0x2d, 0x3d, 0xe4,
+  0xc5, 0xc3, 0x9a, 0x78, 0x94, 0x1b, 0xb5, 0xd7, 0x3c, 0x34, 0x2d, 0x3b, 0x4c, 0xc9, 0x5b, 0xe0,
+  0xf2, 0xe6, 0x1f, 0x34, 0xfd, 0x88, 0xf7, 0xbf, 0x01, 0xe5, 0x94, 0x5c, 0x7c, 0xfc, 0x8d, 0x7c,
+  0xa8, 0x2b, 0xf2, 0x6b, 0xde, 0x1c, 0x0b, 0xfa, 0x70, 0xd1, 0xb5, 0xfc, 0x09, 0x2e, 0x85, 0xb7,
+  0x6c, 0x57, 0x31, 0xf2, 0xaf, 0xf7, 0x70, 0xfd, 0x4b, 0x9d, 0xd3, 0x62, 0x4a, 0x1a, 0x5a, 0x36,
+  0x60, 0xa4, 0x75, 0x8e, 0x2b, 0xb2, 0xa1, 0xe9, 0xcd, 0xae, 0xae, 0x4e, 0x65, 0xb6, 0x26, 0xb7,
+  0xb4, 0xbe, 0xd2, 0x58, 0x85, 0xc2, 0x48, 0xe6, 0x8d, 0x07, 0xdc, 0x55, 0xf1, 0x51, 0x07, 0x88,
+  0x70, 0xa3, 0x21, 0x31, 0x08, 0xa5, 0xa9, 0x20, 0x49, 0x0e, 0x61, 0x80, 0xe5, 0xbb, 0x3d, 0x2c,
+  0x71, 0xe0, 0xfb, 0xb7, 0x7b, 0x5c, 0x9f, 0x3b, 0xb6, 0xb9, 0xc9, 0x41, 0x4a, 0x2e, 0x6a, 0x73,
+  0x00, 0x8c, 0xdc, 0x63, 0x4f, 0x5a, 0xb6, 0xc0, 0x5e, 0x4e, 0x1b, 0x96, 0x21, 0xd9, 0xa1, 0xfa,
+  0xe4, 0x55, 0xcd, 0xfd, 0x80, 0x0e, 0x94, 0xf4, 0xd0, 0xa4, 0xb4, 0x60, 0x7a, 0xe5, 0x66, 0xe0,
+  0x75, 0x37, 0x40, 0x9f, 0xb1, 0x17, 0xb4, 0x7d, 0x41, 0xdb, 0x17, 0xb4, 0x7d, 0x41, 0xdb, 0x17,
+  0xb4, 0x7d, 0x41, 0xdb, 0xf3, 0x68, 0x3b, 0x2b, 0x38, 0x2c, 0xb9, 0x41, 0xc3, 0x72, 0x0c, 0x03,
+  0x34, 0x82, 0x14, 0x7e, 0xd9, 0x08, 0x68, 0x2c, 0x80, 0x2b, 0xfc, 0xd7, 0x33, 0x39, 0x10, 0xa3,
+  0xbf, 0x84, 0xab, 0x71, 0xd0, 0x30, 0xd4, 0xee, 0x27, 0x4f, 0xe0, 0x85, 0x41, 0x1b, 0x24, 0x0e,
+  0xa4, 0x30, 0x19, 0xb7, 0x90, 0xc2, 0x27, 0x73, 0x30, 0xb3, 0x20, 0x71, 0xd8, 0x9a, 0x3d, 0x69,
+  0x1f, 0x43, 0x82, 0x05, 0x07, 0x91, 0x85, 0xa3, 0x5f, 0x10, 0x8e, 0xa0, 0xc8, 0x40, 0xf8, 0x45,
+  0xec, 0x04, 0x93, 0x2d, 0xfe, 0x8c, 0x83, 0x89, 0x8b, 0xc7, 0x71, 0x18, 0x59, 0x2e, 0x60, 0xbe,
+  0x60, 0xc9, 0xad, 0x49, 0xb8, 0xd0, 0xb3, 0x60, 0xa4, 0xdf, 0x6b, 0x1e, 0x3f, 0x01, 0x24, 0x61,
+  0xba, 0x4c, 0xa3, 0xe8, 0x2b, 0x80, 0x24, 0xf9, 0x5a, 0x20, 0x89, 0x9f, 0x46, 0x92, 0x4d, 0x14,
+  0x2e, 0x94, 0xda, 0x2d, 0x24, 0xe9, 0xc7, 0xa8, 0x70, 0x1c, 0x48, 0x7a, 0xa4, 0xe1, 0x10, 0x46,
+  0xfc, 0x4d, 0x40, 0x95, 0xe8, 0x03, 0x18, 0xe9, 0x77, 0x1f, 0x45, 0x11, 0x97, 0x05, 0x7d, 0x2b,
+  0x80, 0x24, 0x63, 0x08, 0x92, 0x7c, 0x57, 0x08, 0x09, 0xc3, 0x31, 0x0c, 0x49, 0xbe, 0x13, 0x88,
+  0x84, 0xa3, 0x20, 0xb2, 0x78, 0x02, 0x45, 0x62, 0xe5, 0xa1, 0x01, 0x67, 0x39, 0x9a, 0x92, 0x79,
+  0xd8, 0xcb, 0x27, 0x07, 0x40, 0xe2, 0x88, 0x66, 0x46, 0x50, 0xe9, 0xe3, 0x8a, 0x83, 0xba, 0x8f,
+  0x52, 0x16, 0xcc, 0x38, 0xe8, 0xb5, 0x73, 0xb9, 0x50, 0xc7, 0xe5, 0xed, 0x3f, 0x00, 0x6f, 0x12,
+  0x58, 0x9a, 0xe5, 0xd2, 0xb6, 0x1a, 0xa1, 0xe6, 0x60, 0x2e, 0x13, 0x21, 0x53, 0x9f, 0xe3, 0x98,
+  0x63, 0x8b, 0xb6, 0x14, 0x80, 0x73, 0xd9, 0xee, 0xd9, 0x01, 0x0a, 0xb9, 0xbb, 0xbc, 0x4d, 0xf7,
+  0xac, 0x46, 0xc0, 0xc9, 0x44, 0xc5, 0xb6, 0x26, 0xdb, 0x82, 0x61, 0xb1, 0xf4, 0xdf, 0x53, 0xd3,
+  0xe6, 0xdb, 0x07, 0x1e, 0x5b, 0x5a, 0x64, 0x9b, 0x3f, 0xf0, 0x58, 0x89, 0xd5, 0x10, 0x14, 0x46,
+  0xbb, 0xd2, 0xcb, 0xa1, 0xee, 0x6b, 0xd6, 0x84, 0x4b, 0xcf, 0x6a, 0x51, 0x83, 0xdd, 0x7b, 0x77,
+  0x79, 0xd6, 0xee, 0xa1, 0xbe, 0x5a, 0xf8, 0xaa, 0xea, 0x52, 0x85, 0x19, 0xa1, 0xa7, 0xb6, 0xc2,
+  0x8a, 0x0c, 0xb9, 0x98, 0x09, 0x2e, 0xda, 0x6a, 0xb7, 0x83, 0xaa, 0x12, 0x3c, 0x10, 0xf9, 0x50,
+  0xee, 0x1a, 0x80, 0xa5, 0x34, 0x55, 0x91, 0x67, 0xaa, 0xd8, 0xd3, 0xae, 0x3c, 0x19, 0x29, 0x13,
+  0x31, 0xa2, 0x38, 0xaa, 0x44, 0x19, 0x1a, 0x26, 0x76, 0x5d, 0xe8, 0x1b, 0x75, 0xa1, 0x84, 0x30,
+  0xae, 0x8f, 0x13, 0xc8, 0xb3, 0x5a, 0xad, 0x44, 0xbb, 0x28, 0xf5, 0xf2, 0x4f, 0x10, 0x14, 0x82,
+  0xb9, 0xd1, 0x74, 0x27, 0x6b, 0xc8, 0x85, 0x28, 0xe5, 0xd2, 0x53, 0xdd, 0xf0, 0xf9, 0x8e, 0x55,
+  0xae, 0x16, 0xa2, 0xad, 0xa1, 0xa8, 0xcd, 0xdb, 0xbc, 0x02, 0xb9, 0x3b, 0x56, 0xb9, 0x31, 0x36,
+  0x84, 0x41, 0x49, 0x39, 0x15, 0x14, 0xdb, 0xaa, 0x3e, 0x98, 0x8d, 0xb8, 0x7b, 0x8b, 0x2e, 0xd3,
+  0xb5, 0x0a, 0x06, 0xef, 0xb5, 0x2b, 0x49, 0xa9, 0x4c, 0xff, 0xd2, 0x2b, 0x92, 0xd5, 0xd5, 0x91,
+  0xe3, 0x56, 0xcb, 0x57, 0x70, 0x53, 0x9c, 0xea, 0x2b, 0xbe, 0xda, 0x13, 0xf7, 0x72, 0xaf, 0x31,
+  0xb4, 0x8a, 0x45, 0x77, 0xae, 0xa6, 0x0a, 0xbd, 0x13, 0x2d, 0x11, 0xe7, 0x77, 0x2d, 0x2e, 0x0b,
+  0xda, 0xb2, 0xff, 0x5c, 0x79, 0x41, 0x37, 0xfc, 0xff, 0x44, 0x8f, 0x1c, 0xf2, 0x95, 0x6e, 0x9e,
+  0xa3, 0xc6, 0xe8, 0xff, 0x5f, 0x8d, 0x3f, 0x5e, 0x81, 0x33, 0x9a, 0xb6, 0xf9, 0x2d, 0x7b, 0xde,
+  0xc8, 0xd0, 0x75, 0x1f, 0x0c, 0x48, 0xfb, 0x31, 0x6e, 0xe5, 0x63, 0x88, 0xbb, 0xf4, 0xfd, 0x0c,
+  0x82, 0x23, 0x5e, 0x2c, 0x16, 0xdb, 0xed, 0xc4, 0xdc, 0x81, 0xe9, 0xfa, 0x7b, 0x69, 0x91, 0x1f,
+  0x81, 0x4f, 0x50, 0xb7, 0x49, 0xc0, 0xef, 0x31, 0x2d, 0x53, 0x21, 0x0e, 0x05, 0x39, 0xd2, 0x1a,
+  0x66, 0xb0, 0x8d, 0xa9, 0x37, 0x00, 0x76, 0xc4, 0x98, 0x65, 0x47, 0x2b, 0x1e, 0x98, 0xc0, 0x1a,
+  0x41, 0x07, 0xb0, 0x2a, 0x2a, 0x1a, 0x18, 0xe6, 0x12, 0x85, 0x0e, 0x73, 0x59, 0x0a, 0x73, 0x29,
+  0x00, 0xa5, 0x61, 0x0d, 0x60, 0xfa, 0x14, 0x2d, 0xd1, 0xf3, 0x67, 0xb1, 0x8c, 0x6c, 0x97, 0x22,
+  0x09, 0xc2, 0x45, 0x79, 0x56, 0xc4, 0x09, 0xdd, 0xa1, 0x32, 0x8c, 0x47, 0xe3, 0xd0, 0x98, 0x44,
+  0x3a, 0xfe, 0x86, 0xbe, 0xef, 0xe0, 0x3d, 0x16, 0xbc, 0xbb, 0x8d, 0x8c, 0x73, 0x81, 0x0a, 0x95,
+  0xfc, 0xcf, 0x74, 0x06, 0x37, 0x62, 0x09, 0x8e, 0x34, 0x77, 0x72, 0x7d, 0xc6, 0xf7, 0x47, 0x92,
+  0xdc, 0xa1, 0xaf, 0x3b, 0xd3, 0x5a, 0x8b, 0x35, 0x33, 0xbf, 0x3c, 0xcf, 0x5d, 0x2f, 0xef, 0x7d,
+  0x0e, 0x83, 0x8e, 0xac, 0x77, 0x94, 0xc7, 0x41, 0xa2, 0x2b, 0x5c, 0xe2, 0xcd, 0x6b, 0xf2, 0x2b,
+  0x6d, 0xf6, 0x9b, 0x0a, 0xaa, 0x15, 0xf2, 0x3b, 0xa4, 0x33, 0xe4, 0xf5, 0x9b, 0x57, 0x97, 0x99,
+  0x6e, 0xb2, 0x20, 0x97, 0xa7, 0x3b, 0x7c, 0x7c, 0x4c, 0x7b, 0x00, 0x53, 0x8f, 0xdc, 0x37, 0xb9,
+  0x8d, 0x9f, 0x0e, 0x25, 0xb7, 0x8e, 0x05, 0x37, 0x9d, 0x60, 0x5b, 0xab, 0xff, 0x21, 0x6d, 0x5d,
+  0xdd, 0x01, 0x21, 0x1a, 0x8d, 0xfd, 0x31, 0x24, 0x05, 0x6f, 0xa1, 0xcd, 0x1a, 0x9a, 0x09, 0xb9,
+  0x80, 0x8c, 0x96, 0x60, 0xce, 0x69, 0x7e, 0x5e, 0x88, 0x67, 0x22, 0x34, 0x35, 0xa3, 0xcf, 0x55,
+  0x96, 0x4a, 0x44, 0xf2, 0x11, 0xc8, 0xef, 0x50, 0x7e, 0x47, 0x92, 0x4c, 0xa5, 0x9a, 0x64, 0xfc,
+  0x42, 0x52, 0xee, 0xf3, 0xa6, 0xad, 0xea, 0x07, 0x32, 0xf2, 0x2d, 0xa9, 0x0e, 0xac, 0xad, 0xf3,
+  0xb4, 0x21, 0x23, 0xdf, 0x17, 0x28, 0x30, 0x3d, 0xae, 0xb1, 0x24, 0x7c, 0x66, 0x4e, 0x32, 0xc8,
+  0x68, 0x20, 0x91, 0x62, 0x90, 0x1a, 0x29, 0x4d, 0xbe, 0xe3, 0x1a, 0x7b, 0x0b, 0x41, 0x9c, 0x7c,
+  0x6c, 0x1f, 0x0a, 0x46, 0x3c, 0xf2, 0x0b, 0x2f, 0x15, 0xc8, 0xef, 0x05, 0x6d, 0x9a, 0x43, 0x55,
+  0x1f, 0x81, 0xc5, 0x03, 0x57, 0xf0, 0x2c, 0x55, 0xba, 0x1d, 0x9a, 0xa3, 0x2c, 0xbd, 0xdd, 0x41,
+  0xbe, 0x01, 0x5b, 0xaa, 0x41, 0x3b, 0x57, 0x41, 0xe2, 0xff, 0x34, 0xb1, 0xdc, 0x71, 0x10, 0x2c,
+  0x78, 0x79, 0x7c, 0xce, 0x88, 0x8d, 0xaa, 0xdc, 0xc6, 0xca, 0x50, 0xc5, 0x0e, 0x03, 0xd5, 0x68,
+  0x51, 0xf0, 0xea, 0xed, 0x1c, 0x46, 0x19, 0x05, 0xf7, 0xd0, 0x0b, 0x74, 0x59, 0x8f, 0x66, 0x8f,
+  0xf2, 0x9b, 0xb0, 0x24, 0x38, 0x1f, 0xf6, 0x30, 0x37, 0x0d, 0x26, 0x4f, 0x4e, 0xab, 0xe9, 0xe4,
+  0x0c, 0x64, 0x1f, 0x75, 0xa7, 0x13, 0x32, 0x2e, 0x2e, 0xc7, 0x81, 0xbd, 0x17, 0xe7, 0x95, 0x61,
+  0x8c, 0xca, 0xe1, 0x8c, 0xed, 0x91, 0x8c, 0xed, 0x60, 0x0e, 0x7f, 0xff, 0xf8, 0x81, 0xbc, 0x87,
+  0x3a, 0x90, 0xbc, 0xad, 0xee, 0xd1, 0xad, 0x55, 0x61, 0x88, 0x4c, 0xa1, 0xb7, 0x71, 0x27, 0x5b,
+  0x13, 0x68, 0x77, 0xe7, 0x38, 0x83, 0x4a, 0x52, 0x07, 0x8d, 0x7f, 0xa2, 0x9f, 0xbd, 0xc3, 0x4a,
+  0x85, 0x8f, 0x2d, 0x6a, 0x96, 0xfe, 0xc0, 0xe8, 0x87, 0xd7, 0x23, 0x66, 0x26, 0xb7, 0x39, 0x9c,
+  0xa6, 0x23, 0xf1, 0x4c, 0xf9, 0x83, 0xef, 0xff, 0xc4, 0x6f, 0xd5, 0x99, 0x88, 0xf6, 0x85, 0xe6,
+  0x08, 0xf1, 0x0c, 0x7a, 0x81, 0x8d, 0xac, 0xc9, 0x9c, 0xbc, 0x21, 0xd1, 0x79, 0x83, 0x33, 0x76,
+  0x45, 0xb4, 0x24, 0xef, 0x40, 0x13, 0x75, 0x55, 0x90, 0xb7, 0x32, 0x8e, 0xf0, 0x85, 0x4a, 0x45,
+  0x9b, 0xa7, 0x62, 0x4b, 0x4f, 0x2c, 0xd9, 0x7c, 0xed, 0x2a, 0x47, 0xb0, 0xfa, 0xc8, 0xf2, 0x1a,
+  0x18, 0x43, 0xc3, 0x15, 0xd1, 0xb1, 0xf3, 0xf6, 0xb0, 0xd3, 0x8f, 0x58, 0xc3, 0x8f, 0x2a, 0x3e,
+  0xf1, 0x89, 0xed, 0xc2, 0xba, 0x3f, 0xaf, 0x6a, 0x77, 0xaf, 0xe8, 0x48, 0x51, 0xae, 0x05, 0xfd,
+  0x13, 0xe3, 0x9d, 0xb0, 0x08, 0x3e, 0x97, 0x8c, 0x87, 0xbc, 0xe8, 0x23, 0x9f, 0xcd, 0x69, 0xe4,
+  0x03, 0xfe, 0x32, 0x86, 0x24, 0x0a, 0xc7, 0x88, 0x42, 0x83, 0x28, 0x1a, 0x23, 0x8a, 0xf0, 0xb5,
+  0x0e, 0xe0, 0xe0, 0xdf, 0x2a, 0xa2, 0xf2, 0xe9, 0x75, 0x78, 0xed, 0x09, 0xa9, 0xda, 0xdd, 0x42,
+  0x0e, 0x76, 0x04, 0xb4, 0x78, 0x6f, 0x59, 0xc1, 0x76, 0x27, 0x78, 0x04, 0x2e, 0x58, 0xd0, 0xd3,
+  0x16, 0x27, 0x51, 0xb1, 0xb9, 0x37, 0x87, 0x6c, 0x46, 0x47, 0x95, 0xd7, 0x9e, 0xd4, 0x79, 0xe3,
+  0xae, 0x32, 0x51, 0xad, 0x77, 0x35, 0x57, 0x21, 0xff, 0x3c, 0x53, 0x5b, 0xa2, 0x9a, 0x13, 0x33,
+  0x7c, 0x77, 0x1e, 0x2d, 0x95, 0xaf, 0xd8, 0x7a, 0xb7, 0xa7, 0x75, 0x6b, 0xcf, 0xb7, 0x29, 0xaa,
+  0xf4, 0x66, 0x68, 0xdb, 0xca, 0xe2, 0xf5, 0xa9, 0xe0, 0xc2, 0x17, 0x43, 0x69, 0xf6, 0x41, 0x78,
+  0xa8, 0x79, 0x71, 0x30, 0x39, 0x6b, 0x5b, 0x75, 0x8c, 0x98, 0x11, 0x28, 0x74, 0x84, 0x95, 0x6e,
+  0x5b, 0x76, 0xe2, 0x1a, 0x15, 0x02, 0x4c, 0x69, 0xf3, 0x99, 0x97, 0x3c, 0x73, 0xf6, 0x34, 0xbb,
+  0x72, 0xce, 0x5a, 0xb2, 0x67, 0x58, 0xf9, 0x1f, 0x15, 0xe0, 0xc7, 0x87, 0xba, 0x02, 0x08, 0x41,
+  0x95, 0x28, 0x20, 0xec, 0xa9, 0x44, 0x36, 0xe3, 0xec, 0xf2, 0xda, 0x6b, 0xe9, 0xa6, 0x10, 0xd9,
+  0x7d, 0x2f, 0x10, 0x74, 0xf1, 0xba, 0xa0, 0xc7, 0x86, 0xa1, 0x97, 0xe1, 0xd5, 0xb9, 0x32, 0x4a,
+  0x1d, 0x0f, 0x1f, 0xaa, 0xb2, 0xe2, 0x11, 0x93, 0x39, 0xe6, 0x6a, 0xf7, 0xd3, 0x41, 0x93, 0x58,
+  0x54, 0x33, 0x91, 0x45, 0x29, 0x2d, 0xc8, 0xe2, 0xdb, 0xc1, 0x16, 0xdc, 0x75, 0x3a, 0xef, 0x05,
+  0x21, 0x6b, 0xb3, 0x66, 0xe2, 0x64, 0x61, 0xbd, 0xcd, 0xeb, 0xa6, 0xf5, 0xd2, 0x7d, 0x5e, 0x64,
+  0x0e, 0x76, 0xcc, 0xc7, 0x03, 0xd6, 0x0a, 0xb6, 0x6d, 0xf9, 0xa0, 0xb0, 0xf0, 0x02, 0xfb, 0x8d,
+  0xb0, 0x36, 0x53, 0x35, 0x6f, 0x97, 0xeb, 0xcf, 0xc7, 0x73, 0xfd, 0x20, 0x1c, 0x9a, 0x4e, 0xfc,
+  0xd5, 0x55, 0xa9, 0xc0, 0x6f, 0xa8, 0x31, 0xd3, 0xd3, 0x26, 0x4f, 0xbd, 0x0d, 0xfb, 0x94, 0xb3,
+  0xfa, 0xca, 0x9f, 0xe9, 0xcd, 0xc0, 0x29, 0x11, 0xe7, 0x5f, 0x3d, 0x4d, 0xbb, 0xeb, 0x07, 0x07,
+  0xee, 0x49, 0x6e, 0x8f, 0x95, 0x9a, 0xb1, 0x66, 0x90, 0x46, 0x42, 0x75, 0xc8, 0x5b, 0x39, 0x2c,
+  0x6f, 0x0b, 0x8e, 0xd9, 0xfb, 0x3c, 0xcb, 0x58, 0x79, 0xfd, 0xc3, 0x0b, 0xff, 0xef, 0x50, 0x42,
+  0x73, 0x75, 0xad, 0xd7, 0x1b, 0x06, 0xb5, 0xb0, 0x70, 0x02, 0xbd, 0xc3, 0xf5, 0xf3, 0xcf, 0xb6,
+  0xa8, 0x74, 0x03, 0x02, 0x80, 0x07, 0xe3, 0x82, 0x71, 0xaf, 0x8f, 0xc5, 0xe2, 0x71, 0x63, 0xd0,
+  0x37, 0x72, 0x61, 0x7d, 0x33, 0x8c, 0xf8, 0x0e, 0xbd, 0x4b, 0x72, 0xb7, 0xdc, 0x62, 0xef, 0x79,
+  0xb4, 0x4e, 0xbf, 0xf2, 0xa0, 0xf7, 0x94, 0xf0, 0xcf, 0x49, 0xdf, 0x02, 0x70, 0x7e, 0x7e, 0x7c,
+  0xd1, 0x4c, 0xe5, 0xfc, 0x78, 0xa3, 0x25, 0x15, 0x67, 0x24, 0xa6, 0xbc, 0x92, 0xe3, 0x48, 0x25,
+  0xc3, 0x8a, 0x6b, 0xd9, 0x60, 0xf6, 0x7b, 0xee, 0x16, 0x00, 0xef, 0xe1, 0x65, 0xb4, 0xdc, 0x39,
+  0xba, 0x8c, 0x6d, 0x77, 0xca, 0x93, 0x65, 0xc2, 0x25, 0x83, 0xeb, 0x30, 0x8b, 0x63, 0x34, 0x4f,
+  0xd3, 0x02, 0xee, 0xf6, 0x79, 0x3b, 0x48, 0x4b, 0xe5, 0x29, 0x91, 0x7e, 0x65, 0xc0, 0x71, 0xa6,
+  0x6d, 0x71, 0x64, 0x25, 0xa4, 0xe6, 0x30, 0x0b, 0xeb, 0x60, 0xb3, 0x37, 0xcc, 0xfc, 0x39, 0xbb,
+  0x26, 0x38, 0x8b, 0xc4, 0xce, 0x2f, 0x11, 0x7c, 0xb5, 0xf5, 0xb5, 0xe0, 0x2b, 0x28, 0xca, 0xbf,
+  0x41, 0x70, 0xe3, 0x6c, 0x32, 0x1a, 0xf0, 0xf4, 0x25, 0xa2, 0x1b, 0x03, 0x3d, 0x4b, 0x76, 0x1e,
+  0x0b, 0x31, 0xe9, 0x79, 0xcf, 0xa1, 0x1a, 0x03, 0x21, 0xe6, 0xb4, 0x1c, 0xb9, 0x0d, 0xbc, 0x94,
+  0x3b, 0x1f, 0xfe, 0xc8, 0x46, 0xc6, 0xd3, 0xfb, 0xce, 0x88, 0x29, 0x10, 0xd9, 0xda, 0x3b, 0x26,
+  0x22, 0x8c, 0x0e, 0xb3, 0x89, 0x1a, 0xf7, 0xcb, 0xb1, 0x41, 0x73, 0xba, 0x86, 0x1a, 0xce, 0x0c,
+  0xfa, 0xbd, 0xa1, 0xc4, 0xbb, 0x2b, 0xaa, 0x03, 0x1e, 0x1d, 0x74, 0xa5, 0x47, 0x6f, 0x57, 0xe5,
+  0x2c, 0xf2, 0x63, 0xff, 0x5b, 0x5a, 0x9c, 0x54, 0xcc, 0x31, 0x68, 0xcd, 0x03, 0x84, 0x89, 0x1b,
+  0x08, 0xac, 0x54, 0x13, 0xea, 0x0e, 0x26, 0x16, 0xbc, 0x3b, 0x5f, 0x18, 0xf1, 0x54, 0xc7, 0x01,
+  0xc4, 0xc4, 0x4a, 0x78, 0x10, 0x0f, 0x1e, 0xf5, 0x48, 0x19, 0x6d, 0xe9, 0xa0, 0xb6, 0x92, 0x68,
+  0x8f, 0x99, 0x89, 0xee, 0x38, 0x5b, 0x0c, 0xfa, 0xc1, 0x3a, 0x5b, 0x8a, 0xd7, 0xfa, 0xf9, 0x16,
+  0x25, 0x2f, 0xbe, 0x5e, 0xc9, 0x3d, 0xde, 0x9e, 0xab, 0x6a, 0xb3, 0x9b, 0x38, 0x52, 0x19, 0xaa,
+  0xcc, 0x71, 0xe2, 0x32, 0x71, 0xef, 0xb6, 0x59, 0x29, 0xba, 0xe1, 0x2b, 0xd2, 0x43, 0x3b, 0x77,
+  0x31, 0x95, 0x37, 0xf2, 0xea, 0x81, 0xb1, 0x0c, 0x02, 0x83, 0x22, 0xbd, 0x08, 0x32, 0xa8, 0x0c,
+  0x5f, 0x7e, 0x53, 0xe5, 0x6e, 0x0f, 0x8e, 0x12, 0x7b, 0x23, 0x24, 0x39, 0xe3, 0xa2, 0x2e, 0x99,
+  0x66, 0x45, 0xb5, 0xf3, 0xda, 0xbc, 0x95, 0x79, 0xa4, 0x76, 0x75, 0xd4, 0x96, 0x2b, 0x3b, 0x8e,
+  0x8c, 0x7d, 0x4b, 0x23, 0xb0, 0x9c, 0x8e, 0x47, 0x56, 0xa7, 0x72, 0xef, 0xa1, 0x9f, 0x7e, 0xf8,
+  0xb3, 0xe4, 0xe9, 0x9c, 0xfa, 0x12, 0x38, 0xf9, 0x03, 0xd2, 0xea, 0x33, 0xf5, 0xc5, 0x78, 0xd9,
+  0xb8, 0x90, 0x80, 0xc7, 0xa5, 0x19, 0x57, 0xc4, 0xf0, 0xd0, 0x6f, 0x44, 0x09, 0xf2, 0x50, 0xd4,
+  0xe7, 0xe7, 0x74, 0x7e, 0xf7, 0x62, 0xc1, 0x64, 0x10, 0xb5, 0x54, 0x12, 0xe8, 0x56, 0x8a, 0xa3,
+  0xaa, 0xe8, 0xf9, 0xde, 0xfc, 0x5c, 0xf6, 0x0d, 0x08, 0x5f, 0xf1, 0x3d, 0x16, 0xc8, 0xff, 0x6f,
+  0x20, 0xf9, 0xe1, 0x5f, 0x1e, 0x6f, 0x41, 0x5b, 0xfc, 0xdb, 0x81, 0x65, 0x39, 0x25, 0x57, 0xc6,
+  0xb6, 0x58, 0x92, 0xf0, 0x9d, 0x26, 0x14, 0xdd, 0x75, 0x32, 0xe8, 0xf0, 0xd6, 0x2e, 0x63, 0x1c,
+  0xd4, 0x62, 0x52, 0x84, 0x47, 0x3e, 0x98, 0xbd, 0xdd, 0x39, 0xba, 0xbf, 0x29, 0x77, 0x34, 0xcf,
+  0x6c, 0x54, 0x12, 0x72, 0x61, 0x6c, 0x3d, 0x8a, 0x8d, 0x4b, 0x7d, 0x2d, 0xcb, 0xea, 0xde, 0x7d,
+  0xd8, 0xbb, 0x8f, 0xf4, 0xbd, 0xaa, 0xe4, 0x75, 0x83, 0xdc, 0x76, 0xd0, 0xf7, 0xf6, 0xbe, 0x64,
+  0xb7, 0x33, 0xa9, 0xef, 0xcd, 0xbd, 0x46, 0x2e, 0xa8, 0xb1, 0x49, 0x63, 0xbf, 0x64, 0xaa, 0x53,
+  0x2c, 0x5c, 0x0e, 0xd7, 0xee, 0xc7, 0x39, 0x0b, 0x7d, 0x1c, 0xd1, 0xd7, 0xbc, 0xd3, 0x97, 0x7e,
+  0x51, 0xb7, 0x7f, 0xd0, 0xa0, 0x7c, 0xf7, 0x71, 0x54, 0xa9, 0x3d, 0xbd, 0x2d, 0x3a, 0x7a, 0xf7,
+  0xc1, 0x6c, 0xdf, 0x82, 0x65, 0x07, 0xa7, 0x97, 0xf3, 0x51, 0xe4, 0xa1, 0x90, 0xf5, 0x3c, 0xd4,
+  0x9d, 0x9c, 0x15, 0xbc, 0x64, 0xd7, 0x38, 0x3d, 0x19, 0x12, 0x26, 0x6a, 0x84, 0x9e, 0xbc, 0x9a,
+  0xff, 0xc7, 0x57, 0x7f, 0x01, 0x60, 0x0c, 0x8a, 0x55, 0x1f, 0x33, 0x00, 0x00,
+};
+
+// dashboard.js: 31574 B roh, 9164 B gzip
+static const uint8_t DASHBOARD_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x3d, 0x4d, 0x6f, 0x1b, 0xc9,
+  0x72, 0x77, 0xff, 0x8a, 0xb6, 0x37, 0xd9, 0x99, 0xb1, 0x49, 0x8a, 0xd4, 0xd7, 0xda, 0x94, 0x64,
+  0x43, 0x96, 0xe5, 0x95, 0xb2, 0x92, 0xe5, 0x88, 0xf2, 0xda, 0x7e, 0x8e, 0xa3, 0x37, 0x24, 0x9b,
+  0xe4, 0xac, 0x86, 0x33, 0xdc, 0x99, 0xa1, 0x28, 0xc9, 0x4f, 0x40, 0x80, 0x00, 0x39, 0x05, 0x08,
+  0x90, 0x00, 0x41, 0x92, 0x4b, 0x72, 0xc8, 0x31, 0x87, 0x77, 0x49, 0x90, 0xc3, 0x3b, 0xbd, 0xfd,
+  0x01, 0xf9, 0x0f, 0xfb, 0x07, 0x92, 0x9f, 0x90, 0xaa, 0xea, 0x8f, 0xe9, 0x9e, 0x19, 0x92, 0xb2,
+  0xdf, 0x5b, 0x63, 0x57, 0x22, 0xbb, 0xbb, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xab, 0x5b,
+  0xbd, 0x38, 0x4a, 0x33, 0xd6, 0xf3, 0xa3, 0x4b, 0x3f, 0x65, 0x3b, 0xac, 0x1f, 0xf7, 0xa6, 0x63,
+  0x1e, 0x65, 0x8d, 0x21, 0xcf, 0xf6, 0x43, 0x8e, 0x1f, 0x9f, 0x5f, 0x1f, 0xf6, 0x5d, 0x27, 0xf1,
+  0xfb, 0x7e, 0xe2, 0x78, 0x5b, 0xf7, 0x7a, 0x02, 0x20, 0xbb, 0x82, 0xd6, 0x02, 0x0c, 0xdb, 0xee,
+  0xc5, 0x51, 0xc6, 0xaf, 0x32, 0xd7, 0x59, 0xed, 0xe7, 0x8d, 0xd2, 0xcc, 0xcf, 0xa6, 0xe9, 0x7e,
+  0xb8, 0x08, 0xaf, 0x68, 0x93, 0xc3, 0x64, 0x23, 0xa8, 0x3c, 0x8b, 0x87, 0xc3, 0x90, 0x2f, 0x02,
+  0x33, 0x9a, 0xe5, 0xb0, 0x41, 0x74, 0xc9, 0x93, 0x6c, 0x39, 0xb0, 0xd9, 0x2e, 0x87, 0x3e, 0x3b,
+  0xd8, 0x3f, 0xde, 0x3f, 0xef, 0x9c, 0x9d, 0x9c, 0xee, 0x7e, 0xbb, 0x7f, 0xfe, 0xdd, 0xfe, 0x7b,
+  0x40, 0xe1, 0x24, 0x93, 0x3a, 0x75, 0xe5, 0xa8, 0x56, 0x87, 0xaf, 0xbe, 0xdf, 0x3f, 0x3d, 0x3b,
+  0xdf, 0x3b, 0x39, 0xf9, 0xee, 0xd0, 0x6c, 0x25, 0x70, 0xd6, 0xaf, 0x74, 0xc3, 0x49, 0xc2, 0x07,
+  0x3c, 0x49, 0x5f, 0xf8, 0xc9, 0xc5, 0x9f, 0x4f, 0x79, 0x72, 0x0d, 0xed, 0x66, 0x41, 0xd4, 0x8f,
+  0x67, 0x8d, 0xb1, 0x9f, 0xf5, 0x46, 0xc7, 0xbc, 0x1f, 0xf8, 0xec, 0x59, 0xb9, 0xcc, 0x75, 0x5c,
+  0x09, 0x5a, 0xef, 0xc5, 0x61, 0x9c, 0xd4, 0xd3, 0x1e, 0x12, 0xd0, 0x66, 0xc0, 0xff, 0x0b, 0xcf,
+  0xf1, 0x58, 0x9b, 0x45, 0xd3, 0x30, 0xdc, 0xba, 0x77, 0x6f, 0x30, 0x8d, 0x7a, 0x59, 0x10, 0x47,
+  0xec, 0xd2, 0x4f, 0x5e, 0xfa, 0x61, 0xd8, 0xf5, 0x7b, 0x17, 0xee, 0xa5, 0x1f, 0x4e, 0x79, 0x8d,
+  0x0d, 0xe4, 0x77, 0x8f, 0x7d, 0xba, 0xc7, 0x58, 0x30, 0x60, 0x6e, 0x76, 0x3d, 0xe1, 0xf1, 0x80,
+  0x51, 0x3d, 0xbb, 0xbf, 0x03, 0x54, 0xa7, 0x59, 0x12, 0x44, 0x43, 0xc0, 0x98, 0xf0, 0x6c, 0x9a,
+  0x44, 0x1a, 0x66, 0x0b, 0x20, 0xe4, 0x64, 0x24, 0xc1, 0x78, 0xcc, 0xfb, 0x40, 0x3a, 0x81, 0x35,
+  0xf0, 0xbb, 0xeb, 0x61, 0xbd, 0x04, 0x91, 0x0d, 0x1a, 0x21, 0x8f, 0x86, 0xd9, 0x08, 0x86, 0xa3,
+  0x20, 0xda, 0x06, 0xb6, 0x5b, 0x83, 0xd4, 0x84, 0xfb, 0xfd, 0xbd, 0x38, 0xbe, 0x08, 0xb8, 0x1b,
+  0xf9, 0x63, 0x2e, 0xc8, 0x13, 0x9d, 0x11, 0x0b, 0xcc, 0x69, 0xeb, 0x51, 0x3b, 0xc1, 0x1a, 0x37,
+  0xe2, 0x33, 0x76, 0xca, 0x87, 0xfb, 0x57, 0x13, 0x60, 0xd0, 0xb3, 0xf6, 0x5f, 0xfe, 0x66, 0x8b,
+  0x79, 0x0e, 0x7b, 0xc4, 0x10, 0x0b, 0xfc, 0x72, 0x76, 0xdc, 0x0f, 0x7f, 0xb9, 0xf5, 0xf1, 0x21,
+  0x30, 0xc8, 0xa4, 0x4f, 0xe0, 0x7c, 0xc6, 0xfa, 0xbc, 0x17, 0xf7, 0xf9, 0x9b, 0xd3, 0xc3, 0xbd,
+  0x78, 0x3c, 0x89, 0x23, 0xc0, 0xee, 0x52, 0xd5, 0x87, 0xd6, 0xc7, 0x9c, 0xa1, 0x26, 0x9d, 0xb3,
+  0x24, 0xc8, 0xb8, 0x41, 0x68, 0x8d, 0x49, 0xc6, 0xf6, 0xfd, 0xeb, 0xd4, 0xa6, 0xfa, 0x6a, 0x77,
+  0x88, 0xd2, 0xe6, 0x62, 0x0d, 0xfb, 0xcd, 0x6f, 0xd8, 0xda, 0xe6, 0x86, 0xc7, 0x1e, 0xb2, 0xd5,
+  0x75, 0xf8, 0xb1, 0xd9, 0xa4, 0x1f, 0x48, 0x51, 0x61, 0x58, 0x00, 0xa1, 0x49, 0xc7, 0x71, 0xf0,
+  0xa8, 0x44, 0x21, 0xf5, 0xe8, 0x61, 0x8b, 0x2d, 0x36, 0xf1, 0xb3, 0xd1, 0xce, 0xca, 0x16, 0x76,
+  0x57, 0xf7, 0x87, 0x9c, 0x40, 0x64, 0xd7, 0x54, 0xdf, 0x01, 0x5c, 0x1d, 0x20, 0x79, 0xe7, 0xc8,
+  0x47, 0x11, 0x84, 0xa1, 0x84, 0x3c, 0x43, 0x12, 0x07, 0xc1, 0x70, 0x9a, 0xf0, 0xfe, 0xa9, 0x1f,
+  0x11, 0x95, 0x1b, 0x5b, 0x6c, 0x65, 0x85, 0x7d, 0x1f, 0x8f, 0x59, 0x87, 0x47, 0x69, 0x9c, 0x30,
+  0x0e, 0x22, 0xc0, 0xd3, 0x8c, 0x87, 0x61, 0xc6, 0x81, 0xc1, 0x41, 0x6f, 0x34, 0xe3, 0x80, 0x47,
+  0x0a, 0xf1, 0xf1, 0xee, 0xbb, 0xf3, 0xd3, 0xdd, 0x57, 0xdf, 0xee, 0x03, 0xe8, 0x63, 0x02, 0x3d,
+  0xf6, 0xaf, 0x82, 0xb1, 0x0f, 0xeb, 0xeb, 0x14, 0x15, 0x42, 0xbd, 0x04, 0xf1, 0x7c, 0xb7, 0xb3,
+  0x7f, 0xbe, 0xb7, 0xfb, 0xea, 0xfb, 0xdd, 0xce, 0xf9, 0xdb, 0xc3, 0x17, 0x67, 0x07, 0x08, 0xd9,
+  0x6c, 0x6e, 0x55, 0x54, 0x1f, 0xec, 0x1f, 0x7e, 0x7b, 0x70, 0x06, 0xf5, 0x9b, 0x85, 0xfa, 0xd7,
+  0x87, 0xef, 0xf6, 0x8f, 0x3a, 0xe7, 0xaf, 0xf7, 0x4f, 0xcf, 0x8f, 0xf7, 0xcf, 0xf6, 0x4f, 0x91,
+  0xee, 0x02, 0x86, 0xfd, 0x57, 0x50, 0x7e, 0xfe, 0x0e, 0x6a, 0xd6, 0x9b, 0x95, 0x55, 0xb8, 0x2e,
+  0xd7, 0xa0, 0x46, 0xf0, 0x81, 0xf4, 0xd4, 0xdb, 0xa0, 0x9f, 0xa1, 0x80, 0x95, 0x48, 0xdc, 0x32,
+  0x1a, 0x1d, 0xf0, 0x60, 0x38, 0xca, 0x0a, 0xad, 0x04, 0xa5, 0xa2, 0xd9, 0x24, 0xb8, 0xe2, 0x61,
+  0xfa, 0x9a, 0x27, 0xc7, 0x3c, 0xe3, 0x89, 0x6a, 0x58, 0x24, 0x59, 0xa2, 0x84, 0x69, 0xe4, 0xc9,
+  0x3b, 0x8d, 0x4d, 0x52, 0x6d, 0x56, 0xbe, 0x2f, 0x54, 0xbe, 0x17, 0x95, 0xd3, 0xa0, 0xd3, 0xf3,
+  0x49, 0x8b, 0xb5, 0x44, 0x41, 0xc2, 0xd3, 0xe0, 0x86, 0xbf, 0xe6, 0x51, 0x1f, 0x26, 0x0c, 0x8a,
+  0x61, 0x79, 0xa5, 0x5c, 0x54, 0xa9, 0x95, 0x76, 0x16, 0x8c, 0x89, 0x20, 0x21, 0xcd, 0x58, 0xc3,
+  0x2f, 0xa1, 0x8f, 0x4e, 0x3c, 0x4d, 0x7a, 0xdc, 0x2a, 0x4f, 0x53, 0xfe, 0x16, 0xc5, 0xbf, 0x1f,
+  0x0f, 0xcb, 0x40, 0xa1, 0x9f, 0x66, 0x9d, 0x94, 0xef, 0x23, 0xec, 0x2e, 0x72, 0x42, 0xf3, 0xb7,
+  0xd3, 0x41, 0xfd, 0xb8, 0x7b, 0xb4, 0x7f, 0x7e, 0xdc, 0x11, 0xd3, 0xda, 0x14, 0x20, 0x42, 0xf9,
+  0xbd, 0xdb, 0xbd, 0x0a, 0x52, 0x9b, 0x34, 0xc4, 0x45, 0x82, 0xf2, 0xda, 0xbf, 0x0e, 0x63, 0xbf,
+  0xaf, 0x3a, 0x62, 0x0c, 0x65, 0xa9, 0x93, 0xf9, 0x51, 0x9f, 0xf9, 0xd3, 0x14, 0x10, 0x04, 0xd9,
+  0xca, 0xeb, 0x38, 0x0c, 0x61, 0x70, 0x35, 0x36, 0x01, 0x8a, 0xa0, 0xaf, 0x3a, 0x91, 0x90, 0xb2,
+  0x41, 0x9c, 0x64, 0x20, 0xa3, 0xbd, 0x51, 0x12, 0xf0, 0x2e, 0x8f, 0x34, 0xe2, 0xa3, 0x78, 0xd8,
+  0xe1, 0x3f, 0x9a, 0x04, 0x1e, 0x9d, 0x7c, 0x7b, 0x7e, 0x74, 0xf8, 0x6a, 0xbf, 0x73, 0x0e, 0x82,
+  0x8b, 0xbc, 0x83, 0x1a, 0xe8, 0x67, 0x65, 0x96, 0xb6, 0xd9, 0x99, 0x9f, 0xc0, 0x3e, 0x90, 0xb2,
+  0x6e, 0x10, 0xfd, 0xf4, 0xef, 0x09, 0x1b, 0x07, 0x99, 0x5c, 0x02, 0x89, 0x0f, 0x92, 0xef, 0x3e,
+  0xc3, 0x5f, 0x3b, 0xdb, 0x07, 0x37, 0x4f, 0x99, 0x1f, 0x81, 0xbe, 0x48, 0xd8, 0x0b, 0x3f, 0x1d,
+  0x75, 0x63, 0x3f, 0xe9, 0xd7, 0xdf, 0x9c, 0x1e, 0xb1, 0x7e, 0x12, 0x03, 0xd7, 0xc2, 0xcc, 0x93,
+  0x5d, 0xbd, 0xed, 0xc0, 0xc2, 0x38, 0xdb, 0x3f, 0x3f, 0xf8, 0x15, 0xf4, 0x33, 0xf1, 0x93, 0x94,
+  0x1f, 0xc2, 0x92, 0x45, 0x2d, 0x05, 0xad, 0x3b, 0xdc, 0x4f, 0x7a, 0xa3, 0xd7, 0x7e, 0xe2, 0x8f,
+  0x53, 0x37, 0x8c, 0x7b, 0x3e, 0xea, 0x94, 0x46, 0x4a, 0xa5, 0x1e, 0x6e, 0x47, 0xb8, 0x9f, 0x66,
+  0xb0, 0xf7, 0xa0, 0xbe, 0x70, 0x9a, 0x4e, 0x0d, 0x28, 0xa5, 0xcf, 0x7a, 0x24, 0x88, 0x7e, 0xff,
+  0xec, 0xf4, 0xbd, 0xe0, 0xf4, 0x5a, 0x33, 0x17, 0xf2, 0xb3, 0xd3, 0xdd, 0xc3, 0x23, 0x51, 0xbc,
+  0xaa, 0x27, 0x80, 0x76, 0xe7, 0x4e, 0xdc, 0xbb, 0xe0, 0x99, 0x35, 0x97, 0xb3, 0x74, 0x17, 0xf4,
+  0xd9, 0x25, 0xd7, 0xb3, 0xc2, 0xd4, 0x3f, 0x60, 0x8b, 0xe2, 0xc8, 0x45, 0x0c, 0x2a, 0x3b, 0x62,
+  0x3f, 0xfd, 0xae, 0x0b, 0xa3, 0x06, 0x5e, 0xd5, 0x88, 0xf9, 0x0f, 0x32, 0x51, 0xfd, 0x80, 0xcd,
+  0x78, 0xd2, 0x87, 0xfa, 0x60, 0x18, 0xc5, 0x30, 0x03, 0x49, 0x26, 0x31, 0x9f, 0xc2, 0x08, 0x0e,
+  0x6e, 0x04, 0xfb, 0xb1, 0x44, 0xb6, 0x7f, 0x91, 0xf8, 0xb3, 0x92, 0x98, 0xaa, 0xed, 0xc4, 0x0f,
+  0x42, 0x94, 0x10, 0x64, 0xd3, 0xb1, 0x3f, 0x81, 0xad, 0x44, 0xd3, 0x92, 0x80, 0x00, 0xd7, 0x0f,
+  0x5f, 0xb0, 0x9f, 0xff, 0xe6, 0xef, 0xd9, 0x87, 0x4f, 0x57, 0x35, 0x76, 0x5d, 0x63, 0x7e, 0x76,
+  0xfb, 0x51, 0x82, 0x8e, 0x82, 0x34, 0x8b, 0x93, 0xeb, 0xbd, 0xa5, 0x76, 0x8a, 0x6a, 0x38, 0xf2,
+  0x93, 0x2c, 0xdf, 0xdb, 0x55, 0x29, 0x59, 0x2d, 0x36, 0xae, 0x67, 0xf6, 0xf7, 0x92, 0x31, 0xa3,
+  0xb7, 0x07, 0x81, 0xe9, 0xe0, 0x10, 0x2d, 0x84, 0xf7, 0x30, 0x3b, 0x2f, 0x4f, 0xf7, 0x3b, 0x07,
+  0x62, 0x22, 0x3e, 0xb1, 0x56, 0x1b, 0xa6, 0x10, 0xfe, 0xd5, 0x40, 0x99, 0xb5, 0x51, 0xa1, 0x89,
+  0x8f, 0xf0, 0x19, 0xe7, 0xae, 0xd9, 0x64, 0xb7, 0x45, 0x04, 0xbf, 0x3a, 0x79, 0x05, 0x8b, 0xfe,
+  0xe4, 0xe8, 0xe4, 0x14, 0x31, 0x7c, 0x70, 0xbe, 0x6a, 0xfa, 0x8f, 0xd7, 0x07, 0x03, 0x90, 0x05,
+  0xe7, 0xab, 0xc1, 0xe0, 0xc9, 0xa0, 0xe9, 0xd3, 0xc7, 0xee, 0x60, 0xc3, 0x1f, 0xac, 0xd2, 0xc7,
+  0xcd, 0xf5, 0xfe, 0xaa, 0x6e, 0xd0, 0xdf, 0x94, 0x0d, 0x06, 0x83, 0xb5, 0x6f, 0x36, 0x44, 0xe9,
+  0x5a, 0xb3, 0xdf, 0xda, 0x78, 0x4c, 0x1f, 0xfd, 0xde, 0x63, 0xbe, 0xf9, 0xd8, 0xf9, 0x28, 0xa6,
+  0x46, 0x8e, 0xf0, 0x94, 0xa7, 0xb9, 0x42, 0x91, 0x65, 0x9d, 0x09, 0x88, 0x3b, 0x48, 0xd8, 0xa6,
+  0x12, 0x25, 0x59, 0x5e, 0xad, 0x17, 0x0e, 0x44, 0xa5, 0x2e, 0x97, 0x63, 0x02, 0xe5, 0xc4, 0xb3,
+  0x53, 0xee, 0xa7, 0x71, 0x04, 0xd3, 0x8a, 0x0c, 0x81, 0x0d, 0x0f, 0x58, 0xe2, 0xbc, 0x3e, 0x79,
+  0xbb, 0x7f, 0x7a, 0xf2, 0x0a, 0xb8, 0xd5, 0xd9, 0x3f, 0x73, 0x6a, 0x50, 0xba, 0x06, 0xa5, 0x9d,
+  0xb7, 0x46, 0xc1, 0x3a, 0x14, 0x9c, 0xbc, 0x7d, 0x71, 0x66, 0x14, 0x6d, 0x40, 0xd1, 0x8b, 0xfd,
+  0xfd, 0xd7, 0x9d, 0x23, 0xf8, 0x61, 0x94, 0x6f, 0x22, 0xec, 0x8b, 0xc3, 0x13, 0xa3, 0xe8, 0x1b,
+  0x28, 0x3a, 0xfb, 0xb6, 0x89, 0xf0, 0x9d, 0xf7, 0x1d, 0xa3, 0xe2, 0x31, 0x55, 0xb4, 0xca, 0x15,
+  0x4f, 0xa0, 0xe2, 0xf4, 0x6c, 0xaf, 0x5c, 0xd1, 0x82, 0xc9, 0x72, 0x0e, 0x5f, 0x9d, 0x9d, 0xbe,
+  0xe9, 0x1c, 0x5a, 0x24, 0xb7, 0x5a, 0x84, 0x0b, 0x21, 0xf6, 0x5e, 0xbf, 0x31, 0x2b, 0x56, 0xc5,
+  0x60, 0x0a, 0xa5, 0x6b, 0x79, 0x0f, 0x85, 0x1a, 0x1c, 0xeb, 0xfe, 0xbb, 0x52, 0xf1, 0x46, 0x0e,
+  0xf0, 0xfc, 0xf4, 0xe4, 0xed, 0xab, 0xf3, 0x93, 0x37, 0x26, 0x3b, 0x5a, 0x9b, 0x79, 0x3d, 0xfc,
+  0x92, 0x35, 0xf7, 0x6e, 0x4d, 0x13, 0x10, 0x74, 0x24, 0x18, 0x34, 0xa7, 0xf9, 0x3c, 0xb8, 0x68,
+  0x4e, 0xe4, 0xd6, 0x1f, 0x7e, 0x63, 0x3b, 0x60, 0xf5, 0x4d, 0xa3, 0x3e, 0x1f, 0x04, 0x11, 0x98,
+  0x68, 0xa0, 0x6e, 0x74, 0x29, 0xce, 0xa6, 0xb6, 0x03, 0x9d, 0xba, 0xb3, 0x65, 0x1b, 0x8d, 0xba,
+  0x5d, 0xc9, 0x66, 0xc4, 0x1a, 0xc3, 0xde, 0xb2, 0x05, 0xe1, 0x03, 0xd6, 0x7e, 0xc4, 0x8e, 0x5c,
+  0x87, 0x50, 0xa0, 0xd5, 0x42, 0x74, 0xd9, 0xc6, 0x16, 0xe8, 0x76, 0x7f, 0xc2, 0x0f, 0xb2, 0x71,
+  0xa8, 0x6c, 0x9e, 0x4f, 0x39, 0xca, 0x0e, 0xf5, 0x28, 0x2b, 0xee, 0xa1, 0xba, 0x68, 0x24, 0x7c,
+  0x12, 0xfa, 0x3d, 0xee, 0xae, 0x7c, 0xbd, 0x02, 0xbb, 0x85, 0xf3, 0xb5, 0x3f, 0x9e, 0x6c, 0x39,
+  0xc5, 0xba, 0x6d, 0x51, 0x17, 0x66, 0xe5, 0xaa, 0xa7, 0xa2, 0x6a, 0x58, 0x51, 0xf5, 0x40, 0x54,
+  0xfd, 0x38, 0x8d, 0x2b, 0x2a, 0x1d, 0x51, 0xf9, 0xd5, 0xda, 0x93, 0x2d, 0xa7, 0x30, 0x04, 0x7f,
+  0x32, 0x09, 0xaf, 0xcf, 0xd0, 0x50, 0x77, 0xc7, 0x9a, 0xf1, 0xd2, 0x2b, 0x49, 0x8f, 0xa4, 0x49,
+  0x31, 0xd6, 0x6c, 0x0c, 0xb1, 0xc4, 0xb1, 0xcc, 0xc2, 0x6e, 0xdc, 0xbf, 0x6e, 0xf4, 0x60, 0x91,
+  0x41, 0xf3, 0x34, 0x6b, 0x64, 0xe4, 0x9d, 0xb8, 0xa2, 0x65, 0x1d, 0x21, 0x61, 0x5d, 0x4b, 0x54,
+  0xde, 0x5d, 0x00, 0xd1, 0x5d, 0x50, 0x70, 0xf7, 0x4d, 0x40, 0x9a, 0xd7, 0xdc, 0x7d, 0x12, 0xa4,
+  0x32, 0xd3, 0xf1, 0x6a, 0xa0, 0xf6, 0x23, 0x25, 0x18, 0x21, 0xd9, 0x6a, 0x00, 0xcf, 0x98, 0xf3,
+  0x7f, 0xff, 0xfa, 0xb7, 0xff, 0xcc, 0xd0, 0xa5, 0x61, 0xc7, 0x88, 0x19, 0x74, 0xa3, 0xf3, 0xf3,
+  0x3f, 0xfd, 0xd5, 0xff, 0xfe, 0xf7, 0xdf, 0x31, 0xd1, 0x84, 0x4a, 0xb1, 0x93, 0x5b, 0x8b, 0x3b,
+  0xd3, 0x49, 0x1f, 0x36, 0x8b, 0x43, 0xc3, 0xed, 0x3a, 0xf2, 0xbb, 0x3c, 0x74, 0x73, 0xf9, 0xbc,
+  0x6f, 0xfa, 0x64, 0x4a, 0xba, 0x88, 0x5a, 0xa3, 0xbc, 0x48, 0x97, 0x61, 0x75, 0x00, 0x6d, 0x02,
+  0x3d, 0x6e, 0x50, 0x44, 0xd7, 0x2b, 0x5c, 0x11, 0xa1, 0x53, 0xc2, 0x51, 0xe6, 0x94, 0x4f, 0x5b,
+  0x24, 0xb2, 0x37, 0x47, 0xe8, 0x95, 0xe0, 0x40, 0xb0, 0x77, 0x33, 0x90, 0xc5, 0xee, 0x34, 0x43,
+  0x98, 0x24, 0xf0, 0xeb, 0xe0, 0xa7, 0x81, 0x4d, 0xd0, 0xb7, 0x21, 0x91, 0x94, 0x2c, 0x99, 0x0a,
+  0xe6, 0xd0, 0xf6, 0x57, 0x94, 0x15, 0x34, 0x76, 0x84, 0xa8, 0x88, 0xf1, 0x93, 0x45, 0x06, 0x6a,
+  0x95, 0xf7, 0x8f, 0x49, 0x40, 0xa4, 0x6e, 0x85, 0x29, 0x01, 0x4d, 0x2b, 0x26, 0xc7, 0xaa, 0x46,
+  0x83, 0x22, 0xec, 0x40, 0x09, 0x38, 0x02, 0xb8, 0x5d, 0x1d, 0x66, 0x7c, 0xec, 0x96, 0xbc, 0x57,
+  0x1a, 0xc1, 0x2d, 0x58, 0xb5, 0xe8, 0x01, 0xb9, 0x3c, 0x49, 0xbc, 0x2a, 0x5c, 0xaa, 0x2b, 0xa0,
+  0x4f, 0x10, 0x82, 0xc4, 0x05, 0x7e, 0x28, 0xab, 0xf3, 0xb6, 0x4a, 0x72, 0xcc, 0xfa, 0xfb, 0xb9,
+  0x28, 0xb3, 0xaf, 0xbf, 0x66, 0xa5, 0x2a, 0x14, 0x41, 0x47, 0x75, 0x5b, 0xf2, 0x8a, 0xd1, 0x6e,
+  0x2a, 0xfa, 0xc8, 0xcf, 0x4a, 0x45, 0xc2, 0xfd, 0x83, 0x8d, 0xab, 0xcd, 0x90, 0xab, 0x5b, 0x84,
+  0xcb, 0x26, 0xd2, 0xc4, 0xf9, 0x4c, 0xf6, 0x8a, 0xcc, 0xcf, 0x17, 0x19, 0x8d, 0xce, 0x58, 0xa2,
+  0x06, 0x3c, 0xb0, 0xe9, 0x6e, 0x6b, 0xc2, 0xef, 0xf7, 0xc9, 0x1e, 0x45, 0xd1, 0xe1, 0x11, 0x4f,
+  0x40, 0xa5, 0x85, 0x41, 0xef, 0x02, 0x26, 0x1f, 0xa6, 0x71, 0xe7, 0xa9, 0x84, 0x50, 0xe3, 0x04,
+  0x0b, 0x47, 0x52, 0x37, 0x6f, 0x9d, 0x42, 0xbb, 0xcc, 0x0f, 0xa2, 0xd4, 0x5a, 0xe2, 0xde, 0x9c,
+  0x01, 0xe0, 0x3f, 0x83, 0x7e, 0x89, 0xdd, 0x53, 0x55, 0xb9, 0xa0, 0xe0, 0x3f, 0x4b, 0x3e, 0xd2,
+  0x79, 0xf2, 0x51, 0x63, 0x45, 0x2c, 0x55, 0xc2, 0x42, 0xe6, 0xd9, 0x43, 0x61, 0xfb, 0x71, 0x12,
+  0x07, 0x40, 0xca, 0xa0, 0x41, 0x9c, 0xa4, 0xec, 0xe1, 0x8a, 0x82, 0xa4, 0xdf, 0xb7, 0x9e, 0xe6,
+  0xb5, 0xb4, 0xba, 0xc0, 0xbc, 0x0f, 0x79, 0xe7, 0x1a, 0x18, 0x36, 0x26, 0xc2, 0xc1, 0x2a, 0x13,
+  0x6e, 0xa8, 0x4b, 0x9e, 0x89, 0xc1, 0xb7, 0x7c, 0x0d, 0x18, 0x42, 0x69, 0x0f, 0x4c, 0x57, 0x7f,
+  0x86, 0xfc, 0xcf, 0x1b, 0x54, 0x45, 0x57, 0x62, 0x0c, 0x28, 0x08, 0xaa, 0xd2, 0x90, 0x6e, 0xd8,
+  0xc2, 0xcc, 0x52, 0x4b, 0xb0, 0xd5, 0x4e, 0x45, 0xee, 0xf1, 0x34, 0x05, 0xab, 0x49, 0x08, 0x24,
+  0x78, 0xf4, 0x9c, 0xc5, 0xa0, 0x17, 0x92, 0xa0, 0x0f, 0xf2, 0x9b, 0x12, 0x1b, 0x8c, 0xae, 0x8c,
+  0xf9, 0x24, 0x6e, 0x68, 0x49, 0x2f, 0x8b, 0x80, 0x60, 0xac, 0x96, 0xd4, 0xe2, 0x1a, 0x51, 0x94,
+  0x54, 0xd5, 0x95, 0xe4, 0x36, 0x27, 0x7b, 0x69, 0x53, 0x10, 0x71, 0x9a, 0x30, 0x90, 0xf1, 0x39,
+  0x53, 0xa9, 0x99, 0x0c, 0x2e, 0x31, 0x9f, 0xdb, 0xff, 0xdd, 0xba, 0xd6, 0xbd, 0x2e, 0xe9, 0xab,
+  0xb4, 0xbb, 0xe0, 0x6a, 0x36, 0xf7, 0x16, 0xd7, 0xdc, 0x7d, 0xf5, 0x4c, 0x1b, 0x91, 0xa7, 0x52,
+  0x0c, 0xcf, 0xd0, 0xf6, 0xca, 0x89, 0x35, 0xa7, 0xbb, 0x45, 0x6b, 0x70, 0xee, 0x26, 0xa6, 0xe7,
+  0xc5, 0xde, 0xc3, 0xe4, 0x9c, 0x98, 0x7b, 0xc8, 0x5d, 0x75, 0x88, 0x4d, 0xca, 0x7d, 0xe3, 0xab,
+  0x5a, 0xab, 0x0b, 0x88, 0x11, 0x0d, 0xcc, 0x00, 0x56, 0x69, 0xbc, 0xa5, 0x0d, 0xab, 0x45, 0xc2,
+  0x86, 0x8e, 0x28, 0x46, 0xaf, 0x14, 0x0e, 0x1c, 0x53, 0xd1, 0x83, 0x37, 0x15, 0x83, 0x20, 0x82,
+  0x6a, 0xcb, 0xed, 0x72, 0xad, 0x42, 0xb2, 0x91, 0x43, 0xf5, 0xc1, 0x41, 0x14, 0x30, 0x79, 0x1b,
+  0x4b, 0x7f, 0xd8, 0xf1, 0x42, 0x0c, 0x7b, 0x08, 0xd7, 0xcc, 0x34, 0x17, 0x64, 0xc0, 0x1a, 0xd6,
+  0xe5, 0xfd, 0x5e, 0x76, 0x65, 0x86, 0x30, 0x53, 0x9e, 0xc7, 0x2f, 0x13, 0xde, 0xcb, 0xac, 0x30,
+  0xf5, 0xf3, 0x78, 0x4a, 0x9e, 0xe9, 0x5e, 0x18, 0xc0, 0x34, 0x9c, 0x42, 0xb5, 0x20, 0x82, 0x3c,
+  0x5a, 0x19, 0x1e, 0x3a, 0xf6, 0xb3, 0x11, 0xac, 0xc5, 0x2b, 0xb7, 0x55, 0x13, 0x9f, 0x13, 0x04,
+  0x72, 0x11, 0x57, 0x83, 0xda, 0x78, 0xda, 0x8c, 0x12, 0x20, 0xdb, 0xe0, 0x3a, 0xe0, 0xfe, 0x27,
+  0xbb, 0x99, 0xf8, 0xb0, 0xf4, 0x95, 0x53, 0xaa, 0xd8, 0xb5, 0x04, 0x79, 0x15, 0x28, 0xec, 0x15,
+  0x48, 0xe4, 0xdb, 0xbc, 0xcb, 0xdb, 0x52, 0xb7, 0x0a, 0x7d, 0xc2, 0x7f, 0x9c, 0xf2, 0x34, 0xdb,
+  0x8d, 0x82, 0x31, 0xc5, 0x1a, 0x5e, 0x26, 0x3e, 0xa8, 0x15, 0x93, 0x79, 0x92, 0xd7, 0x45, 0x3e,
+  0xdd, 0x6a, 0x5e, 0xf9, 0xe9, 0x04, 0x46, 0x78, 0x8a, 0xe0, 0x95, 0xd1, 0x2f, 0xb6, 0x52, 0x15,
+  0x38, 0xd3, 0xaa, 0x5e, 0x85, 0xcd, 0x8c, 0x41, 0x09, 0x32, 0x1f, 0x9a, 0x98, 0x89, 0x0a, 0x39,
+  0xd8, 0x34, 0xbb, 0x86, 0x25, 0xa1, 0x01, 0xe5, 0x87, 0x47, 0xcc, 0x99, 0x60, 0x04, 0x53, 0x63,
+  0xa6, 0x78, 0x9b, 0x22, 0x4b, 0x46, 0xcb, 0xfb, 0xfc, 0x32, 0xe8, 0xf1, 0xd7, 0x79, 0x0d, 0xc8,
+  0x41, 0x2b, 0x27, 0x26, 0xc0, 0xc0, 0x5a, 0xe4, 0x87, 0x6f, 0x17, 0x33, 0x5d, 0xd1, 0x97, 0xf7,
+  0x20, 0xd8, 0x6c, 0x23, 0x39, 0xb0, 0x46, 0x56, 0xc6, 0x22, 0xe9, 0x2e, 0xa3, 0x21, 0xb7, 0x4b,
+  0x0c, 0x55, 0xf4, 0x84, 0x36, 0x91, 0x4d, 0x1a, 0xba, 0x60, 0xa2, 0x85, 0xc4, 0x62, 0x36, 0x11,
+  0x1d, 0x6b, 0xf3, 0xc9, 0xc4, 0x54, 0xc0, 0xb3, 0x65, 0xb6, 0xd0, 0x0c, 0xb5, 0xf1, 0xe8, 0xc9,
+  0xce, 0xae, 0xd0, 0x26, 0x38, 0x4b, 0xfc, 0x28, 0x45, 0xa7, 0xd1, 0xcd, 0xc9, 0xae, 0xb1, 0x26,
+  0xfd, 0x57, 0x2c, 0x11, 0x0a, 0xce, 0x8e, 0xa1, 0xce, 0x54, 0xbf, 0x85, 0xa8, 0xe9, 0x48, 0x77,
+  0x96, 0x47, 0x30, 0x4d, 0xc8, 0x39, 0x42, 0x74, 0xb7, 0xa0, 0x2a, 0x30, 0x59, 0x62, 0xa5, 0x9e,
+  0xab, 0x83, 0xab, 0x55, 0x8d, 0x4a, 0x41, 0x56, 0xbb, 0x91, 0x3e, 0xcc, 0x40, 0xfb, 0xd2, 0xd6,
+  0x3e, 0x86, 0xb2, 0xd2, 0xca, 0x67, 0x9e, 0x4a, 0x5c, 0xaa, 0x0e, 0x2d, 0x55, 0x58, 0x50, 0x83,
+  0xb6, 0xda, 0xc3, 0x33, 0x9f, 0xfe, 0x34, 0x94, 0x6b, 0xf7, 0x94, 0x0f, 0x60, 0x29, 0x8f, 0x0c,
+  0x12, 0xac, 0x68, 0xb0, 0xe9, 0x2e, 0x15, 0xc3, 0xc4, 0xca, 0x66, 0x96, 0x6b, 0x3c, 0x83, 0x2d,
+  0x75, 0x92, 0x49, 0x7c, 0x68, 0x87, 0x19, 0xdb, 0x4e, 0x8e, 0x57, 0xa9, 0x5b, 0xd3, 0xc2, 0xa9,
+  0x8c, 0x3e, 0xab, 0xca, 0x92, 0x4a, 0x2f, 0x28, 0xfd, 0x6a, 0xf5, 0x64, 0x53, 0x63, 0x6e, 0xef,
+  0x62, 0x24, 0x77, 0x82, 0xb9, 0x2d, 0x05, 0x41, 0xde, 0x4c, 0xb2, 0x60, 0x2c, 0xb7, 0xc3, 0x71,
+  0x10, 0x81, 0xbb, 0x96, 0xd6, 0x64, 0x55, 0xc6, 0xfb, 0x39, 0x0f, 0x75, 0x11, 0xea, 0x6e, 0x19,
+  0xe8, 0xc8, 0xcb, 0xec, 0x68, 0xc7, 0x27, 0x4b, 0x79, 0xaa, 0x46, 0xb6, 0x02, 0xcd, 0xe2, 0x0c,
+  0x5c, 0x0a, 0xd1, 0x21, 0xb0, 0xe8, 0xd5, 0x74, 0xdc, 0xe5, 0x49, 0x23, 0x48, 0x5f, 0xa2, 0x7d,
+  0xc2, 0x15, 0x29, 0x68, 0xe1, 0x6b, 0x4d, 0xd2, 0x94, 0x9a, 0x64, 0x10, 0xc6, 0x71, 0xa2, 0x5b,
+  0x60, 0xc8, 0xb1, 0x69, 0xa8, 0xd6, 0x78, 0x9a, 0xa4, 0x5a, 0xff, 0x04, 0x91, 0xfb, 0xe4, 0xc9,
+  0x13, 0x0b, 0xce, 0xea, 0x78, 0x85, 0x6d, 0x36, 0x4d, 0x35, 0x06, 0x00, 0x08, 0x6c, 0xb5, 0xf9,
+  0x53, 0x79, 0x24, 0x25, 0xc7, 0x43, 0x1d, 0x80, 0x37, 0x2c, 0x23, 0x2d, 0x1e, 0x6c, 0x43, 0xfd,
+  0x4e, 0xe6, 0x27, 0x99, 0xbb, 0x56, 0x43, 0xa3, 0x80, 0x8e, 0xa0, 0xda, 0x74, 0xe2, 0x04, 0xc8,
+  0x2a, 0x1b, 0xae, 0x8a, 0x86, 0xf6, 0x74, 0xa4, 0x20, 0x2e, 0x7b, 0xf1, 0x78, 0xec, 0xe3, 0x06,
+  0x37, 0x96, 0x9c, 0x1f, 0x70, 0x3c, 0xcd, 0x73, 0x56, 0xfc, 0x49, 0xb0, 0x02, 0x85, 0xcf, 0xe0,
+  0x7f, 0x3a, 0xcc, 0xc2, 0x06, 0x22, 0xdc, 0x02, 0x4e, 0x57, 0x84, 0x82, 0x88, 0x92, 0x09, 0xbf,
+  0xc8, 0xe9, 0x07, 0x59, 0x34, 0x2a, 0x61, 0x99, 0xf9, 0xa6, 0xb9, 0x04, 0xcb, 0x18, 0x68, 0x70,
+  0x9e, 0x83, 0x4d, 0x39, 0x0a, 0xd9, 0x90, 0x63, 0xc7, 0x3c, 0x6b, 0x33, 0x89, 0x17, 0xc9, 0xff,
+  0x8b, 0x68, 0x37, 0xca, 0x66, 0x71, 0x22, 0x4b, 0x11, 0x83, 0x12, 0x38, 0x89, 0x99, 0xdc, 0x04,
+  0xf4, 0x12, 0x2a, 0x30, 0xbf, 0x04, 0xbc, 0xa0, 0x96, 0xba, 0x3c, 0xa0, 0x73, 0x33, 0x8c, 0x86,
+  0xa3, 0x49, 0x2f, 0x3a, 0x4c, 0x05, 0x4a, 0xf4, 0x2f, 0xb6, 0xb4, 0x1d, 0x63, 0x89, 0x25, 0x0e,
+  0xf9, 0x05, 0xf4, 0xe8, 0x96, 0x59, 0x20, 0x8f, 0xd5, 0xab, 0x47, 0xfe, 0x03, 0xc6, 0xf1, 0x16,
+  0x8e, 0x5c, 0x9d, 0xb0, 0x0b, 0xbf, 0xf2, 0x15, 0x1e, 0x28, 0x82, 0xd8, 0xc2, 0xcc, 0x47, 0xb0,
+  0xe3, 0xf2, 0xbe, 0x63, 0x5a, 0x72, 0xfa, 0x2c, 0x00, 0xc4, 0x7d, 0x91, 0x55, 0x67, 0x9c, 0x0c,
+  0x5c, 0x02, 0xf5, 0x2b, 0x33, 0xf0, 0x5d, 0x02, 0x3c, 0xa7, 0xb9, 0xc8, 0xa6, 0x3c, 0x44, 0x3e,
+  0xc0, 0xe2, 0xa7, 0x13, 0x12, 0x3c, 0xb0, 0xc9, 0xcd, 0x3a, 0x20, 0xad, 0x21, 0xce, 0x00, 0xf6,
+  0x60, 0x63, 0xc4, 0xcd, 0xa0, 0xd8, 0x8b, 0x59, 0xbd, 0x55, 0x05, 0x98, 0xce, 0x07, 0x4a, 0x6d,
+  0x5b, 0xd1, 0xd6, 0xb6, 0x77, 0x9d, 0xce, 0x6a, 0x76, 0xf5, 0x83, 0xb4, 0xcc, 0x31, 0x5c, 0x3d,
+  0x31, 0xd8, 0x27, 0xe4, 0xea, 0xa2, 0x04, 0xa0, 0x13, 0x49, 0x5f, 0xda, 0x60, 0x25, 0x2f, 0x98,
+  0x6c, 0xa1, 0x83, 0x52, 0x77, 0x9a, 0x96, 0xce, 0xde, 0xa7, 0xa9, 0x88, 0x8b, 0x44, 0xa4, 0x1a,
+  0x9c, 0x62, 0xc0, 0x55, 0x7e, 0x83, 0x56, 0x4f, 0x77, 0xe8, 0x34, 0x01, 0x54, 0x05, 0xa0, 0x81,
+  0x25, 0x8d, 0x5f, 0x3c, 0x58, 0x78, 0x2f, 0x61, 0x9b, 0xec, 0xbb, 0x2d, 0x5a, 0x90, 0x6c, 0x9c,
+  0xa2, 0xd1, 0x0e, 0xf5, 0xf8, 0xe5, 0xf7, 0xff, 0x99, 0x3a, 0x5b, 0x15, 0x31, 0x37, 0xd8, 0x4f,
+  0x93, 0xa0, 0x97, 0x0a, 0x0e, 0x19, 0x6e, 0x11, 0x28, 0x0e, 0x8c, 0xd3, 0x13, 0xef, 0xe9, 0x33,
+  0x98, 0x22, 0x9f, 0x6e, 0x0d, 0xeb, 0x87, 0xe6, 0x0f, 0x2a, 0x1a, 0xa0, 0xbb, 0x12, 0x52, 0xc0,
+  0xa9, 0x15, 0x75, 0x2c, 0x9e, 0xbb, 0x60, 0x5b, 0x70, 0xc4, 0x61, 0x54, 0xc5, 0x28, 0x5d, 0x46,
+  0x7c, 0x7a, 0xc6, 0x3e, 0x04, 0x59, 0x63, 0xb2, 0x01, 0x2a, 0x0f, 0x7f, 0x3f, 0xd9, 0x90, 0xbf,
+  0x9f, 0xd0, 0x6f, 0x50, 0x86, 0x1f, 0xe1, 0xc7, 0xc4, 0x55, 0xec, 0xf3, 0x1a, 0x3f, 0xc4, 0xa0,
+  0xea, 0x1c, 0x18, 0xbc, 0x5c, 0x1d, 0x6d, 0xc5, 0x26, 0xa9, 0xd7, 0x7e, 0xcc, 0x32, 0x3d, 0x00,
+  0x18, 0x68, 0xd4, 0xbb, 0x46, 0xc1, 0x36, 0xbf, 0x37, 0xb0, 0xcd, 0x62, 0xa2, 0xfd, 0xec, 0x18,
+  0xda, 0x94, 0x68, 0x26, 0xe4, 0x80, 0x0d, 0x7f, 0x37, 0x22, 0xa0, 0x5d, 0xcf, 0x2a, 0x95, 0x00,
+  0xf5, 0x5e, 0x91, 0x9e, 0x59, 0xba, 0x8c, 0x9a, 0x59, 0xba, 0x8c, 0x96, 0xb7, 0x69, 0x89, 0x12,
+  0x40, 0x0b, 0x78, 0x66, 0xa9, 0x4d, 0x05, 0x7c, 0x37, 0x69, 0x30, 0x9c, 0x5d, 0x7f, 0x48, 0x9b,
+  0x0f, 0xcd, 0x9c, 0xfc, 0xa6, 0x67, 0x76, 0xe1, 0xdc, 0x75, 0xa8, 0x31, 0xf4, 0x1f, 0xc0, 0x4a,
+  0x48, 0x0e, 0xce, 0x8e, 0x8f, 0x00, 0xcd, 0x49, 0xf7, 0x07, 0xf4, 0x7a, 0x2e, 0xf8, 0x75, 0xea,
+  0x0a, 0x6c, 0x1e, 0xcd, 0x12, 0x65, 0x2e, 0xe8, 0x75, 0x25, 0xfb, 0x26, 0xa7, 0x19, 0xdb, 0x7c,
+  0xc0, 0xea, 0x8f, 0x96, 0xbf, 0xe1, 0x6c, 0x67, 0xc9, 0xd3, 0xed, 0xac, 0xff, 0x94, 0x34, 0x65,
+  0x1e, 0xee, 0x17, 0x39, 0x20, 0x20, 0xc0, 0xdb, 0x2b, 0x50, 0xa9, 0x1a, 0xe8, 0x71, 0xa6, 0xb8,
+  0xdf, 0x95, 0xea, 0xb5, 0xe6, 0x80, 0x7f, 0x46, 0x53, 0xff, 0x72, 0xb8, 0x18, 0x95, 0x7f, 0x65,
+  0xd4, 0xaf, 0x00, 0x41, 0x22, 0x36, 0xa8, 0x44, 0xcd, 0xf1, 0x4c, 0x4e, 0x86, 0xf1, 0x0c, 0xac,
+  0x0f, 0x18, 0xd3, 0x6e, 0x92, 0xf8, 0xd7, 0xb0, 0x8d, 0xd3, 0x6f, 0x57, 0x30, 0x56, 0x54, 0xe2,
+  0x56, 0x6e, 0x7e, 0x87, 0xe9, 0xf8, 0xf0, 0x71, 0x39, 0xa3, 0x45, 0xe3, 0x02, 0xa7, 0x25, 0x0a,
+  0x99, 0x48, 0x23, 0x57, 0x8c, 0x2a, 0x44, 0x96, 0xd3, 0xa6, 0xe0, 0x6c, 0xf7, 0x83, 0x4b, 0x46,
+  0xca, 0x6b, 0xe7, 0x41, 0x18, 0x0f, 0xeb, 0xb0, 0x38, 0xc7, 0x0f, 0x8a, 0x03, 0x45, 0xcd, 0x83,
+  0x3a, 0xe1, 0xe7, 0xbf, 0xfa, 0x07, 0x56, 0xe0, 0x77, 0x2a, 0x84, 0xc2, 0x33, 0x98, 0xe8, 0x30,
+  0xb7, 0x00, 0x4f, 0x4d, 0xde, 0x08, 0x24, 0x1e, 0x6e, 0x7a, 0xcc, 0x68, 0x60, 0x18, 0x57, 0xc0,
+  0xf2, 0xec, 0x58, 0x58, 0x1c, 0xa8, 0x9f, 0x04, 0x6f, 0x81, 0xc0, 0xa7, 0x4e, 0xce, 0x52, 0xb5,
+  0x74, 0x89, 0x70, 0xf2, 0xf8, 0x76, 0x1e, 0x50, 0x5a, 0x53, 0x1b, 0xb3, 0x96, 0xdc, 0x7a, 0x7d,
+  0x0c, 0x16, 0x49, 0xbf, 0x8e, 0x42, 0xef, 0x6d, 0x41, 0x1f, 0x51, 0x56, 0x47, 0x4b, 0xb3, 0xcd,
+  0x5a, 0xab, 0x93, 0xab, 0xad, 0x07, 0x4f, 0x5f, 0xc5, 0xa0, 0x76, 0x2f, 0x78, 0x10, 0x71, 0xf6,
+  0x02, 0xd7, 0x91, 0xec, 0xa0, 0x62, 0x83, 0x55, 0x9a, 0xae, 0xbc, 0xc7, 0x8e, 0x45, 0xcd, 0xdd,
+  0x77, 0x59, 0x4b, 0x75, 0x56, 0xed, 0x27, 0x85, 0xcd, 0x41, 0xb6, 0x14, 0x9d, 0xda, 0x9b, 0x84,
+  0xd8, 0x1d, 0x30, 0x07, 0x01, 0x29, 0x91, 0x67, 0xab, 0xcc, 0xa5, 0x6d, 0x4b, 0x1e, 0xa6, 0x36,
+  0x46, 0x5e, 0x9b, 0x1d, 0x70, 0x1f, 0x77, 0xd4, 0xd5, 0x26, 0x7b, 0x5e, 0x63, 0x3f, 0x70, 0xcc,
+  0xe7, 0x99, 0x80, 0xf3, 0x14, 0xf7, 0x7a, 0xec, 0x37, 0xea, 0x64, 0x1d, 0x3e, 0xdd, 0xc4, 0x11,
+  0x4f, 0xf3, 0x81, 0x8b, 0xb4, 0x26, 0x89, 0xc7, 0xed, 0x4e, 0x07, 0x03, 0x9e, 0xd4, 0x44, 0x23,
+  0x81, 0xd0, 0x54, 0xf9, 0x97, 0x01, 0x9f, 0xc9, 0xb3, 0x77, 0x34, 0x46, 0xbe, 0x87, 0xaf, 0x12,
+  0x44, 0xbb, 0xab, 0xd8, 0xa4, 0xd1, 0xbd, 0xce, 0xf8, 0x91, 0xc8, 0xe7, 0xda, 0x06, 0x82, 0xf4,
+  0x2e, 0xa5, 0x42, 0xa5, 0x2a, 0xef, 0x69, 0x18, 0xf4, 0x00, 0x9d, 0xb0, 0x05, 0x1b, 0x83, 0x24,
+  0x1e, 0xe3, 0x99, 0xfb, 0x1e, 0xd0, 0x23, 0xd0, 0x00, 0xc5, 0x6f, 0xc0, 0x05, 0x7d, 0xec, 0x36,
+  0xbd, 0x1a, 0xb3, 0x4b, 0x5a, 0xa5, 0x92, 0xd5, 0x52, 0xc9, 0x5a, 0xee, 0x44, 0x8b, 0xae, 0x68,
+  0xe7, 0x3c, 0x3d, 0xe8, 0x9c, 0x51, 0x34, 0xd6, 0x6e, 0xbc, 0xee, 0x51, 0x75, 0x6b, 0x0e, 0xad,
+  0x29, 0x31, 0xb3, 0x03, 0x72, 0x85, 0x99, 0x6c, 0x16, 0xe4, 0x86, 0x61, 0x2a, 0xf7, 0xa4, 0xd9,
+  0x62, 0xb6, 0x58, 0x5b, 0x75, 0x5b, 0x60, 0xdc, 0xa2, 0x1b, 0xa5, 0xe9, 0x31, 0xd0, 0x6d, 0xb3,
+  0x35, 0x4d, 0x4d, 0x81, 0x6f, 0x74, 0xd4, 0x89, 0x08, 0x1f, 0x1a, 0xfd, 0x97, 0x08, 0x94, 0x5f,
+  0x95, 0x7f, 0x01, 0xb6, 0xa4, 0xd9, 0x7b, 0x6b, 0xd3, 0xdd, 0x94, 0x9d, 0xd7, 0xa8, 0xc5, 0x20,
+  0x48, 0xd2, 0xac, 0xc3, 0x7b, 0xed, 0x22, 0x91, 0x8f, 0xad, 0x66, 0xd4, 0x71, 0x5b, 0xfc, 0x12,
+  0x25, 0x51, 0x3c, 0xab, 0x02, 0x6b, 0xd9, 0xe8, 0x73, 0x42, 0xdb, 0xc6, 0x67, 0xb3, 0x0e, 0x08,
+  0xa4, 0x1c, 0x17, 0x64, 0x9e, 0xd0, 0x88, 0x4a, 0xea, 0x56, 0x61, 0x67, 0xaf, 0x18, 0xb0, 0x00,
+  0x26, 0x91, 0x6c, 0x33, 0xd7, 0x10, 0x4d, 0x4a, 0x7d, 0x01, 0x4d, 0x91, 0x4e, 0xc2, 0x00, 0x4c,
+  0xec, 0x9a, 0x23, 0x9b, 0x26, 0xbc, 0xc7, 0xc1, 0x4a, 0xed, 0xef, 0xc2, 0x00, 0x70, 0xc9, 0x37,
+  0x80, 0x74, 0xd7, 0x13, 0x5e, 0x61, 0xd9, 0xd0, 0xda, 0x0b, 0xe3, 0xde, 0x85, 0x3b, 0xb6, 0x52,
+  0xf2, 0xfa, 0xb9, 0x94, 0x73, 0xac, 0x32, 0xf8, 0xdc, 0xc7, 0xb1, 0x1f, 0xa0, 0xbf, 0xe3, 0x7a,
+  0x8b, 0x1c, 0x19, 0xed, 0xf1, 0x10, 0x80, 0xf4, 0x9b, 0x16, 0x83, 0xd8, 0xd4, 0xa1, 0x47, 0xac,
+  0xd6, 0xa5, 0x11, 0xb6, 0x34, 0xf2, 0x50, 0x30, 0x74, 0x69, 0xa4, 0x54, 0x98, 0x4e, 0xbc, 0xf4,
+  0xfb, 0xa4, 0x31, 0x2c, 0x1b, 0x18, 0xa6, 0xc6, 0xe2, 0xb0, 0x56, 0x29, 0x9d, 0xa5, 0x2a, 0xe8,
+  0x69, 0x46, 0x32, 0x0b, 0x11, 0xbc, 0xd6, 0xa6, 0xe1, 0x7c, 0x7e, 0x56, 0xf4, 0x0d, 0x87, 0x68,
+  0xf7, 0x9e, 0x07, 0xbe, 0x16, 0xc7, 0xdd, 0x10, 0x85, 0x0d, 0x69, 0x04, 0xc4, 0x96, 0x05, 0xdb,
+  0xe4, 0xea, 0xa9, 0xea, 0x79, 0x59, 0xbf, 0x5b, 0x15, 0x90, 0x55, 0xa1, 0xcc, 0xaa, 0x7e, 0x95,
+  0xf7, 0x9f, 0xcf, 0xe9, 0x17, 0x06, 0xd6, 0xa4, 0xe9, 0x06, 0x7b, 0x23, 0xda, 0x50, 0xe4, 0x20,
+  0x8d, 0x27, 0xb8, 0x2d, 0x76, 0xb0, 0xcc, 0xb5, 0x0e, 0x10, 0x8d, 0x09, 0x0b, 0x71, 0x13, 0xde,
+  0xc3, 0xbd, 0x94, 0xf2, 0x73, 0xf3, 0x14, 0x60, 0x81, 0x0a, 0x67, 0xfe, 0x75, 0x12, 0x4f, 0xc0,
+  0x81, 0xbd, 0xfe, 0x1e, 0x93, 0x27, 0x5c, 0xa7, 0x5e, 0x17, 0xa1, 0xb8, 0x3a, 0x81, 0x8a, 0xf4,
+  0x62, 0x58, 0x76, 0x98, 0x5a, 0xe4, 0x7f, 0xe3, 0x3f, 0xf6, 0x1d, 0x03, 0xfb, 0x30, 0x09, 0xfa,
+  0x5f, 0x86, 0x1c, 0x21, 0x4d, 0xdc, 0xab, 0xfe, 0x9a, 0xbf, 0x2e, 0x71, 0x1b, 0xbc, 0xea, 0x85,
+  0xdc, 0x4f, 0x48, 0x18, 0x05, 0x73, 0x68, 0x76, 0x6a, 0x52, 0x0c, 0x4d, 0xce, 0xc8, 0x7c, 0x95,
+  0x5f, 0xa1, 0xea, 0xc0, 0x4c, 0x29, 0x32, 0xb1, 0x46, 0x0d, 0x52, 0x25, 0x0d, 0xe0, 0xf4, 0xbe,
+  0x0f, 0x1b, 0xb3, 0x4c, 0xd2, 0xed, 0x06, 0xf2, 0x50, 0x91, 0x64, 0x51, 0x58, 0x97, 0x26, 0x7c,
+  0x63, 0x32, 0x4d, 0x47, 0xee, 0x27, 0x4a, 0xbd, 0x6d, 0x33, 0x0d, 0xd3, 0xc6, 0x1f, 0xe8, 0xca,
+  0xc9, 0x33, 0x08, 0x19, 0x2d, 0xbb, 0x0a, 0xd2, 0x03, 0x5a, 0x10, 0x79, 0x19, 0xf6, 0x7a, 0x1a,
+  0xcf, 0x28, 0xab, 0xd5, 0x58, 0x25, 0x61, 0x9c, 0x1d, 0xe4, 0x31, 0xec, 0xba, 0x04, 0xad, 0xdb,
+  0x7d, 0xcb, 0x24, 0xe9, 0x87, 0x42, 0x0d, 0x12, 0x96, 0x47, 0x6c, 0xd5, 0x83, 0x66, 0xeb, 0x5b,
+  0xa6, 0x09, 0x9f, 0xa0, 0x86, 0x47, 0x6c, 0x0d, 0xa1, 0xb5, 0xa1, 0x81, 0x91, 0xac, 0x95, 0x37,
+  0xbd, 0x3a, 0x19, 0x60, 0x08, 0x2f, 0xe5, 0x3d, 0x1a, 0x33, 0x7e, 0x80, 0xa6, 0x0a, 0x81, 0x07,
+  0x86, 0x99, 0x99, 0xe3, 0xf5, 0xd0, 0x88, 0xd9, 0x1a, 0xbb, 0xe2, 0xdb, 0x82, 0x22, 0x01, 0x89,
+  0xa7, 0x28, 0x52, 0x05, 0xa8, 0x98, 0x14, 0x53, 0xdc, 0xb3, 0x24, 0xbe, 0xe0, 0x24, 0xa5, 0x28,
+  0xb8, 0x4a, 0x62, 0x0a, 0x13, 0x1d, 0x02, 0x07, 0x54, 0xd8, 0x98, 0xd4, 0x04, 0xcc, 0x19, 0x73,
+  0xf1, 0xc4, 0xe5, 0x82, 0x4a, 0xe0, 0xd7, 0xf6, 0x0e, 0x5b, 0x83, 0xdf, 0x8f, 0x1e, 0xd9, 0xc9,
+  0x02, 0x98, 0x67, 0x26, 0x58, 0x5b, 0x87, 0x46, 0x2b, 0xb0, 0xd7, 0x3e, 0x94, 0xdf, 0x1f, 0xb1,
+  0x66, 0x63, 0xc3, 0x5e, 0xbc, 0xd0, 0x53, 0x97, 0x0f, 0x83, 0xe8, 0x35, 0x0c, 0xc6, 0xf5, 0x4a,
+  0x75, 0xe3, 0xf8, 0x92, 0x9f, 0xc5, 0x28, 0x6b, 0xd7, 0xe5, 0x4a, 0x24, 0x11, 0x2a, 0xa5, 0x08,
+  0x56, 0x34, 0x10, 0x23, 0x75, 0x3d, 0x2b, 0x55, 0x02, 0x95, 0xf3, 0x49, 0xaf, 0x37, 0x9d, 0x04,
+  0xb0, 0x54, 0x69, 0xc6, 0xea, 0xf6, 0xf8, 0x02, 0x4a, 0x8e, 0x84, 0x5f, 0xdb, 0xc0, 0x56, 0xda,
+  0x1b, 0xe1, 0x4b, 0x71, 0x90, 0x68, 0xe2, 0xe1, 0x5c, 0xcb, 0xfd, 0xf5, 0x43, 0x00, 0x83, 0x54,
+  0xdf, 0x70, 0x07, 0x95, 0x8e, 0x94, 0x8c, 0x31, 0xea, 0x30, 0xc9, 0x7c, 0x00, 0x60, 0x4e, 0xcb,
+  0x02, 0xba, 0x91, 0x2b, 0x67, 0x21, 0xc8, 0xaa, 0x05, 0x92, 0x4a, 0x01, 0x54, 0xf6, 0x06, 0x34,
+  0x10, 0x30, 0x20, 0x1c, 0x66, 0x3b, 0x4c, 0xa7, 0x04, 0x31, 0x24, 0x19, 0xdc, 0xd2, 0x51, 0xe4,
+  0x2b, 0x68, 0xae, 0xa4, 0x6b, 0x1b, 0xd4, 0x1c, 0x36, 0xce, 0x60, 0x0f, 0xe5, 0x79, 0x13, 0x3d,
+  0x10, 0xd0, 0xef, 0xcd, 0xab, 0x97, 0x2f, 0xf3, 0x00, 0x14, 0xd8, 0xca, 0xc2, 0xde, 0x17, 0x09,
+  0xe6, 0x14, 0xf6, 0x4d, 0x65, 0x9d, 0x31, 0x23, 0x83, 0x20, 0x0c, 0x95, 0xe4, 0x39, 0xc9, 0xb0,
+  0xeb, 0x83, 0x9d, 0x06, 0x46, 0x50, 0xfe, 0xa3, 0xd9, 0x58, 0xdd, 0xf0, 0x74, 0x38, 0xa7, 0x00,
+  0x49, 0x7a, 0xe7, 0x8a, 0xf4, 0x8e, 0x24, 0xb4, 0x26, 0x24, 0xcb, 0x33, 0xe2, 0x3f, 0x06, 0xc9,
+  0x79, 0x72, 0x00, 0x4c, 0x97, 0x57, 0x31, 0xf3, 0x29, 0xf1, 0xc8, 0xe0, 0xcf, 0x42, 0x52, 0x37,
+  0xc0, 0x66, 0x68, 0x61, 0xe8, 0xe3, 0xf1, 0x13, 0x24, 0x74, 0x43, 0x13, 0x3a, 0x87, 0x4c, 0xb5,
+  0x08, 0x50, 0x56, 0x56, 0xd8, 0xea, 0xc6, 0x86, 0x5a, 0x08, 0x06, 0xf9, 0xa5, 0x3a, 0xaf, 0xc4,
+  0xed, 0x9c, 0xc9, 0xf3, 0xa8, 0xfb, 0x6a, 0x30, 0xd8, 0x5c, 0xdf, 0x5c, 0x5f, 0xc6, 0x36, 0x45,
+  0x8f, 0x9a, 0x45, 0x73, 0x69, 0xd6, 0x59, 0xcb, 0xa0, 0x6a, 0xd5, 0x33, 0x19, 0x68, 0xa9, 0x43,
+  0xad, 0xba, 0x6f, 0x6a, 0x2c, 0x89, 0x67, 0xf6, 0x01, 0x38, 0x1a, 0x4b, 0xc2, 0x5a, 0x64, 0x5f,
+  0x33, 0xb7, 0xc5, 0xb6, 0xb7, 0xd9, 0x4d, 0x03, 0xb5, 0xbb, 0x67, 0x1a, 0x4a, 0x0b, 0x86, 0x52,
+  0x91, 0x66, 0xfb, 0x81, 0x30, 0xb0, 0x3f, 0xad, 0xaa, 0x93, 0xca, 0xf9, 0xe3, 0x9d, 0x06, 0xfe,
+  0x88, 0xad, 0xc3, 0xff, 0x40, 0x73, 0x49, 0x97, 0x1b, 0x23, 0x57, 0xe5, 0x46, 0x9c, 0x50, 0xea,
+  0x0e, 0x90, 0xf0, 0x5f, 0xf1, 0x20, 0x83, 0xb1, 0x63, 0xce, 0x44, 0xc4, 0xc2, 0xf8, 0x02, 0xe3,
+  0xcc, 0xec, 0xcd, 0x28, 0xb9, 0x81, 0x72, 0xe6, 0x0a, 0x27, 0x9b, 0x52, 0xa1, 0x7f, 0xe0, 0xd9,
+  0x0d, 0x05, 0xf1, 0xa7, 0x29, 0xdb, 0xed, 0xa6, 0x98, 0x30, 0xef, 0xdd, 0x9b, 0x3b, 0xe8, 0xdc,
+  0x24, 0x28, 0xe8, 0x60, 0x74, 0xac, 0x71, 0x7e, 0x5b, 0xad, 0xc9, 0x15, 0x1b, 0xc7, 0x51, 0x9c,
+  0x4e, 0xfc, 0x9e, 0xc8, 0xd4, 0xb3, 0xb4, 0x71, 0x53, 0x6a, 0xe3, 0xf5, 0x0a, 0x6d, 0x2c, 0x74,
+  0x82, 0xde, 0x9f, 0x1e, 0x91, 0x4a, 0xc6, 0x4b, 0x2e, 0x85, 0xcd, 0xc9, 0xea, 0x18, 0x1d, 0xfb,
+  0xdd, 0x30, 0x18, 0x62, 0x8e, 0xf1, 0x85, 0x58, 0xed, 0x98, 0x6f, 0x10, 0xf2, 0x01, 0x65, 0xe9,
+  0xb9, 0xa2, 0x6c, 0x1d, 0xcb, 0x12, 0x91, 0x6a, 0xd3, 0x66, 0x8e, 0x38, 0xb4, 0x73, 0xbc, 0xca,
+  0x35, 0x71, 0x86, 0xc7, 0x01, 0xa6, 0xf1, 0x8f, 0x8b, 0x4e, 0xb9, 0x0c, 0x20, 0x7d, 0xae, 0xb1,
+  0x6d, 0xd2, 0xd6, 0xf8, 0x50, 0x84, 0x4f, 0x6b, 0x9a, 0x5e, 0xcb, 0xd2, 0x80, 0x56, 0x6b, 0xf9,
+  0xd4, 0x2c, 0x4b, 0x2b, 0x3f, 0x8c, 0x06, 0x71, 0x29, 0x46, 0x57, 0xd4, 0x06, 0xa0, 0xf2, 0x64,
+  0x00, 0xc7, 0x09, 0xc6, 0x34, 0xd5, 0x89, 0x3f, 0x1d, 0xb3, 0x28, 0xe8, 0x41, 0x77, 0x30, 0x41,
+  0x7c, 0x98, 0x39, 0x2a, 0x2e, 0x72, 0x33, 0x0d, 0x69, 0x86, 0x45, 0x71, 0xdb, 0x88, 0xb4, 0x2c,
+  0x1d, 0x9c, 0x3e, 0x0f, 0x2a, 0xf4, 0x5f, 0xd3, 0x86, 0x83, 0xa7, 0x07, 0xbf, 0x75, 0x87, 0xb1,
+  0x1d, 0xf1, 0x21, 0x8f, 0xfa, 0x76, 0x5c, 0x8a, 0xc8, 0x74, 0xb6, 0x53, 0xb4, 0x02, 0xac, 0xe8,
+  0xcd, 0x57, 0x6b, 0xeb, 0xbd, 0x6f, 0x36, 0x9e, 0x3c, 0x78, 0xfa, 0xf3, 0x3f, 0xfe, 0x1b, 0x7b,
+  0x8e, 0xc4, 0x4f, 0xa3, 0xe1, 0xf6, 0x0a, 0x36, 0x7c, 0x5a, 0xd5, 0x5c, 0xe8, 0x15, 0x6c, 0xfe,
+  0x1f, 0x78, 0x6f, 0xa9, 0xa1, 0x8e, 0x18, 0x24, 0x88, 0x8a, 0xea, 0x59, 0x0a, 0x02, 0xc3, 0x5e,
+  0x37, 0x22, 0xec, 0x55, 0xc6, 0x88, 0x8c, 0xfa, 0xc2, 0x35, 0x8e, 0xce, 0x9d, 0x20, 0x3c, 0x0f,
+  0x26, 0x1a, 0x31, 0xb2, 0x9b, 0x86, 0x11, 0x95, 0x14, 0xd4, 0x99, 0x21, 0xc2, 0x52, 0xe0, 0xc9,
+  0x76, 0xf3, 0xcc, 0xc0, 0x93, 0x64, 0xec, 0x33, 0xd8, 0x14, 0xe8, 0x8c, 0xcb, 0x48, 0xc3, 0x07,
+  0xe4, 0x5f, 0x63, 0xcc, 0x64, 0xa7, 0x6e, 0x54, 0xe0, 0x0a, 0xaa, 0x08, 0x52, 0xd9, 0x99, 0x85,
+  0x6a, 0x37, 0xc7, 0xd0, 0xd5, 0x88, 0x3c, 0xe9, 0x54, 0xdc, 0x28, 0x79, 0x57, 0x27, 0xb6, 0x39,
+  0xde, 0x96, 0x95, 0x96, 0x46, 0x0d, 0x7d, 0x74, 0xd5, 0x9f, 0x93, 0xa7, 0x8e, 0x5e, 0x2c, 0x22,
+  0x07, 0xbf, 0x1d, 0x91, 0x97, 0x42, 0x48, 0x32, 0x7e, 0xe4, 0x15, 0xce, 0x53, 0x08, 0x66, 0x54,
+  0xd2, 0xd1, 0xa3, 0xa2, 0x3a, 0xb6, 0x6f, 0x09, 0x8c, 0x54, 0xb1, 0xe5, 0x0f, 0x2f, 0x38, 0xa9,
+  0x29, 0x44, 0xd6, 0x14, 0xa6, 0xb9, 0x91, 0x35, 0x2b, 0x09, 0x6c, 0xa1, 0xc3, 0x5d, 0x76, 0xb0,
+  0xbb, 0xd3, 0x2c, 0x8b, 0x23, 0xeb, 0x36, 0xc9, 0x8f, 0x98, 0x8c, 0xd6, 0x01, 0x71, 0xee, 0x01,
+  0xd4, 0x6e, 0x18, 0xba, 0x4e, 0x43, 0x62, 0xa8, 0xa3, 0x41, 0x90, 0xc4, 0x61, 0x2a, 0xc1, 0x04,
+  0x9b, 0x25, 0x0a, 0xbd, 0x97, 0x75, 0xb3, 0x28, 0x67, 0x11, 0x7c, 0xb9, 0x73, 0xc6, 0x57, 0x09,
+  0x11, 0x56, 0x76, 0x17, 0x25, 0x2b, 0x77, 0x49, 0x73, 0x42, 0x1f, 0x9e, 0x57, 0xd8, 0xb4, 0xc4,
+  0x35, 0x0f, 0x7d, 0x27, 0x09, 0xc9, 0xc0, 0x83, 0x08, 0x70, 0x4e, 0xd1, 0x3c, 0xa1, 0xbb, 0x46,
+  0x05, 0x08, 0x79, 0x09, 0xa4, 0x12, 0x04, 0x57, 0x80, 0x05, 0x63, 0x78, 0xf9, 0x74, 0x49, 0x04,
+  0xcc, 0x3b, 0x74, 0xe5, 0x0e, 0x51, 0x67, 0x5f, 0xfa, 0xa1, 0x5d, 0x57, 0xe8, 0x48, 0xdd, 0x2a,
+  0xc1, 0xac, 0x54, 0xd5, 0xde, 0x5c, 0x44, 0xb5, 0x8a, 0xfb, 0x35, 0x1f, 0xf2, 0x61, 0x7d, 0xd4,
+  0xf8, 0xec, 0x95, 0x67, 0x6d, 0xb1, 0xf4, 0xb3, 0x5c, 0xff, 0xc7, 0xa3, 0xc0, 0x3a, 0xe3, 0xc6,
+  0xed, 0x50, 0x5e, 0x5c, 0xd3, 0x3e, 0xb2, 0x91, 0x63, 0x60, 0x5e, 0xcd, 0xb3, 0xd2, 0xda, 0x31,
+  0x8e, 0x58, 0xb8, 0x85, 0xa7, 0xb7, 0x5b, 0x8b, 0x9d, 0xa5, 0x56, 0x62, 0xb0, 0x73, 0xaf, 0xf0,
+  0x09, 0x5b, 0xcb, 0x38, 0x73, 0x26, 0x76, 0x14, 0xae, 0x08, 0x96, 0x46, 0x8f, 0x4d, 0x6b, 0xf9,
+  0x5e, 0x21, 0x22, 0xe0, 0x47, 0x20, 0x69, 0x9d, 0x2c, 0xe1, 0xfe, 0x58, 0x27, 0x17, 0x96, 0xc6,
+  0xde, 0xc9, 0xe9, 0x30, 0xc6, 0xfd, 0x07, 0x0c, 0x0d, 0xa9, 0xaf, 0x18, 0x9c, 0x49, 0x71, 0x31,
+  0x6b, 0xe5, 0xbe, 0x71, 0xcf, 0xd1, 0xd6, 0x47, 0x58, 0x9b, 0x07, 0x11, 0x61, 0xd3, 0x2c, 0x5c,
+  0x6e, 0x7c, 0x6a, 0xdd, 0x69, 0xf4, 0x2c, 0x55, 0x8b, 0x6a, 0x68, 0xe6, 0x27, 0xa0, 0xf6, 0xa1,
+  0x0d, 0x0e, 0x36, 0xe4, 0x35, 0x8c, 0x4e, 0x8a, 0xa3, 0x62, 0xca, 0x0b, 0x51, 0xd2, 0x68, 0xf4,
+  0x0f, 0x4b, 0x36, 0x4e, 0xb9, 0x5b, 0x55, 0x65, 0xa5, 0x1b, 0x33, 0x1c, 0x11, 0x0e, 0x2e, 0x9e,
+  0x66, 0xe0, 0x3e, 0x65, 0xd3, 0xc9, 0x29, 0xf7, 0x43, 0xb4, 0xfb, 0x6a, 0x6c, 0xa3, 0xd9, 0x34,
+  0xb3, 0x61, 0x6a, 0x74, 0xd1, 0xcf, 0xab, 0x3a, 0xde, 0x2d, 0xcd, 0x90, 0x11, 0x06, 0xe5, 0x0b,
+  0xef, 0xdd, 0x87, 0x1a, 0xd2, 0xd1, 0x81, 0xed, 0xfb, 0x3c, 0x2c, 0xca, 0xa8, 0x4a, 0x1a, 0xf0,
+  0x00, 0x5d, 0xc1, 0xec, 0x71, 0xde, 0xf2, 0xae, 0xbc, 0x72, 0x88, 0x7b, 0x98, 0xab, 0x6f, 0x04,
+  0x3e, 0xcb, 0x2f, 0x07, 0xe2, 0x31, 0xd4, 0xc1, 0x0d, 0x19, 0x75, 0x6e, 0x7e, 0xdb, 0xd2, 0x13,
+  0x5d, 0xea, 0x9c, 0x61, 0x6b, 0xfa, 0xca, 0xfd, 0x00, 0xfb, 0x1d, 0xab, 0x7d, 0x61, 0x55, 0x95,
+  0x21, 0xe4, 0x82, 0xcc, 0xa1, 0xca, 0x4d, 0xea, 0x8e, 0x3a, 0x99, 0x21, 0x3f, 0xf3, 0x79, 0x10,
+  0xf9, 0xb0, 0xcf, 0x5c, 0xb6, 0xe4, 0xd9, 0x8c, 0xf8, 0x6e, 0x1e, 0xcd, 0xb4, 0xd4, 0xd1, 0x8c,
+  0xb0, 0x5c, 0xc0, 0xc9, 0xc4, 0xef, 0x61, 0x90, 0x65, 0x60, 0x7a, 0x63, 0x62, 0x94, 0x1f, 0x35,
+  0x10, 0xdd, 0x6e, 0x77, 0x08, 0xfb, 0x47, 0x90, 0xf1, 0x8c, 0xb3, 0x97, 0x3c, 0x44, 0xd0, 0x59,
+  0xc0, 0xd9, 0x28, 0x4e, 0x33, 0x91, 0xed, 0x71, 0xde, 0x0d, 0xa2, 0xc6, 0xe4, 0xba, 0x51, 0x3c,
+  0xc6, 0x31, 0xfa, 0x55, 0xe7, 0x32, 0x7f, 0xe8, 0xe9, 0x0d, 0xd0, 0x5c, 0x3a, 0x2b, 0x69, 0x2e,
+  0x3e, 0x2b, 0xa9, 0x3a, 0x04, 0xc1, 0x13, 0x1b, 0x9d, 0xd1, 0x48, 0xf5, 0x4f, 0xab, 0xcf, 0x3d,
+  0x08, 0xb1, 0x79, 0xf2, 0xd1, 0x5a, 0x9d, 0xd3, 0x4d, 0x1e, 0xc8, 0x10, 0xf1, 0x3c, 0x3b, 0x66,
+  0x02, 0x8e, 0x96, 0xb8, 0xbd, 0x4b, 0xb1, 0x93, 0x3c, 0x72, 0x82, 0xe5, 0x8f, 0x76, 0x08, 0xeb,
+  0xa7, 0x42, 0x14, 0x42, 0xd1, 0x7b, 0x48, 0xa7, 0x26, 0x13, 0xf4, 0xc6, 0x8c, 0x63, 0x1b, 0x33,
+  0xa2, 0x54, 0x6e, 0xb9, 0x5e, 0xd1, 0x32, 0x0d, 0x86, 0x63, 0xbf, 0xc0, 0x07, 0xd9, 0xbc, 0xd5,
+  0xac, 0x68, 0x9f, 0xc9, 0x5b, 0x8f, 0xa4, 0x75, 0xfa, 0xa5, 0x63, 0x9c, 0x89, 0x75, 0xce, 0xc2,
+  0xd8, 0x55, 0x9b, 0x5d, 0xa9, 0xcf, 0xd7, 0x6d, 0x76, 0xad, 0x3e, 0xa7, 0x13, 0xce, 0x01, 0xda,
+  0x08, 0x3d, 0x97, 0xc9, 0x55, 0x67, 0x36, 0x94, 0x18, 0x02, 0x7e, 0x0d, 0x79, 0x94, 0xbd, 0xf1,
+  0x4a, 0x4a, 0x82, 0x06, 0x2e, 0xc7, 0x9f, 0x75, 0x4e, 0x5e, 0x29, 0xbb, 0x2b, 0xc0, 0x6c, 0x9a,
+  0x59, 0xbb, 0x6a, 0x1c, 0x8f, 0x0b, 0x34, 0x61, 0x5b, 0x3f, 0xea, 0x71, 0xab, 0x7b, 0xfa, 0x38,
+  0xba, 0x9e, 0xc4, 0xe4, 0xff, 0x5e, 0x7b, 0xba, 0xb5, 0x1f, 0x81, 0x3d, 0xf2, 0x82, 0x0f, 0xcb,
+  0xad, 0x41, 0x3c, 0xa3, 0x55, 0x17, 0x76, 0xd2, 0x2b, 0xf2, 0x3f, 0x1e, 0x37, 0xd9, 0x8a, 0x68,
+  0xf3, 0xfa, 0x50, 0x98, 0x7c, 0xb7, 0xb9, 0x72, 0x26, 0x36, 0x7b, 0x0c, 0xcc, 0x0c, 0xc9, 0x6f,
+  0xfa, 0x2d, 0x2f, 0x7f, 0x08, 0x19, 0x11, 0x31, 0xdb, 0x4c, 0x6f, 0x0e, 0xea, 0xc8, 0x8c, 0x0d,
+  0x12, 0x8a, 0xe2, 0x16, 0x8e, 0xb4, 0xd4, 0xb4, 0xc3, 0x2f, 0x50, 0x0f, 0xc7, 0x69, 0xa9, 0xc1,
+  0x66, 0xde, 0x20, 0x4f, 0x47, 0x52, 0x87, 0x65, 0xaa, 0xd3, 0xb6, 0x96, 0xd0, 0xdb, 0x62, 0x4a,
+  0x68, 0x2f, 0x4e, 0xfa, 0x67, 0x74, 0x93, 0xd9, 0x8e, 0xab, 0xc8, 0x8b, 0x3f, 0x31, 0x2e, 0xd3,
+  0x7c, 0xcf, 0x41, 0xaa, 0x75, 0xb4, 0x0b, 0x96, 0xcc, 0x87, 0x8f, 0x9e, 0x36, 0xf2, 0x32, 0xfb,
+  0xfe, 0xcb, 0x04, 0x7c, 0x0c, 0x5a, 0x12, 0xe2, 0x9e, 0x34, 0x59, 0xf5, 0x59, 0x23, 0xe8, 0x1b,
+  0x81, 0x9c, 0xfb, 0xa2, 0x8d, 0x71, 0x91, 0x42, 0xc1, 0x7c, 0xf8, 0x98, 0x5f, 0x06, 0x22, 0xe8,
+  0x54, 0x42, 0xd7, 0x64, 0x1b, 0x2b, 0x10, 0x23, 0x8a, 0x54, 0x34, 0x1c, 0x84, 0x31, 0x6b, 0xe0,
+  0xec, 0xe2, 0x6f, 0xba, 0x77, 0xdd, 0xa6, 0x71, 0x98, 0x06, 0x95, 0xc4, 0xaa, 0x83, 0x36, 0x02,
+  0x43, 0x0d, 0x64, 0xdd, 0xd8, 0x8c, 0x67, 0xa3, 0x00, 0x94, 0xa1, 0xac, 0x53, 0xf1, 0xee, 0xaf,
+  0xbf, 0x26, 0x64, 0x75, 0xd9, 0xe9, 0x87, 0xe6, 0x47, 0x90, 0x10, 0xd0, 0x20, 0xea, 0x22, 0xbb,
+  0xa7, 0xa8, 0x49, 0x47, 0xc1, 0x20, 0x73, 0xcb, 0xa3, 0x95, 0x88, 0x3c, 0x45, 0x43, 0x1f, 0xf4,
+  0x6b, 0xc6, 0x5d, 0xc9, 0x98, 0xdb, 0x8a, 0x93, 0x37, 0x39, 0x3d, 0xcb, 0xe6, 0xa5, 0x57, 0x88,
+  0x4e, 0x9b, 0x71, 0xf0, 0xd5, 0x3c, 0x45, 0xb8, 0x6a, 0xfc, 0x8a, 0xef, 0x6a, 0xe4, 0x96, 0xfe,
+  0x6a, 0x09, 0xbd, 0x65, 0x51, 0x6f, 0x45, 0x7e, 0xf5, 0x09, 0x03, 0x1a, 0xdd, 0x82, 0x2b, 0x01,
+  0x06, 0xce, 0x3e, 0x6e, 0x59, 0xd5, 0x5d, 0xa3, 0xba, 0x50, 0xe5, 0x87, 0x93, 0x91, 0x6f, 0x92,
+  0x0c, 0x3a, 0xa9, 0x85, 0x01, 0x02, 0xc1, 0xea, 0x2e, 0xb0, 0x18, 0xf5, 0x43, 0xce, 0xe3, 0x87,
+  0xac, 0xd9, 0xd8, 0xd4, 0x38, 0x4a, 0xc1, 0x7b, 0x11, 0x97, 0x5c, 0xdd, 0xd8, 0x20, 0x23, 0x50,
+  0xfe, 0xc0, 0x6d, 0x9d, 0x3a, 0xd2, 0xa9, 0x67, 0xab, 0x22, 0x29, 0xc4, 0x31, 0x11, 0x95, 0xa2,
+  0xee, 0xa2, 0x58, 0x06, 0xdc, 0x55, 0x96, 0xf6, 0x23, 0x75, 0x3d, 0x46, 0xdd, 0x39, 0xa9, 0xfb,
+  0x8d, 0x2b, 0xb0, 0x0b, 0xe0, 0xa7, 0x27, 0x33, 0xdc, 0x1a, 0x4d, 0x75, 0xc0, 0xa6, 0x33, 0xc1,
+  0x6b, 0x3a, 0x81, 0x1b, 0x28, 0x69, 0x5c, 0xcf, 0x6f, 0x68, 0x75, 0x2d, 0xc3, 0xf9, 0xf3, 0xbb,
+  0xee, 0x52, 0xd7, 0xdd, 0x3b, 0x77, 0xdd, 0xbd, 0x73, 0xd7, 0xe6, 0x41, 0x81, 0x34, 0xdf, 0x74,
+  0x0a, 0xc8, 0x2b, 0x3e, 0xe5, 0x3a, 0xb5, 0x12, 0x5f, 0xbd, 0x40, 0xbb, 0x32, 0xee, 0x8b, 0x47,
+  0x17, 0xda, 0x6c, 0xf4, 0xd3, 0x7f, 0xf5, 0x46, 0xe8, 0x25, 0xa6, 0xf8, 0x28, 0xcb, 0xd8, 0x0f,
+  0xd9, 0x24, 0x89, 0xd9, 0xf3, 0x20, 0xec, 0xa7, 0xbd, 0x51, 0x90, 0x8c, 0x45, 0x28, 0x9c, 0xdd,
+  0xe0, 0x8b, 0x2b, 0x11, 0x8f, 0x8a, 0x77, 0x8f, 0x05, 0x5e, 0xd7, 0xd0, 0x69, 0x5a, 0x99, 0x19,
+  0xfe, 0x70, 0x39, 0xf1, 0x33, 0xb7, 0xf7, 0x16, 0xa5, 0x6b, 0xa2, 0x56, 0xb2, 0x93, 0x37, 0xe7,
+  0xe5, 0x69, 0xea, 0x96, 0xa9, 0x38, 0x77, 0xaf, 0x50, 0x97, 0xfa, 0x16, 0x72, 0xe9, 0xc5, 0x08,
+  0x93, 0x9c, 0xca, 0xf7, 0x24, 0x54, 0x3e, 0x7b, 0x75, 0x76, 0xb8, 0xe9, 0x18, 0x2c, 0x7a, 0x8e,
+  0x22, 0xcf, 0x1f, 0x55, 0x6c, 0xab, 0xce, 0xd7, 0x2f, 0x25, 0x34, 0x83, 0x99, 0xae, 0xad, 0x5e,
+  0x33, 0xcc, 0x20, 0x4f, 0xc6, 0x73, 0x8b, 0x18, 0x34, 0xbd, 0xf1, 0x26, 0x47, 0x39, 0xf6, 0x30,
+  0x4d, 0xd0, 0x3a, 0xcf, 0xdf, 0x06, 0x81, 0xa9, 0xce, 0xe2, 0x5e, 0x1c, 0x8a, 0xbc, 0xf3, 0x51,
+  0x96, 0x4d, 0xd2, 0xb6, 0x83, 0x11, 0xc4, 0x59, 0x9a, 0xb6, 0x57, 0x56, 0xc8, 0x82, 0x9e, 0xd1,
+  0x27, 0x5c, 0x81, 0x1a, 0x0c, 0xad, 0x4a, 0x5c, 0x91, 0x20, 0x40, 0x85, 0xc4, 0x38, 0xf8, 0xe7,
+  0x1a, 0x6f, 0x94, 0x00, 0x26, 0xf1, 0xc2, 0x09, 0xae, 0x69, 0xa3, 0xbc, 0xcd, 0x1c, 0x61, 0x8c,
+  0x17, 0x5e, 0x10, 0x01, 0x33, 0x33, 0x1f, 0x28, 0x10, 0x5b, 0x6c, 0xd3, 0xe8, 0x92, 0xa1, 0x7a,
+  0x76, 0x3d, 0x21, 0xed, 0x41, 0xf1, 0x25, 0x61, 0x8e, 0x3a, 0xc5, 0x96, 0x71, 0x34, 0xe6, 0x69,
+  0xea, 0x57, 0xdf, 0xfb, 0x34, 0xb2, 0x63, 0xc5, 0x25, 0x48, 0x91, 0xe1, 0x5c, 0x91, 0x7c, 0x4f,
+  0x56, 0xce, 0xa7, 0x07, 0x97, 0x0f, 0xda, 0xad, 0xda, 0x03, 0x1c, 0xca, 0x83, 0x76, 0x74, 0xdb,
+  0x66, 0xcf, 0x41, 0x0a, 0x7e, 0xfa, 0xf7, 0x2c, 0xc0, 0xf8, 0x23, 0x8b, 0x40, 0x35, 0xb3, 0xef,
+  0x79, 0x02, 0xc4, 0x61, 0x8e, 0x76, 0xf7, 0x66, 0xd6, 0x60, 0xd4, 0xb6, 0x8d, 0x0f, 0xbb, 0x3c,
+  0xa8, 0xbc, 0x2d, 0xab, 0xb2, 0x1f, 0xc2, 0x10, 0x53, 0x1c, 0xd0, 0x74, 0x6a, 0x50, 0x1c, 0xc4,
+  0xcd, 0xe9, 0xf1, 0xf2, 0x64, 0x65, 0xe3, 0xd9, 0x13, 0x02, 0x69, 0xd0, 0xeb, 0x31, 0xe2, 0xe5,
+  0x96, 0xbc, 0x8d, 0x7e, 0x74, 0x45, 0xb4, 0xb9, 0xa4, 0x01, 0xb5, 0xca, 0xf7, 0x6c, 0xbd, 0x02,
+  0x1d, 0x46, 0xe4, 0xeb, 0x6d, 0x47, 0x84, 0x63, 0x44, 0xd0, 0x0b, 0x63, 0x5e, 0x5e, 0x75, 0x06,
+  0x74, 0x85, 0x93, 0x6e, 0xdd, 0x4a, 0x2d, 0x9c, 0x5f, 0xdd, 0xcf, 0x3d, 0x3a, 0xb3, 0x81, 0x34,
+  0x7a, 0x23, 0x7a, 0xbd, 0xa3, 0xec, 0x8f, 0x94, 0x78, 0x41, 0xb6, 0x1b, 0xb4, 0xf6, 0x6c, 0xed,
+  0x83, 0x45, 0x0d, 0x4b, 0x05, 0x19, 0x25, 0xa9, 0xba, 0xc6, 0x5a, 0x94, 0x0f, 0x72, 0x99, 0x0b,
+  0xb7, 0x51, 0xaa, 0x5e, 0xb4, 0x29, 0x30, 0xb7, 0xb4, 0x98, 0xe7, 0xb0, 0xa2, 0xe8, 0x68, 0x6b,
+  0xc1, 0xae, 0x99, 0xcf, 0xec, 0xcc, 0x23, 0x8e, 0xf8, 0x5f, 0x75, 0x55, 0xc6, 0x5a, 0xde, 0x06,
+  0x88, 0x11, 0x00, 0x28, 0xd8, 0x8e, 0x34, 0xa1, 0x2a, 0xfa, 0xa0, 0x96, 0x02, 0x62, 0xbc, 0x4b,
+  0x1a, 0x7f, 0xe9, 0x59, 0x26, 0xdb, 0x96, 0xc9, 0x85, 0x5a, 0xda, 0xc7, 0xf3, 0x25, 0xb9, 0x2c,
+  0x7f, 0x05, 0xd9, 0xc3, 0x7d, 0xa9, 0x20, 0x7c, 0x84, 0x01, 0x17, 0x6a, 0x2e, 0x88, 0x05, 0xbf,
+  0xee, 0xb6, 0xac, 0x2a, 0x55, 0x44, 0x63, 0x7e, 0x40, 0xac, 0x2a, 0x2a, 0x64, 0x37, 0x11, 0x7d,
+  0x55, 0x3f, 0x71, 0x95, 0xdf, 0x88, 0x54, 0x0a, 0x78, 0xdf, 0x8c, 0x24, 0xa8, 0xe7, 0x0e, 0xaa,
+  0x22, 0x74, 0xe6, 0x10, 0xf4, 0xe9, 0x4f, 0x29, 0x16, 0x21, 0x30, 0xcc, 0x89, 0xee, 0xdc, 0x2e,
+  0x9f, 0x94, 0x72, 0x84, 0x8c, 0x22, 0x12, 0x76, 0x48, 0x08, 0x54, 0xad, 0x41, 0xb6, 0xeb, 0xac,
+  0x50, 0xbd, 0x8c, 0xe3, 0x9b, 0x7d, 0xc7, 0x51, 0x3c, 0xe1, 0x51, 0x41, 0x14, 0xef, 0x76, 0x03,
+  0x64, 0x09, 0x9d, 0x0b, 0x17, 0xd0, 0x6d, 0x91, 0x8e, 0x72, 0x4c, 0x1b, 0x83, 0xef, 0x18, 0xd2,
+  0x2e, 0x6a, 0x77, 0x99, 0x1d, 0xa3, 0xdf, 0xfe, 0xaa, 0x5a, 0x00, 0xa6, 0xb9, 0x5f, 0xb6, 0x49,
+  0x98, 0xfd, 0xd2, 0x97, 0x6c, 0xd1, 0x08, 0x45, 0x41, 0xae, 0x77, 0xcd, 0xdb, 0x20, 0x93, 0xc2,
+  0x16, 0xbe, 0x8c, 0x7a, 0xa9, 0x9d, 0x16, 0x0d, 0x40, 0xbc, 0x4c, 0xb8, 0x94, 0x7c, 0x6c, 0x06,
+  0x34, 0x55, 0xab, 0x58, 0x4b, 0x51, 0x52, 0x5b, 0x5b, 0x53, 0x9a, 0x45, 0xe9, 0x9d, 0x89, 0x97,
+  0xef, 0x67, 0xfe, 0xd1, 0x68, 0x5f, 0x68, 0x21, 0xea, 0x7b, 0xd5, 0x78, 0x1f, 0x5f, 0xdc, 0xca,
+  0x17, 0xd3, 0x8a, 0x94, 0x53, 0xe1, 0xf9, 0x98, 0x82, 0x40, 0x25, 0xe3, 0x50, 0x56, 0x0a, 0x24,
+  0xf2, 0x5a, 0x01, 0xc8, 0x6b, 0x30, 0x8c, 0x4a, 0xa6, 0x97, 0xe4, 0x84, 0x25, 0x98, 0x1d, 0x1a,
+  0xe5, 0xbc, 0x4b, 0xe6, 0x42, 0x1d, 0xe7, 0x24, 0x79, 0x77, 0x35, 0xee, 0x96, 0x31, 0x17, 0xc4,
+  0xec, 0x17, 0xe4, 0x2c, 0x16, 0x0a, 0xd6, 0xa5, 0x20, 0xcb, 0xdb, 0x3b, 0x86, 0xa8, 0x2f, 0x5c,
+  0x02, 0x12, 0x22, 0xaf, 0xb3, 0x38, 0x9d, 0xf2, 0x24, 0xf0, 0x43, 0x68, 0x9e, 0x92, 0x81, 0xb9,
+  0xa0, 0x5a, 0x46, 0x23, 0x60, 0x34, 0xb0, 0x1f, 0x48, 0x89, 0x44, 0xd7, 0x49, 0xd7, 0xa4, 0x61,
+  0x00, 0x0a, 0xa9, 0x6e, 0xbd, 0xaa, 0x67, 0xeb, 0x0b, 0x40, 0xb3, 0xa8, 0x8b, 0x3b, 0x33, 0x7a,
+  0x82, 0x96, 0x5e, 0x05, 0xa7, 0xe7, 0xf1, 0xf6, 0xb6, 0x42, 0x39, 0xea, 0x8d, 0x9a, 0x5e, 0xfa,
+  0xb0, 0x26, 0xcb, 0x0e, 0xe5, 0x53, 0xc3, 0xfc, 0x89, 0x54, 0x96, 0xc5, 0xe0, 0x65, 0x8b, 0x80,
+  0xb1, 0x79, 0xb3, 0xeb, 0xce, 0x97, 0xc5, 0xe6, 0x6c, 0x1b, 0x5f, 0x74, 0x2c, 0x70, 0xbb, 0x64,
+  0xcf, 0xba, 0x2d, 0x07, 0x3b, 0xcc, 0xeb, 0xc9, 0x5f, 0x9a, 0x4b, 0xfa, 0xcb, 0x64, 0x7b, 0xca,
+  0x50, 0x45, 0xd2, 0xfb, 0x32, 0xd4, 0x00, 0x68, 0x62, 0x46, 0xbc, 0x1b, 0x16, 0xe6, 0x5f, 0x26,
+  0x03, 0x56, 0x06, 0x86, 0xcc, 0xbc, 0x9a, 0xcf, 0xc3, 0x8d, 0x90, 0x02, 0x69, 0xcb, 0x6f, 0xf9,
+  0xab, 0x8a, 0xe4, 0x8a, 0x9c, 0x57, 0xe3, 0x66, 0x7c, 0xcd, 0xba, 0x49, 0xaf, 0x21, 0x74, 0xf2,
+  0xd1, 0x72, 0x00, 0xf3, 0x49, 0x5a, 0x90, 0x89, 0x60, 0x4a, 0x97, 0x86, 0xf5, 0x03, 0xae, 0xc5,
+  0xb0, 0x85, 0x19, 0xf2, 0xcf, 0x5f, 0x89, 0x95, 0x60, 0xc5, 0x87, 0x63, 0xe7, 0x03, 0x67, 0xa3,
+  0x20, 0x3a, 0x9a, 0x13, 0x43, 0x33, 0xe3, 0x67, 0xea, 0x1d, 0xc6, 0xe1, 0x88, 0x9e, 0xb4, 0xa9,
+  0x06, 0x69, 0x6c, 0xd4, 0x28, 0x93, 0xac, 0x0c, 0x48, 0xf3, 0xf5, 0x32, 0x86, 0x35, 0x23, 0x6e,
+  0x71, 0xe4, 0x30, 0xea, 0x0e, 0x35, 0x66, 0xc2, 0xb4, 0x28, 0xf9, 0xcf, 0x40, 0x50, 0xc4, 0x70,
+  0x32, 0x18, 0xa4, 0xe4, 0x50, 0xac, 0x6e, 0x98, 0x4f, 0x00, 0x88, 0xa4, 0x2c, 0x1c, 0xbd, 0x1f,
+  0x32, 0xa1, 0x02, 0x5d, 0xf2, 0x25, 0x3b, 0x3f, 0xfd, 0x0e, 0x1c, 0xc9, 0x36, 0x3b, 0xf0, 0xc3,
+  0xee, 0x45, 0xc2, 0x83, 0x54, 0xb8, 0x98, 0x53, 0x3c, 0x46, 0xaa, 0xb1, 0xfa, 0x93, 0xe6, 0xef,
+  0x7f, 0xcb, 0xba, 0x50, 0xfa, 0x08, 0x3f, 0x79, 0xf7, 0xaa, 0x22, 0x6b, 0x56, 0x5a, 0x6c, 0x31,
+  0xe2, 0x68, 0x71, 0x4f, 0x9e, 0x83, 0x50, 0x18, 0x91, 0xa2, 0xeb, 0x98, 0x51, 0xfa, 0xa4, 0xb9,
+  0x25, 0xbf, 0xc0, 0x06, 0x91, 0x7f, 0xc1, 0x53, 0x90, 0x0d, 0xfb, 0x14, 0x24, 0x21, 0x13, 0xcb,
+  0x95, 0xf5, 0xd0, 0x16, 0x83, 0x7e, 0x32, 0xee, 0x8e, 0xd1, 0xab, 0xc7, 0xcd, 0x62, 0xe6, 0x66,
+  0x1e, 0x20, 0xa3, 0x66, 0xbd, 0x38, 0x45, 0xaf, 0x06, 0xc1, 0xb4, 0x08, 0x15, 0x0f, 0x4f, 0xf2,
+  0x98, 0x18, 0x81, 0xa4, 0xc0, 0xf4, 0x39, 0x20, 0x55, 0x91, 0xc1, 0x72, 0x5c, 0x50, 0x47, 0xd9,
+  0x8c, 0x16, 0x32, 0x7c, 0x77, 0x95, 0x67, 0xe2, 0xf6, 0xaa, 0x52, 0x70, 0x61, 0xc6, 0xf6, 0x60,
+  0xeb, 0x02, 0xf0, 0x24, 0xe8, 0xa1, 0x96, 0x49, 0xd9, 0xe0, 0xa7, 0xdf, 0xe1, 0xed, 0x64, 0x18,
+  0x7f, 0x6b, 0x83, 0x91, 0xa0, 0x56, 0x4e, 0x89, 0xd2, 0x48, 0x9f, 0x35, 0x23, 0x63, 0x11, 0xd8,
+  0x1d, 0xe3, 0x3c, 0xe8, 0x55, 0x05, 0xdf, 0x8b, 0x69, 0x72, 0xa8, 0x8b, 0xc6, 0x95, 0x0b, 0x66,
+  0x01, 0x53, 0x80, 0xa2, 0x12, 0x47, 0x6a, 0x2c, 0xa1, 0x35, 0x2f, 0xa7, 0xb0, 0x26, 0xfc, 0xdd,
+  0x25, 0x1c, 0x11, 0xcb, 0x95, 0x64, 0xdd, 0x64, 0x87, 0xc9, 0x8b, 0xf9, 0x09, 0x83, 0xbd, 0x3c,
+  0x53, 0xd0, 0x5a, 0x6f, 0x85, 0x9b, 0xc7, 0xa5, 0x14, 0xc2, 0x5e, 0x21, 0xd1, 0x4f, 0x25, 0xf0,
+  0x7d, 0x09, 0xfb, 0x6c, 0x21, 0x5b, 0xc4, 0x48, 0x9d, 0x0c, 0x38, 0x46, 0xa2, 0xc6, 0x4e, 0xcd,
+  0x90, 0x67, 0x63, 0xb1, 0x83, 0x14, 0xa9, 0x02, 0xad, 0x3f, 0x30, 0x18, 0xbe, 0x66, 0xf1, 0xed,
+  0x5b, 0x9e, 0xfa, 0xe3, 0x8c, 0xb3, 0x17, 0xd0, 0x87, 0x8c, 0xaa, 0x82, 0x1b, 0xc4, 0xdc, 0xd6,
+  0xc6, 0xd8, 0xa3, 0x3c, 0xfe, 0x1b, 0xc0, 0x6d, 0x6c, 0x97, 0x20, 0xe9, 0x50, 0x70, 0xec, 0xd3,
+  0x32, 0x42, 0xcd, 0x0e, 0xad, 0xc9, 0xff, 0x00, 0x0d, 0xf2, 0xad, 0xac, 0xad, 0x98, 0xd1, 0xa6,
+  0x26, 0xd2, 0x28, 0xd4, 0x2b, 0x87, 0x28, 0x32, 0x70, 0xa3, 0xa1, 0x44, 0x93, 0xd3, 0xc9, 0xe2,
+  0x09, 0xee, 0x00, 0x22, 0x4a, 0xff, 0x0d, 0xc6, 0xe7, 0xd7, 0xf0, 0xc7, 0x63, 0xdc, 0x15, 0x1a,
+  0xcd, 0x0d, 0x79, 0xa0, 0x3e, 0x17, 0xb4, 0x35, 0x17, 0x74, 0xd5, 0x73, 0xac, 0xbd, 0x26, 0xd7,
+  0x5a, 0x1a, 0x95, 0xaa, 0x2e, 0x08, 0xee, 0x7c, 0xb1, 0xd5, 0xe3, 0x99, 0x27, 0xbe, 0xe5, 0x18,
+  0xbd, 0xad, 0x06, 0xc4, 0x56, 0x09, 0xf6, 0x92, 0xdd, 0x1b, 0xd2, 0x27, 0x5f, 0xdb, 0x82, 0x19,
+  0xfb, 0x4e, 0x6e, 0x51, 0xf8, 0xe0, 0xa3, 0xf9, 0x72, 0x39, 0xcc, 0xd6, 0xcb, 0xdd, 0xd3, 0xe7,
+  0x87, 0xdf, 0xb2, 0x11, 0x4f, 0x2e, 0x63, 0xf0, 0x00, 0x46, 0x31, 0xbe, 0x1a, 0x5d, 0x9c, 0xbb,
+  0x3d, 0xbd, 0xc5, 0xfd, 0x11, 0xa6, 0xb0, 0xb8, 0x85, 0x5a, 0xd3, 0x91, 0xf7, 0x34, 0x67, 0x42,
+  0x0b, 0xe9, 0xe0, 0xab, 0xc5, 0xf9, 0x9c, 0x87, 0xa0, 0x35, 0x07, 0x41, 0x6b, 0xc9, 0xa4, 0xe6,
+  0xf8, 0x3e, 0x7b, 0x6e, 0x8b, 0x03, 0xfd, 0x45, 0xa7, 0xf8, 0xd8, 0x4f, 0x2e, 0x60, 0x7a, 0x31,
+  0xb2, 0x8b, 0xa7, 0x24, 0x17, 0xe6, 0x8c, 0x47, 0xe6, 0x94, 0xe3, 0x63, 0xde, 0x03, 0x3f, 0xe9,
+  0x06, 0x43, 0x3e, 0x66, 0xcf, 0xe3, 0xa1, 0x98, 0xee, 0xf2, 0x21, 0x97, 0xcc, 0x5a, 0x75, 0xaa,
+  0x14, 0x7f, 0xd9, 0x34, 0xf9, 0x45, 0x99, 0x93, 0x2b, 0x6f, 0x31, 0x56, 0xf9, 0x1c, 0xff, 0x24,
+  0x4e, 0x03, 0x52, 0x3f, 0x2e, 0x0a, 0xed, 0xca, 0xab, 0x18, 0x9f, 0xde, 0xf6, 0x72, 0xcb, 0x9e,
+  0x5a, 0xe5, 0xd6, 0x9d, 0xb2, 0x82, 0xd6, 0x61, 0xea, 0x8b, 0x76, 0x53, 0x45, 0x6e, 0xff, 0x3a,
+  0xfc, 0x73, 0x3e, 0x7b, 0x58, 0x66, 0xa7, 0xe6, 0x90, 0xf0, 0x8f, 0x1c, 0x94, 0x66, 0xae, 0x9a,
+  0xef, 0x83, 0xc1, 0xc0, 0xf9, 0xdc, 0x13, 0x57, 0x9b, 0x4b, 0xe5, 0xdc, 0x27, 0xe3, 0xe9, 0x0f,
+  0xda, 0x41, 0xac, 0x48, 0x81, 0x0e, 0x76, 0x1a, 0x8e, 0x2a, 0xbd, 0xc6, 0x50, 0x70, 0x4e, 0xed,
+  0x40, 0x81, 0x84, 0x2a, 0xf7, 0x65, 0x62, 0x2d, 0xbe, 0xea, 0x41, 0x68, 0x55, 0xf0, 0x63, 0xc7,
+  0x7a, 0xdf, 0x43, 0x6f, 0x6c, 0x85, 0xbf, 0xc2, 0x60, 0x82, 0x98, 0xbb, 0xd0, 0x7e, 0xe7, 0x35,
+  0xc3, 0x14, 0x73, 0x7a, 0x6b, 0xc5, 0x0f, 0x83, 0x34, 0xc0, 0x67, 0x24, 0x17, 0xe5, 0x6e, 0x0f,
+  0x66, 0xdf, 0xf3, 0x24, 0x0d, 0x30, 0x1f, 0xb5, 0x90, 0xe1, 0x44, 0x7d, 0xe8, 0x6a, 0xba, 0x6d,
+  0x5b, 0x77, 0x16, 0xe6, 0x81, 0x1b, 0x8f, 0x37, 0x97, 0xb0, 0x95, 0xdf, 0x97, 0x16, 0x63, 0xc8,
+  0x0b, 0x0c, 0x53, 0x1b, 0x9f, 0x68, 0x52, 0x14, 0xe0, 0xe7, 0xf3, 0xde, 0xc2, 0x7e, 0xb1, 0x09,
+  0xbe, 0x31, 0x02, 0x1c, 0x2a, 0xf5, 0xab, 0x98, 0x2c, 0x50, 0x1a, 0xcc, 0xc5, 0xbf, 0x35, 0x02,
+  0x65, 0xc5, 0x47, 0x51, 0x7e, 0xff, 0xdb, 0x3d, 0x47, 0x3c, 0x8b, 0xb1, 0x38, 0xe7, 0x5d, 0x04,
+  0xec, 0x49, 0x16, 0x60, 0x50, 0xe8, 0x6e, 0x97, 0xdf, 0xde, 0x90, 0x43, 0x2c, 0xb7, 0xa4, 0x10,
+  0x57, 0xfe, 0x90, 0xf6, 0x33, 0x36, 0xb7, 0x61, 0x9b, 0x2d, 0xc9, 0xbd, 0x0f, 0x26, 0xd5, 0x13,
+  0x17, 0x4c, 0xee, 0x32, 0x63, 0xdd, 0x34, 0x0d, 0xfa, 0xd5, 0x08, 0xa8, 0xea, 0x2e, 0x38, 0xfc,
+  0x09, 0x86, 0x36, 0xaa, 0x91, 0x88, 0xba, 0xbb, 0x60, 0xa1, 0x3d, 0x1f, 0x9f, 0x0a, 0x2d, 0x31,
+  0xb1, 0x28, 0xfd, 0x18, 0xb3, 0x2d, 0xbe, 0x65, 0x33, 0x5e, 0x8c, 0x7c, 0x4a, 0xf7, 0x61, 0xe6,
+  0xc8, 0xa4, 0xf9, 0x22, 0x05, 0x11, 0x2d, 0x5a, 0x9f, 0x83, 0x3f, 0x58, 0x63, 0x46, 0xc1, 0x12,
+  0x79, 0x00, 0x76, 0xcd, 0x13, 0x00, 0xa8, 0x12, 0x54, 0x93, 0x84, 0xf5, 0x9f, 0x2f, 0xa1, 0x76,
+  0xc4, 0xfd, 0xf2, 0xa4, 0x1a, 0x39, 0x52, 0x02, 0x2b, 0xb6, 0x3a, 0x1f, 0x24, 0x5c, 0x32, 0x84,
+  0xd2, 0x0b, 0x56, 0xd7, 0x45, 0x17, 0xdf, 0x3d, 0x5f, 0xd2, 0x43, 0x1c, 0xf6, 0x8f, 0xe7, 0xc9,
+  0xab, 0xa8, 0x44, 0xac, 0x1b, 0xf2, 0x51, 0x8e, 0x71, 0x6a, 0xbc, 0x53, 0x03, 0xda, 0xf7, 0x42,
+  0x4d, 0x2f, 0x3e, 0x66, 0x73, 0x84, 0xdf, 0xef, 0x32, 0xc1, 0xb2, 0x6d, 0xb9, 0x57, 0x81, 0x71,
+  0x27, 0x3f, 0x75, 0xc0, 0x40, 0x9a, 0x7e, 0xfd, 0x06, 0xe1, 0x9e, 0xfb, 0xbd, 0x8b, 0x78, 0x30,
+  0x38, 0x96, 0x6f, 0x69, 0x3c, 0x13, 0x44, 0xe0, 0x48, 0xdd, 0x84, 0xe3, 0xc1, 0x15, 0xe5, 0x8f,
+  0x96, 0x9b, 0xcf, 0x7b, 0xf9, 0x28, 0xf5, 0xd4, 0xfd, 0x19, 0x44, 0xa4, 0x22, 0x1f, 0x0b, 0x74,
+  0x2c, 0x71, 0x43, 0xed, 0xb4, 0x6f, 0xfd, 0x24, 0x02, 0x93, 0x02, 0x2c, 0x08, 0x3f, 0xba, 0xe1,
+  0xc1, 0xd0, 0xb0, 0x0d, 0x31, 0x46, 0x08, 0xd4, 0x63, 0x5c, 0x72, 0x51, 0xee, 0xac, 0xd1, 0x4c,
+  0x25, 0xcf, 0x0a, 0xea, 0x65, 0x45, 0xaa, 0x47, 0xaf, 0x0a, 0x54, 0x2e, 0xd4, 0x53, 0xa6, 0x9f,
+  0xec, 0x34, 0x90, 0x58, 0x2f, 0xc1, 0xd8, 0x70, 0x78, 0x07, 0x66, 0x56, 0x7a, 0xfa, 0x45, 0x56,
+  0xcb, 0xe7, 0x5f, 0x7e, 0xfe, 0x97, 0x7f, 0xc3, 0x17, 0xd8, 0x91, 0x89, 0xb3, 0xca, 0x47, 0x58,
+  0x4a, 0x6f, 0x0f, 0xce, 0xeb, 0xfb, 0x0b, 0x9e, 0x69, 0x59, 0xa3, 0x67, 0x5a, 0xbe, 0xa3, 0x1b,
+  0x9b, 0x9a, 0xb3, 0xfa, 0x95, 0x96, 0xea, 0x87, 0xe0, 0x45, 0xd8, 0x18, 0xc3, 0x2c, 0xf6, 0x93,
+  0x54, 0x4b, 0x19, 0x2f, 0x9b, 0xe4, 0x19, 0xcb, 0x22, 0x56, 0x83, 0x0f, 0x9a, 0x05, 0xc6, 0x0d,
+  0x6b, 0x83, 0xcb, 0x12, 0xc2, 0x1a, 0xa5, 0x68, 0x8b, 0x9c, 0x0d, 0x97, 0x3c, 0xaa, 0x63, 0xdc,
+  0x0a, 0x0a, 0xbd, 0xbb, 0xb1, 0xb6, 0xaa, 0xc3, 0x2f, 0x7e, 0xfd, 0x46, 0xb0, 0x15, 0xd9, 0xb5,
+  0x84, 0xa3, 0x96, 0x01, 0x23, 0x1e, 0x95, 0x2f, 0xff, 0xe5, 0x1d, 0xac, 0xa4, 0x35, 0x6e, 0xbf,
+  0xd6, 0x68, 0x26, 0xcc, 0x2d, 0xde, 0xa7, 0xf3, 0xd3, 0xaa, 0xea, 0xed, 0xc2, 0xcc, 0x17, 0x12,
+  0x47, 0x73, 0xf7, 0xac, 0xe7, 0xe4, 0x54, 0xea, 0x12, 0xee, 0x9d, 0x60, 0xa6, 0x5f, 0xe1, 0x12,
+  0x2c, 0x18, 0x3a, 0xd0, 0x5a, 0x54, 0x88, 0x95, 0xc9, 0xc0, 0x5f, 0x11, 0x7f, 0x1b, 0x06, 0xff,
+  0x46, 0x10, 0xeb, 0x84, 0x71, 0x86, 0x7f, 0x72, 0x6a, 0xc4, 0xc1, 0x48, 0x0a, 0x87, 0x78, 0x79,
+  0x5f, 0xfc, 0x5d, 0xa0, 0x41, 0x86, 0x21, 0x06, 0xf0, 0x02, 0x82, 0x51, 0x82, 0x0f, 0x70, 0xa3,
+  0xd1, 0x83, 0x67, 0x0b, 0xe8, 0x27, 0x1c, 0xbe, 0xa8, 0xc8, 0x3a, 0xb6, 0x5f, 0x75, 0x32, 0x9f,
+  0xa0, 0xf3, 0xd4, 0x7e, 0xae, 0x1a, 0xb7, 0xf3, 0x14, 0xe5, 0x42, 0x86, 0x1f, 0xdd, 0x5a, 0x2f,
+  0x5d, 0xe8, 0xce, 0x73, 0xa5, 0xec, 0xac, 0x3e, 0x93, 0x84, 0x17, 0x94, 0xe5, 0xb2, 0x8c, 0xd5,
+  0x0e, 0x5d, 0xbb, 0x06, 0xb1, 0xab, 0x23, 0x41, 0x8e, 0x57, 0xc6, 0x73, 0x16, 0x64, 0x4b, 0xfe,
+  0x4e, 0x5e, 0x01, 0x51, 0x86, 0x00, 0x0a, 0x93, 0x81, 0xa3, 0x30, 0x9d, 0xf4, 0xc7, 0x1e, 0x64,
+  0xa2, 0xfb, 0x57, 0x08, 0x8d, 0x99, 0xa4, 0x68, 0x57, 0xc9, 0x32, 0x42, 0x48, 0xd3, 0x4b, 0xca,
+  0xef, 0x7e, 0x96, 0x1f, 0x7a, 0xe4, 0x03, 0xfc, 0x92, 0x35, 0x80, 0xbf, 0xea, 0x3e, 0xc6, 0x91,
+  0xda, 0xd2, 0x01, 0xc1, 0xbf, 0x7d, 0xd6, 0xc7, 0xf4, 0xad, 0x36, 0x5b, 0x6d, 0xca, 0x37, 0xa1,
+  0x64, 0x27, 0xe0, 0x15, 0x66, 0x74, 0x10, 0x63, 0xac, 0x8e, 0xaa, 0xbb, 0xdb, 0x56, 0x90, 0x74,
+  0x86, 0x2f, 0xc6, 0x2a, 0xab, 0xb2, 0x71, 0x55, 0x32, 0x2a, 0x29, 0x35, 0xb0, 0x69, 0x9f, 0x76,
+  0xce, 0xde, 0x9b, 0x30, 0xd7, 0x65, 0x98, 0xeb, 0x0a, 0x98, 0x5d, 0x19, 0xc2, 0xd5, 0x70, 0x2a,
+  0x63, 0xba, 0x0c, 0xae, 0x6b, 0x0a, 0x58, 0xae, 0x28, 0xe4, 0x45, 0x07, 0x79, 0x85, 0x0c, 0x46,
+  0x1a, 0x47, 0x9b, 0x86, 0x93, 0xe7, 0x30, 0x5a, 0xc1, 0x5a, 0x0d, 0x4a, 0xe4, 0x57, 0x35, 0xe9,
+  0x07, 0xe9, 0x24, 0xf4, 0xaf, 0x15, 0x9d, 0xe5, 0x1e, 0x44, 0x4d, 0x5b, 0x0f, 0xa6, 0x02, 0xf8,
+  0x85, 0xcc, 0x19, 0x37, 0xc7, 0xd9, 0xd7, 0x65, 0xc5, 0x71, 0xea, 0x1a, 0x9d, 0x4c, 0xd9, 0xce,
+  0x2d, 0xfc, 0x86, 0xcc, 0x55, 0xaf, 0x06, 0xc3, 0x0a, 0x03, 0xaa, 0xe9, 0x55, 0x10, 0xd3, 0xc1,
+  0xe4, 0x79, 0x93, 0x92, 0x54, 0x14, 0x14, 0xf1, 0x89, 0xe2, 0xb6, 0x54, 0x50, 0x86, 0x8a, 0x42,
+  0xdd, 0x53, 0x52, 0x49, 0x73, 0x45, 0xfa, 0xd7, 0x52, 0xdc, 0x50, 0xb2, 0x9f, 0x6e, 0xa3, 0xab,
+  0x1a, 0x0d, 0x9f, 0x2a, 0x86, 0xb4, 0xb7, 0x57, 0x64, 0x09, 0xfb, 0x93, 0x4f, 0x05, 0x66, 0x19,
+  0xe9, 0xb4, 0xb7, 0x63, 0x21, 0xbb, 0x55, 0xa8, 0x88, 0xe7, 0x55, 0x78, 0xa8, 0x42, 0x23, 0x69,
+  0x7a, 0xb7, 0xbf, 0xff, 0xed, 0x7c, 0x2c, 0xef, 0x2c, 0x0c, 0x52, 0xa2, 0xee, 0x48, 0xc1, 0x7b,
+  0x0b, 0xf6, 0xfa, 0xb3, 0x60, 0x69, 0x32, 0xaa, 0xa8, 0xa7, 0x8a, 0x5b, 0x0b, 0xf0, 0x4f, 0x3e,
+  0xe5, 0x53, 0x26, 0xee, 0x01, 0xd8, 0x53, 0xf6, 0x6b, 0x0b, 0xf3, 0xff, 0xfc, 0xb5, 0x85, 0xd6,
+  0x55, 0x40, 0x4a, 0x3c, 0xbc, 0x0a, 0x0a, 0x7f, 0x4d, 0x99, 0x8e, 0xe2, 0x74, 0xf5, 0xd7, 0xf9,
+  0xb4, 0xb7, 0x1e, 0xe3, 0x09, 0xce, 0x90, 0xf7, 0x13, 0x3e, 0xca, 0xda, 0xec, 0xbd, 0xbc, 0x6f,
+  0x9f, 0x1f, 0xf2, 0xc8, 0x80, 0xcc, 0xa5, 0x99, 0x24, 0xd7, 0x03, 0xab, 0x3d, 0x7a, 0x67, 0x9d,
+  0x9f, 0xa8, 0x85, 0x3a, 0x27, 0x5a, 0x6d, 0xc0, 0xbd, 0xb7, 0xe2, 0xdb, 0xd7, 0x73, 0xe1, 0x0a,
+  0x82, 0x39, 0x0c, 0xe3, 0x99, 0x81, 0x0b, 0xbf, 0x96, 0xa3, 0x40, 0x78, 0x16, 0xd6, 0xda, 0x28,
+  0x84, 0x51, 0xf2, 0x53, 0xbe, 0x84, 0x97, 0x41, 0xd6, 0x6a, 0x6c, 0x1e, 0xc0, 0xfc, 0x23, 0xb7,
+  0x96, 0x71, 0xe4, 0xb6, 0xba, 0x5a, 0x75, 0xe4, 0x56, 0x71, 0xe8, 0xf6, 0x9e, 0xfe, 0x60, 0x9d,
+  0xfd, 0xf0, 0xb6, 0x7e, 0x03, 0x65, 0x9a, 0x55, 0x46, 0x85, 0x56, 0xcb, 0xc7, 0x81, 0xc5, 0x30,
+  0xee, 0xa2, 0xe0, 0xad, 0x9c, 0xa9, 0x9a, 0x62, 0xbd, 0x78, 0xef, 0xa3, 0x54, 0x98, 0x33, 0x53,
+  0xf6, 0xa0, 0x70, 0xcf, 0x09, 0xd7, 0x16, 0xb2, 0xe4, 0x9b, 0x8d, 0xc7, 0x9e, 0xb3, 0x10, 0xb2,
+  0x35, 0x0f, 0x52, 0xc3, 0xcd, 0x8b, 0xd4, 0xde, 0xe1, 0xd8, 0x68, 0xd1, 0x78, 0x2a, 0xa3, 0x75,
+  0xa5, 0x48, 0xab, 0x29, 0x67, 0x28, 0x25, 0x95, 0x14, 0x15, 0x9e, 0x06, 0xf9, 0x4c, 0x92, 0x72,
+  0xe1, 0xfb, 0x0c, 0x92, 0xc8, 0xa7, 0x9f, 0x4b, 0xcc, 0xc0, 0xa0, 0x44, 0x3d, 0x6f, 0xd1, 0x05,
+  0xdf, 0x97, 0x6c, 0x93, 0xcf, 0x3a, 0xbe, 0x5a, 0x7c, 0x80, 0x55, 0x1d, 0xd0, 0x04, 0x45, 0xe3,
+  0xd8, 0x27, 0x96, 0x4a, 0x78, 0x4d, 0x59, 0x2e, 0xc2, 0xd3, 0x71, 0x95, 0x73, 0xa6, 0x0c, 0xaa,
+  0xb2, 0x30, 0xd2, 0x0d, 0xd5, 0x7c, 0xc9, 0x78, 0x15, 0xa7, 0x5d, 0x9f, 0x0b, 0x4e, 0xee, 0x82,
+  0xf1, 0x27, 0xa7, 0xb6, 0xee, 0x95, 0xff, 0x5e, 0x4a, 0xfe, 0x07, 0x94, 0xe9, 0xef, 0x22, 0xa9,
+  0x57, 0xe7, 0xfd, 0xfe, 0xb5, 0x78, 0x68, 0xc0, 0x78, 0x13, 0x1e, 0xc0, 0xf3, 0xbf, 0x02, 0x65,
+  0x34, 0x54, 0x7f, 0xb3, 0xcd, 0x72, 0x2e, 0x6e, 0xef, 0x15, 0xf2, 0x40, 0xb7, 0xee, 0x15, 0x73,
+  0xe8, 0x05, 0x39, 0xc6, 0x4d, 0x6d, 0xfb, 0x31, 0x4f, 0x02, 0xb0, 0xaf, 0x2a, 0xcb, 0x3a, 0xba,
+  0x26, 0x4b, 0x4f, 0xa8, 0xc9, 0xbf, 0x1f, 0x56, 0x4d, 0xd1, 0x9c, 0x97, 0xf4, 0x29, 0xc8, 0x2b,
+  0x93, 0x46, 0xcb, 0xe9, 0x48, 0x62, 0xc8, 0xd6, 0x25, 0xfd, 0xb9, 0x78, 0x4a, 0x6f, 0x1b, 0x60,
+  0x6e, 0xd2, 0xff, 0x03, 0x1b, 0xb0, 0x9c, 0x06, 0x56, 0x7b, 0x00, 0x00,
+};
+
+// index.html: 5519 B roh, 1436 B gzip
+static const uint8_t DASHBOARD_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x58, 0xcd, 0x72, 0xdb, 0x36,
+  0x10, 0xbe, 0xe7, 0x29, 0x10, 0x5e, 0x6c, 0xcf, 0x94, 0xa1, 0x7e, 0x6c, 0xd7, 0xc9, 0x48, 0xca,
+  0xc4, 0x4e, 0x32, 0xf5, 0x54, 0x4e, 0x5d, 0x4b, 0x89, 0xdb, 0x23, 0x44, 0xae, 0x44, 0xd4, 0x24,
+  0xc0, 0x00, 0x90, 0x1c, 0xe7, 0xd4, 0x53, 0xa7, 0xa7, 0x66, 0xa6, 0xbd, 0x74, 0x7a, 0x49, 0xdf,
+  0xa0, 0xd3, 0x5b, 0x9f, 0x27, 0x2f, 0xd0, 0x3c, 0x42, 0x17, 0x20, 0x29, 0x52, 0x12, 0xe4, 0x36,
+  0x89, 0xd4, 0x83, 0x46, 0x24, 0x76, 0xb1, 0xfb, 0x61, 0xb1, 0xd8, 0x6f, 0x89, 0xce, 0xdd, 0xc7,
+  0x5f, 0x9d, 0x0c, 0xbf, 0x3d, 0x7f, 0x42, 0x62, 0x9d, 0x26, 0xbd, 0x3b, 0x9d, 0xf2, 0x0f, 0x68,
+  0xd4, 0xbb, 0x43, 0x48, 0x27, 0x05, 0x4d, 0x49, 0x18, 0x53, 0xa9, 0x40, 0x77, 0xbd, 0xe7, 0xc3,
+  0xa7, 0xfe, 0x91, 0x57, 0x09, 0x38, 0x4d, 0xa1, 0xeb, 0xcd, 0x18, 0x5c, 0x67, 0x42, 0x6a, 0x8f,
+  0x84, 0x82, 0x6b, 0xe0, 0xa8, 0x78, 0xcd, 0x22, 0x1d, 0x77, 0x23, 0x98, 0xb1, 0x10, 0x7c, 0xfb,
+  0xf2, 0x19, 0x61, 0x9c, 0x69, 0x46, 0x13, 0x5f, 0x85, 0x34, 0x81, 0x6e, 0xf3, 0x5e, 0x23, 0x37,
+  0xa4, 0x99, 0x4e, 0xa0, 0x77, 0x41, 0x23, 0x2a, 0xc9, 0x99, 0x40, 0x1d, 0x21, 0x3b, 0x41, 0x3e,
+  0x68, 0xc4, 0x09, 0xe3, 0x57, 0x44, 0x42, 0xd2, 0xf5, 0x94, 0xbe, 0x49, 0x40, 0xc5, 0x00, 0xe8,
+  0x28, 0x96, 0x30, 0xee, 0x7a, 0x41, 0x44, 0x55, 0x3c, 0x12, 0x54, 0x46, 0xf7, 0x42, 0xa5, 0x1e,
+  0xce, 0xba, 0xe3, 0xc3, 0x71, 0xd4, 0x38, 0x18, 0xb7, 0xd0, 0x72, 0x27, 0xc8, 0xd7, 0xd0, 0x19,
+  0x89, 0xe8, 0x86, 0x84, 0x09, 0x55, 0xaa, 0xeb, 0xa1, 0x8f, 0x2b, 0x3f, 0x15, 0x11, 0xe4, 0xae,
+  0x23, 0x36, 0x23, 0x2c, 0xea, 0x7a, 0x3a, 0x86, 0x14, 0x7c, 0x75, 0xcd, 0x74, 0x18, 0x83, 0xb4,
+  0x32, 0x94, 0x8e, 0xa6, 0x5a, 0x0b, 0x5e, 0x29, 0x0c, 0xc5, 0x64, 0x92, 0x80, 0x57, 0xda, 0xca,
+  0x27, 0x69, 0x3b, 0xe8, 0x8f, 0x34, 0xf7, 0x88, 0xbe, 0xc9, 0x30, 0x1a, 0xf9, 0x34, 0xaf, 0xf7,
+  0xee, 0xd7, 0xef, 0xff, 0xfe, 0xeb, 0x0d, 0xe9, 0xb3, 0x49, 0xac, 0x71, 0x61, 0x11, 0x74, 0x82,
+  0x5c, 0x64, 0x5d, 0x07, 0xe8, 0xdb, 0x3e, 0xc4, 0xcd, 0xde, 0xfb, 0xb7, 0x3f, 0xfd, 0x41, 0xf2,
+  0x00, 0xf4, 0xd9, 0x0c, 0xaa, 0x28, 0xa0, 0xac, 0x0e, 0x53, 0x69, 0xaa, 0xa7, 0x6a, 0x0e, 0x00,
+  0x83, 0xcd, 0x21, 0xd4, 0x10, 0x79, 0xbd, 0x17, 0x20, 0x47, 0x53, 0x1e, 0x01, 0x2f, 0xec, 0xd6,
+  0x67, 0xcd, 0x63, 0x54, 0xae, 0xeb, 0xae, 0xef, 0x93, 0x27, 0x83, 0x73, 0x72, 0xca, 0xc7, 0x42,
+  0x11, 0xdf, 0x2f, 0x86, 0x4b, 0x7d, 0x50, 0x99, 0xcf, 0x50, 0x54, 0xf9, 0xa9, 0xe6, 0x1a, 0xbc,
+  0xed, 0xde, 0x7c, 0x32, 0x22, 0x6c, 0xcf, 0x05, 0x66, 0x7e, 0x31, 0xc3, 0x4c, 0xf7, 0x99, 0x86,
+  0xd4, 0xeb, 0x75, 0x54, 0x46, 0xf9, 0xc2, 0x78, 0x42, 0x47, 0x90, 0x78, 0xbd, 0xa7, 0x4c, 0xa6,
+  0xd7, 0x54, 0xc2, 0x83, 0x4e, 0x60, 0x54, 0x7a, 0x24, 0xd7, 0x34, 0x08, 0xc6, 0xd7, 0xb8, 0x1e,
+  0xc5, 0x30, 0x88, 0x0b, 0x13, 0x67, 0x34, 0x99, 0xe2, 0xc6, 0xf9, 0xc5, 0x84, 0x79, 0x08, 0x3f,
+  0xc6, 0xfb, 0x05, 0x60, 0x3e, 0x93, 0x0b, 0xa0, 0x4a, 0x70, 0x07, 0x02, 0x69, 0xc4, 0xb9, 0x74,
+  0x7b, 0x18, 0x86, 0x90, 0x66, 0x20, 0x71, 0x4b, 0xa5, 0x03, 0x81, 0x9e, 0x0b, 0x61, 0x8b, 0x51,
+  0xb0, 0x39, 0x87, 0xb1, 0xd0, 0x54, 0x6a, 0xe5, 0x8a, 0x83, 0x51, 0x18, 0x80, 0xc4, 0x63, 0x5b,
+  0x6a, 0x39, 0xd1, 0x34, 0x36, 0x81, 0xe6, 0xf4, 0xdc, 0x81, 0x80, 0x65, 0xdb, 0x5b, 0xfe, 0xf1,
+  0x60, 0x70, 0xfa, 0xd8, 0xe1, 0x73, 0xa4, 0x14, 0x8b, 0xb6, 0xe7, 0xf6, 0x51, 0x18, 0x82, 0x52,
+  0xe4, 0x5c, 0x30, 0xae, 0x1d, 0xde, 0x69, 0xf6, 0x0c, 0xab, 0xea, 0xf6, 0xdc, 0x3f, 0xcf, 0x34,
+  0x4b, 0x5d, 0xc7, 0x6e, 0x6a, 0x05, 0xee, 0xfd, 0x6d, 0x34, 0x1e, 0x34, 0x36, 0xb2, 0xc9, 0x17,
+  0x18, 0x73, 0x57, 0xa2, 0x61, 0xc8, 0xdd, 0x9e, 0x49, 0x74, 0x9c, 0x6e, 0xc2, 0xf1, 0x17, 0x40,
+  0x33, 0x87, 0x63, 0x24, 0x89, 0x6c, 0x8d, 0xe3, 0x2f, 0x8f, 0x37, 0xe1, 0xf7, 0xec, 0xeb, 0xe1,
+  0xd0, 0xe1, 0x37, 0x7d, 0xa9, 0x75, 0x1f, 0xa9, 0x6d, 0x8b, 0xe5, 0x85, 0xca, 0x09, 0x38, 0x4f,
+  0xb5, 0xb6, 0x92, 0x13, 0x31, 0xe5, 0x7a, 0x7b, 0xa7, 0xd9, 0x30, 0x99, 0x3f, 0xd0, 0x12, 0x68,
+  0xea, 0x80, 0x90, 0xa0, 0x34, 0x17, 0x6e, 0x2f, 0x00, 0xdf, 0xf8, 0x8f, 0xc2, 0x58, 0xd5, 0x32,
+  0xbd, 0x46, 0xe8, 0x8c, 0xcf, 0x40, 0xea, 0x65, 0x46, 0x5f, 0xcb, 0xe5, 0xcf, 0x84, 0x4c, 0x69,
+  0x32, 0x27, 0xf0, 0x1a, 0xac, 0x8a, 0x70, 0x0b, 0x66, 0xcd, 0x6b, 0xea, 0x0b, 0xa6, 0xa6, 0x34,
+  0x61, 0xaf, 0xa9, 0x46, 0x1a, 0xab, 0x38, 0x36, 0xa4, 0x7c, 0x46, 0x55, 0x55, 0x5a, 0x3d, 0x92,
+  0x37, 0x4a, 0xde, 0x51, 0xa3, 0x81, 0x4d, 0x0d, 0x98, 0x5e, 0xa1, 0xeb, 0xed, 0x1f, 0x60, 0x6b,
+  0xd4, 0x09, 0x72, 0xe5, 0xba, 0xed, 0x13, 0x6c, 0xaf, 0xa4, 0x48, 0xc8, 0xb1, 0x85, 0xe1, 0xe0,
+  0xee, 0x30, 0x57, 0xf0, 0x73, 0x9c, 0xaa, 0x62, 0xed, 0x62, 0xe9, 0xc5, 0x42, 0x71, 0x85, 0x04,
+  0x7f, 0x7e, 0x44, 0xf9, 0x04, 0xfb, 0x1d, 0x22, 0x78, 0x98, 0xb0, 0xf0, 0x0a, 0xc3, 0x32, 0xde,
+  0x45, 0x13, 0x63, 0xa4, 0xe6, 0xdd, 0x1d, 0x64, 0xf9, 0x76, 0x0b, 0xf1, 0xc9, 0x2b, 0x94, 0xc5,
+  0x84, 0xc3, 0xd4, 0x12, 0x00, 0xf0, 0x87, 0x3b, 0x7b, 0x7b, 0x44, 0x01, 0x8f, 0x4e, 0x44, 0x9a,
+  0x52, 0x1e, 0xed, 0xee, 0x48, 0x18, 0x09, 0xa1, 0x77, 0xf6, 0x2c, 0xaf, 0x1a, 0x25, 0xd3, 0x5f,
+  0xd4, 0xdb, 0x9d, 0x0f, 0xc1, 0xb0, 0x64, 0xd9, 0x10, 0xb1, 0x09, 0x55, 0xdd, 0xba, 0x1d, 0xf8,
+  0x8f, 0xf6, 0xb1, 0xc7, 0xe0, 0x8c, 0x4f, 0xd6, 0x39, 0xb0, 0xcb, 0x9d, 0x18, 0xe3, 0x97, 0xec,
+  0x29, 0x3b, 0xa3, 0x9c, 0x22, 0x1a, 0x62, 0xdd, 0x2c, 0x3a, 0x58, 0xb3, 0xd1, 0x03, 0xd0, 0x1a,
+  0xcd, 0x3b, 0xf6, 0xc2, 0x6e, 0xb0, 0xaf, 0x0a, 0xf9, 0xfa, 0x6e, 0x6a, 0xc1, 0x8e, 0xed, 0xab,
+  0x30, 0xd7, 0x4c, 0xda, 0x7c, 0x4a, 0x77, 0x75, 0x61, 0xa2, 0xea, 0x2a, 0x3b, 0xf4, 0x95, 0x15,
+  0xb9, 0xcf, 0xfd, 0x66, 0x0a, 0xad, 0x48, 0x22, 0x57, 0xa1, 0xc5, 0xe1, 0xb3, 0x35, 0xdd, 0x43,
+  0xaa, 0x56, 0x1d, 0xaf, 0xc4, 0x3b, 0xaf, 0x67, 0xf5, 0x00, 0x39, 0x82, 0x9e, 0x97, 0xb6, 0xa6,
+  0x3f, 0x12, 0xaf, 0xaa, 0x63, 0x6d, 0xc7, 0xcc, 0x10, 0x59, 0x0e, 0xfe, 0xc2, 0x1c, 0xfb, 0xcd,
+  0x51, 0xd6, 0x4d, 0xd2, 0x5c, 0x09, 0x7f, 0x5d, 0x37, 0xa2, 0x9a, 0x2e, 0x3b, 0xb0, 0x63, 0x58,
+  0x2a, 0x48, 0xfe, 0x4e, 0x22, 0xd0, 0xb6, 0x3d, 0x5f, 0x5d, 0x94, 0xc3, 0x64, 0xeb, 0x23, 0x20,
+  0xb7, 0x96, 0x20, 0xb7, 0x6e, 0x81, 0xdc, 0xda, 0x3c, 0xe4, 0xf6, 0x47, 0x40, 0x6e, 0x2f, 0x41,
+  0x6e, 0xdf, 0x02, 0xb9, 0xfd, 0x89, 0x90, 0xab, 0xd4, 0xb9, 0xcc, 0x6b, 0x80, 0x23, 0x5f, 0x8a,
+  0xea, 0x70, 0xcb, 0xf1, 0x7c, 0xf7, 0xdb, 0xef, 0xe6, 0x33, 0xae, 0x34, 0xe1, 0xc4, 0x5b, 0x58,
+  0xe9, 0x33, 0xa5, 0xbd, 0xf5, 0x87, 0x27, 0x11, 0x93, 0x72, 0xf5, 0x7d, 0xd0, 0xaf, 0x35, 0x90,
+  0xbe, 0x30, 0x06, 0x97, 0xd5, 0x2d, 0x3f, 0x8a, 0x55, 0x6b, 0x2b, 0xcb, 0x3a, 0x86, 0x04, 0x26,
+  0x53, 0x04, 0x85, 0x5c, 0x96, 0xd0, 0xe9, 0x98, 0xec, 0x06, 0x34, 0x63, 0x41, 0x8c, 0x13, 0x85,
+  0xbc, 0xd9, 0x5b, 0x5d, 0x6d, 0x21, 0x59, 0xbf, 0xd8, 0xf7, 0x6f, 0x7f, 0xf9, 0x71, 0xc5, 0xec,
+  0xba, 0x3a, 0x54, 0x58, 0xf3, 0x0b, 0xd2, 0xa9, 0xd8, 0x66, 0xa5, 0x16, 0x57, 0xc4, 0x4a, 0x68,
+  0xa8, 0x91, 0xfa, 0x97, 0xf8, 0x95, 0x98, 0x4d, 0xf5, 0xb1, 0xd6, 0x77, 0xbd, 0x66, 0xf1, 0x62,
+  0xca, 0x41, 0xd7, 0x6b, 0x1f, 0x22, 0x2f, 0xf6, 0x9a, 0x24, 0x5e, 0x2e, 0xf6, 0xb7, 0xb8, 0x58,
+  0x6f, 0xfb, 0xb0, 0xb1, 0x60, 0xfc, 0xe8, 0x70, 0xdf, 0x58, 0x6f, 0xed, 0x6f, 0xcc, 0xfc, 0xa2,
+  0xfd, 0xc3, 0xc6, 0xbe, 0xa1, 0xf5, 0xde, 0xe7, 0x58, 0xba, 0x26, 0xe0, 0x70, 0x51, 0xd5, 0xc6,
+  0x3c, 0x92, 0xa7, 0xf5, 0xaf, 0x6e, 0x57, 0x3b, 0x54, 0x6e, 0xc2, 0x42, 0xca, 0xd4, 0x7a, 0x8a,
+  0xc2, 0xce, 0x49, 0x8c, 0xec, 0x55, 0xef, 0x20, 0x96, 0x92, 0xab, 0x50, 0xeb, 0xc3, 0x04, 0x99,
+  0xd0, 0x5b, 0xde, 0xce, 0x24, 0x1f, 0xbe, 0x35, 0xf3, 0xfa, 0x42, 0x64, 0xfe, 0xb9, 0x14, 0x63,
+  0x96, 0xac, 0x66, 0x59, 0x0a, 0x5a, 0xb2, 0xf0, 0xb6, 0x23, 0xf5, 0xe6, 0x4f, 0x7b, 0x33, 0x82,
+  0x46, 0x48, 0x6e, 0x04, 0x3e, 0x85, 0xeb, 0x4e, 0xb5, 0xf9, 0x50, 0x36, 0x7d, 0x56, 0x76, 0xd0,
+  0x08, 0xb2, 0xfb, 0x07, 0xf8, 0xbb, 0x1f, 0x20, 0xd3, 0xb9, 0xfa, 0x4e, 0xf4, 0x69, 0xf4, 0xb7,
+  0xd7, 0x75, 0xf6, 0x29, 0xb6, 0x48, 0xaf, 0xc9, 0xf3, 0x47, 0x17, 0xc3, 0x77, 0x3f, 0xfc, 0x6c,
+  0xba, 0x7f, 0x82, 0x90, 0x5c, 0x50, 0xa8, 0x3e, 0xc3, 0x8f, 0x80, 0xff, 0x0b, 0xc9, 0xe5, 0x60,
+  0x3d, 0x8e, 0x4b, 0xf5, 0x01, 0x28, 0x34, 0x1d, 0x25, 0x50, 0xaa, 0x17, 0x7b, 0xed, 0xdb, 0xc1,
+  0x7a, 0x01, 0xd0, 0xf6, 0xf6, 0xad, 0xa3, 0x25, 0xfe, 0xe2, 0xde, 0x40, 0xdb, 0x13, 0x80, 0x4f,
+  0xe6, 0x2d, 0x65, 0x7c, 0xfe, 0x4c, 0x67, 0x93, 0x6a, 0x9c, 0xbe, 0xca, 0x9f, 0x03, 0x33, 0x2d,
+  0xd0, 0xe5, 0x25, 0x64, 0x69, 0xd2, 0xde, 0xe4, 0x95, 0xbb, 0x68, 0x4d, 0x2a, 0x93, 0xa6, 0x76,
+  0xbc, 0x3a, 0x1b, 0x16, 0xca, 0xbf, 0xd5, 0x5f, 0xec, 0x81, 0x14, 0x4d, 0x15, 0xd6, 0xe0, 0x79,
+  0xf6, 0xcc, 0x2f, 0xcf, 0x56, 0x4a, 0x31, 0x3a, 0x4b, 0xc4, 0x35, 0xb8, 0xcb, 0x71, 0xfd, 0x74,
+  0x74, 0x54, 0x28, 0x59, 0xa6, 0x89, 0x92, 0xe1, 0xc2, 0xe5, 0xe4, 0x77, 0xe6, 0x6e, 0xf2, 0xa8,
+  0x49, 0x61, 0x7f, 0xd4, 0x1a, 0x1b, 0x23, 0xb9, 0x9e, 0xb9, 0xa4, 0xcc, 0xb1, 0x63, 0xfa, 0xdb,
+  0x7b, 0xd7, 0x7f, 0x00, 0x99, 0xf4, 0x13, 0xf8, 0x8f, 0x15, 0x00, 0x00,
+};
+
+static const DashboardAsset DASHBOARD_ASSETS[] = {
+  { "/dashboard.css", "text/css", "\"f6fd05f29c090186\"", DASHBOARD_CSS_GZ, sizeof(DASHBOARD_CSS_GZ), 13087, true },
+  { "/dashboard.js", "application/javascript", "\"81ae4b2fd49f3444\"", DASHBOARD_JS_GZ, sizeof(DASHBOARD_JS_GZ), 31574, true },
+  { "/", "text/html; charset=utf-8", "\"5d1d9b411703d377\"", DASHBOARD_INDEX_GZ, sizeof(DASHBOARD_INDEX_GZ), 5519, false },
+};
+static const uint8_t DASHBOARD_ASSET_COUNT = sizeof(DASHBOARD_ASSETS) / sizeof(DASHBOARD_ASSETS[0]);
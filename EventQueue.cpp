@@ -0,0 +1,211 @@
+// File: EventQueue.cpp
+
+#include "EventQueue.h"
+#include "MQTTHandler.h"
+
+// Ring: ring[ringHead] ist das älteste Ereignis im RAM. Ausgelagerte Blöcke
+// sind immer älter als der Ring und werden zuerst nachgeliefert; ihr Stand
+// (spillHead/spillCount) liegt mit in NVS und überlebt damit einen Reboot.
+
+static const char* const TYPE_NAMES[] = { "presence", "zone" };
+
+static StoredEvent   ring[EVENT_QUEUE_LEN];
+static uint16_t      ringHead  = 0;
+static uint16_t      ringCount = 0;
+static uint32_t      nextSeq   = 0;
+static uint32_t      bootId    = 0;
+static uint32_t      droppedCount = 0;
+static uint32_t      spilledCount = 0;
+static unsigned long lastFlush = 0;
+
+#if EVENT_SPILL_MAX_BLOBS > 0
+static const char*   SPILL_NS = "evspill";
+static Preferences   spillPrefs;   // eigene Instanz: kein begin/end quer zum Config-Code
+static StoredEvent   spillOut[EVENT_SPILL_BATCH];   // Schreibpuffer
+static StoredEvent   spillBuf[EVENT_SPILL_BATCH];   // gerade ausgelieferter Block
+static uint8_t       spillHead   = 0;               // Slot des ältesten Blocks
+static uint8_t       spillCount  = 0;
+static uint8_t       spillLoaded = 0;               // Einträge in spillBuf (0 = nichts geladen)
+static uint8_t       spillPos    = 0;               // nächster auszuliefernder Eintrag
+
+static void spillKey(uint8_t slot, char* key, size_t keysize) {
+  snprintf(key, keysize, "b%u", slot);
+}
+
+static void saveSpillState() {
+  spillPrefs.putUChar("head", spillHead);
+  spillPrefs.putUChar("count", spillCount);
+}
+
+// Älteste EVENT_SPILL_BATCH Einträge des Rings als ein Blob ablegen
+static bool spillOldest() {
+  if (spillCount >= EVENT_SPILL_MAX_BLOBS || ringCount < EVENT_SPILL_BATCH) return false;
+
+  for (uint8_t i = 0; i < EVENT_SPILL_BATCH; i++) {
+    spillOut[i] = ring[(ringHead + i) % EVENT_QUEUE_LEN];
+  }
+  char key[8];
+  spillKey((spillHead + spillCount) % EVENT_SPILL_MAX_BLOBS, key, sizeof(key));
+  spillPrefs.begin(SPILL_NS, false);
+  bool ok = spillPrefs.putBytes(key, spillOut, sizeof(spillOut)) == sizeof(spillOut);
+  if (ok) {
+    spillCount++;
+    saveSpillState();
+  }
+  spillPrefs.end();
+  if (!ok) {
+    logPrintln("Events: NVS-Auslagerung fehlgeschlagen");
+    return false;
+  }
+  ringHead = (ringHead + EVENT_SPILL_BATCH) % EVENT_QUEUE_LEN;
+  ringCount -= EVENT_SPILL_BATCH;
+  spilledCount += EVENT_SPILL_BATCH;
+  return true;
+}
+
+static bool loadSpillBlock() {
+  char key[8];
+  spillKey(spillHead, key, sizeof(key));
+  spillPrefs.begin(SPILL_NS, true);
+  size_t len = spillPrefs.getBytes(key, spillBuf, sizeof(spillBuf));
+  spillPrefs.end();
+  spillLoaded = len / sizeof(StoredEvent);
+  spillPos = 0;
+  return spillLoaded > 0;
+}
+
+static void releaseSpillBlock() {
+  char key[8];
+  spillKey(spillHead, key, sizeof(key));
+  spillHead = (spillHead + 1) % EVENT_SPILL_MAX_BLOBS;
+  spillCount--;
+  spillLoaded = 0;
+  spillPos = 0;
+  spillPrefs.begin(SPILL_NS, false);
+  spillPrefs.remove(key);
+  saveSpillState();
+  spillPrefs.end();
+}
+#endif
+
+void eventQueueInit() {
+  bootId = esp_random();
+#if EVENT_SPILL_MAX_BLOBS > 0
+  spillPrefs.begin(SPILL_NS, true);
+  spillHead  = spillPrefs.getUChar("head", 0);
+  spillCount = spillPrefs.getUChar("count", 0);
+  spillPrefs.end();
+  if (spillHead >= EVENT_SPILL_MAX_BLOBS || spillCount > EVENT_SPILL_MAX_BLOBS) {
+    // Anderes EVENT_SPILL_MAX_BLOBS im alten Image: Stand verwerfen
+    spillHead = 0;
+    spillCount = 0;
+  }
+  if (spillCount) {
+    logPrintf("Events: %u ausgelagerte Blöcke aus vorherigem Boot\n", spillCount);
+  }
+#endif
+}
+
+const char* eventTypeName(EventType type) {
+  return type < sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]) ? TYPE_NAMES[type] : "unknown";
+}
+
+bool publishEvent(EventType type, const char* body) {
+  bool kept = true;
+  if (ringCount == EVENT_QUEUE_LEN) {
+#if EVENT_SPILL_MAX_BLOBS > 0
+    kept = spillOldest();
+#else
+    kept = false;
+#endif
+    if (!kept) {
+      ringHead = (ringHead + 1) % EVENT_QUEUE_LEN;
+      ringCount--;
+      droppedCount++;
+    }
+  }
+
+  StoredEvent& ev = ring[(ringHead + ringCount) % EVENT_QUEUE_LEN];
+  ev.seq  = nextSeq++;
+  ev.boot = bootId;
+  ev.ts   = millis();
+  ev.type = type;
+  strncpy(ev.body, body ? body : "", sizeof(ev.body) - 1);
+  ev.body[sizeof(ev.body) - 1] = '\0';
+  ringCount++;
+  return kept;
+}
+
+// Ältestes noch nicht ausgeliefertes Ereignis, nullptr wenn leer
+static const StoredEvent* peekEvent() {
+#if EVENT_SPILL_MAX_BLOBS > 0
+  while (spillCount) {
+    if (spillLoaded || loadSpillBlock()) return &spillBuf[spillPos];
+    // Blob fehlt oder ist kaputt: überspringen statt hängen zu bleiben
+    logPrintln("Events: ausgelagerter Block unlesbar, verworfen");
+    droppedCount += EVENT_SPILL_BATCH;
+    releaseSpillBlock();
+  }
+#endif
+  return ringCount ? &ring[ringHead] : nullptr;
+}
+
+static void popEvent() {
+#if EVENT_SPILL_MAX_BLOBS > 0
+  if (spillCount) {
+    if (++spillPos >= spillLoaded) releaseSpillBlock();
+    return;
+  }
+#endif
+  ringHead = (ringHead + 1) % EVENT_QUEUE_LEN;
+  ringCount--;
+}
+
+static bool sendEvent(const StoredEvent& ev) {
+  char payload[EVENT_BODY_LEN + 128];
+  size_t n = snprintf(payload, sizeof(payload), "{\"seq\":%lu,\"boot\":\"%08lx\",\"ts\":%lu",
+                      (unsigned long)ev.seq, (unsigned long)ev.boot, (unsigned long)ev.ts);
+  // Alter nur innerhalb desselben Boots bestimmbar (keine Wanduhr)
+  if (ev.boot == bootId) {
+    n += snprintf(payload + n, sizeof(payload) - n, ",\"age\":%lu",
+                  (unsigned long)(millis() - ev.ts));
+  }
+  snprintf(payload + n, sizeof(payload) - n, ",\"type\":\"%s\"%s%s}",
+           eventTypeName((EventType)ev.type), ev.body[0] ? "," : "", ev.body);
+
+  char topic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("event", topic, sizeof(topic));
+  return safePublish(topic, payload);
+}
+
+void eventQueueFlush() {
+  if (!mqttConnected()) return;
+  unsigned long now = millis();
+  if (now - lastFlush < EVENT_FLUSH_INTERVAL_MS) return;
+  lastFlush = now;
+
+  for (uint8_t i = 0; i < EVENT_FLUSH_BURST; i++) {
+    const StoredEvent* ev = peekEvent();
+    if (!ev) break;
+    // Fehlschlag: Ereignis bleibt vorne, nächster Versuch im nächsten Intervall
+    if (!sendEvent(*ev)) break;
+    popEvent();
+  }
+}
+
+uint32_t eventQueuePending() {
+  uint32_t pending = ringCount;
+#if EVENT_SPILL_MAX_BLOBS > 0
+  pending += (uint32_t)spillCount * EVENT_SPILL_BATCH;
+  if (spillLoaded) pending -= EVENT_SPILL_BATCH - (spillLoaded - spillPos);
+#endif
+  return pending;
+}
+
+uint32_t eventQueueDropped() {
+  return droppedCount;
+}
+
+uint32_t eventQueueSpilled() {
+  return spilledCount;
+}
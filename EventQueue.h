@@ -0,0 +1,37 @@
+// File: EventQueue.h
+
+#pragma once
+#include "Config.h"
+
+// Store-and-forward für wichtige Ereignisse (Präsenz an/aus, Zonenwechsel;
+// Befehls-ACKs gehen nur live auf <topic>/ack). Jedes Ereignis bekommt beim Entstehen Sequenznummer und
+// Zeitstempel und landet in einem vorab angelegten Ring; eventQueueFlush()
+// liefert die Einträge gedrosselt und in Reihenfolge an <topic>/event aus,
+// sobald MQTT wieder oben ist. Läuft der Ring voll, wandern die ältesten
+// Einträge blockweise in NVS (EVENT_SPILL_MAX_BLOBS > 0), sonst wird der
+// älteste verworfen und gezählt.
+//
+// Nur aus dem Loop aufrufen. NVS über eine eigene Preferences-Instanz
+// ("evspill"), unabhängig vom globalen prefs der Konfiguration.
+
+enum EventType : uint8_t {
+  EVENT_PRESENCE,
+  EVENT_ZONE
+};
+
+struct StoredEvent {
+  uint32_t seq;
+  uint32_t boot;                // Boot-ID, ts ist nur innerhalb eines Boots vergleichbar
+  uint32_t ts;                  // millis() beim Entstehen
+  uint8_t  type;                // EventType
+  char     body[EVENT_BODY_LEN]; // JSON-Member ohne Klammern, z. B. "present":true
+};
+
+void eventQueueInit();                                // Boot-ID, Spill-Stand aus NVS
+bool publishEvent(EventType type, const char* body);  // false = ältestes Ereignis verdrängt
+void eventQueueFlush();                               // pro Loop, publiziert max. EVENT_FLUSH_BURST je Intervall
+const char* eventTypeName(EventType type);
+
+uint32_t eventQueuePending();    // Ring + NVS
+uint32_t eventQueueDropped();
+uint32_t eventQueueSpilled();    // nach NVS ausgelagerte Ereignisse (gesamt)
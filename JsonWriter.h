@@ -0,0 +1,179 @@
+// File: JsonWriter.h
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+// Vorwärts-JSON-Writer für die heißen Publish-Pfade: schreibt direkt in den
+// Ausgabepuffer, ohne Dokument dazwischen (ArduinoJson hält DOM + Puffer,
+// also etwa doppelt so viel Stack). Kommas setzt der Writer selbst; pro
+// Verschachtelungsebene ein Bit, max. 32 Ebenen.
+//
+// Läuft der Puffer über, bleibt der Inhalt bis dahin nullterminiert und
+// ok() liefert false – der Aufrufer verwirft die Nachricht dann.
+//
+//   JsonWriter w(buf, sizeof(buf));
+//   w.beginObject().field("count", 2).beginArray("ids").value(3).value(7).endArray().endObject();
+//   if (w.ok()) safePublish(topic, buf);
+
+class JsonWriter {
+public:
+  JsonWriter(char* buf, size_t size) : out(buf), cap(size) {
+    if (cap) out[0] = '\0';
+  }
+
+  JsonWriter& beginObject(const char* key = nullptr) { return open(key, '{'); }
+  JsonWriter& endObject()                            { return close('}'); }
+  JsonWriter& beginArray(const char* key = nullptr)  { return open(key, '['); }
+  JsonWriter& endArray()                             { return close(']'); }
+
+  // Objekt-Member
+  JsonWriter& field(const char* key, const char* v)    { member(key); return string(v); }
+  JsonWriter& field(const char* key, bool v)           { member(key); return put(v ? "true" : "false"); }
+  JsonWriter& field(const char* key, int v)            { member(key); return integer(v); }
+  JsonWriter& field(const char* key, long v)           { member(key); return integer(v); }
+  JsonWriter& field(const char* key, unsigned int v)   { member(key); return uinteger(v); }
+  JsonWriter& field(const char* key, unsigned long v)  { member(key); return uinteger(v); }
+  JsonWriter& field(const char* key, float v, uint8_t decimals = 2) { member(key); return number(v, decimals); }
+  JsonWriter& rawField(const char* key, const char* json) { member(key); return put(json); }  // bereits serialisiert
+
+  // Array-Elemente
+  JsonWriter& value(const char* v)   { element(); return string(v); }
+  JsonWriter& value(long v)          { element(); return integer(v); }
+  JsonWriter& value(int v)           { element(); return integer(v); }
+
+  bool        ok() const     { return !overflow; }
+  size_t      length() const { return len; }
+  size_t      remaining() const { return cap > len + 1 ? cap - len - 1 : 0; }
+  const char* c_str() const  { return out; }
+
+private:
+  char*    out;
+  size_t   cap;
+  size_t   len = 0;
+  uint32_t needComma = 0;     // Bit d: auf Ebene d folgt ein Komma
+  uint8_t  depth = 0;
+  bool     overflow = false;
+
+  JsonWriter& putChar(char c) {
+    if (len + 1 < cap) {
+      out[len++] = c;
+      out[len] = '\0';
+    } else {
+      overflow = true;
+    }
+    return *this;
+  }
+
+  JsonWriter& put(const char* s) { return putN(s, strlen(s)); }
+
+  JsonWriter& putN(const char* s, size_t n) {
+    if (len + n < cap) {
+      memcpy(out + len, s, n);
+      len += n;
+      out[len] = '\0';
+    } else {
+      overflow = true;
+    }
+    return *this;
+  }
+
+  void element() {
+    uint32_t bit = 1UL << depth;
+    if (needComma & bit) putChar(',');
+    needComma |= bit;
+  }
+
+  void member(const char* key) {
+    element();
+    string(key);
+    putChar(':');
+  }
+
+  JsonWriter& open(const char* key, char c) {
+    if (key) member(key);
+    else if (depth) element();
+    putChar(c);
+    if (depth < 31) depth++;
+    needComma &= ~(1UL << depth);
+    return *this;
+  }
+
+  JsonWriter& close(char c) {
+    if (depth) depth--;
+    return putChar(c);
+  }
+
+  // Unkritische Abschnitte am Stück kopieren, nur Sonderzeichen einzeln
+  JsonWriter& string(const char* s) {
+    putChar('"');
+    const char* run = s;
+    for (; s && *s; s++) {
+      unsigned char c = (unsigned char)*s;
+      if (c != '"' && c != '\\' && c >= 0x20) continue;
+      putN(run, s - run);
+      run = s + 1;
+      if (c < 0x20) {
+        char esc[7];
+        snprintf(esc, sizeof(esc), "\\u%04x", c);
+        put(esc);
+      } else {
+        putChar('\\');
+        putChar((char)c);
+      }
+    }
+    if (run) putN(run, s - run);
+    return putChar('"');
+  }
+
+  JsonWriter& uinteger(unsigned long v) {
+    char tmp[24];
+    char* p = tmp + sizeof(tmp) - 1;
+    *p = '\0';
+    do {
+      *--p = (char)('0' + v % 10);
+      v /= 10;
+    } while (v);
+    return put(p);
+  }
+
+  JsonWriter& integer(long v) {
+    if (v < 0) {
+      putChar('-');
+      return uinteger(0UL - (unsigned long)v);
+    }
+    return uinteger((unsigned long)v);
+  }
+
+  // Festkomma statt printf (spart dessen Stack), nachlaufende Nullen
+  // entfernt: 2.10 → 2.1, 45.00 → 45
+  JsonWriter& number(float v, uint8_t decimals) {
+    if (decimals > 6) decimals = 6;
+    uint32_t scale = 1;
+    for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+    if (v != v || v > 2.0e9f / scale || v < -2.0e9f / scale) return put("null");
+
+    bool neg = v < 0.0f;
+    uint32_t fixed = (uint32_t)((neg ? -v : v) * scale + 0.5f);
+    uint32_t frac = fixed % scale;
+    if (neg && fixed) putChar('-');
+    uinteger((unsigned long)(fixed / scale));
+    if (!frac) return *this;
+
+    char tmp[8];
+    uint8_t n = decimals;
+    while (frac % 10 == 0) {
+      frac /= 10;
+      n--;
+    }
+    tmp[0] = '.';
+    tmp[n + 1] = '\0';
+    for (uint8_t i = n; i > 0; i--) {
+      tmp[i] = (char)('0' + frac % 10);
+      frac /= 10;
+    }
+    return put(tmp);
+  }
+};
@@ -0,0 +1,162 @@
+// File: LoopProfiler.cpp
+
+#include "LoopProfiler.h"
+#include <stdarg.h>
+
+static const char* const STAGE_NAMES[LOOP_STAGE_COUNT] = {
+  "wifi", "ota", "snapshot", "web", "mqttConnect", "mqttLoop", "publish", "commands", "radarCheck"
+};
+
+struct StageStats {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t sumCycles;
+};
+
+struct SlowIteration {
+  uint32_t  totalUs;
+  uint32_t  stageUs;
+  uint32_t  atMs;       // millis() am Iterationsende
+  LoopStage stage;      // langsamste Stufe der Iteration
+};
+
+static StageStats       stageStats[LOOP_STAGE_COUNT];
+static MetricsHistogram iterationHist;
+static SlowIteration    slowest[LOOP_PROFILER_TOP_N];   // absteigend sortiert
+static uint8_t          slowestCount = 0;
+
+// Laufende Iteration
+static bool     running = false;
+static uint32_t markCycles = 0;
+static uint32_t iterCycles[LOOP_STAGE_COUNT];
+
+// Für andere Tasks (HTTP-Handler im async_tcp-Task) im Loop gebaute Kopie
+static char          sharedJson[LOOP_PROFILER_JSON_SIZE];
+static size_t        sharedLen = 0;
+static bool          sharedStale = true;
+static unsigned long sharedAtMs = 0;
+static portMUX_TYPE  sharedMux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t cyclesToUs(uint64_t cycles) {
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  return (uint32_t)(cycles / (mhz ? mhz : 240));
+}
+
+void loopProfilerBegin() {
+  // Nicht abgeschlossene Iterationen (z. B. return während OTA) verwerfen
+  memset(iterCycles, 0, sizeof(iterCycles));
+  markCycles = ESP.getCycleCount();
+  running = true;
+}
+
+void loopProfilerMark(LoopStage stage) {
+  if (!running || stage >= LOOP_STAGE_COUNT) return;
+  uint32_t now = ESP.getCycleCount();
+  iterCycles[stage] += now - markCycles;
+  markCycles = now;
+}
+
+static void recordSlow(uint32_t totalUs, LoopStage stage, uint32_t stageUs) {
+  if (slowestCount == LOOP_PROFILER_TOP_N && totalUs <= slowest[slowestCount - 1].totalUs) return;
+  uint8_t pos = (slowestCount < LOOP_PROFILER_TOP_N) ? slowestCount++ : LOOP_PROFILER_TOP_N - 1;
+  while (pos > 0 && slowest[pos - 1].totalUs < totalUs) {
+    slowest[pos] = slowest[pos - 1];
+    pos--;
+  }
+  slowest[pos] = SlowIteration{ totalUs, stageUs, (uint32_t)millis(), stage };
+}
+
+void loopProfilerEnd() {
+  if (!running) return;
+  running = false;
+
+  uint64_t total = 0;
+  LoopStage worst = LOOP_WIFI;
+  for (uint8_t s = 0; s < LOOP_STAGE_COUNT; s++) {
+    uint32_t c = iterCycles[s];
+    StageStats& st = stageStats[s];
+    if (st.count == 0 || c < st.minCycles) st.minCycles = c;
+    if (c > st.maxCycles) st.maxCycles = c;
+    st.sumCycles += c;
+    st.count++;
+    total += c;
+    if (c > iterCycles[worst]) worst = (LoopStage)s;
+  }
+  uint32_t totalUs = cyclesToUs(total);
+  metricsHistRecord(iterationHist, totalUs);
+  recordSlow(totalUs, worst, cyclesToUs(iterCycles[worst]));
+
+  unsigned long now = millis();
+  if (!sharedStale && now - sharedAtMs < LOOP_PROFILER_SHARE_MS) return;
+  // Außerhalb der Sperre bauen, nur das Umkopieren läuft kritisch
+  static char json[LOOP_PROFILER_JSON_SIZE];
+  size_t len = loopProfilerJson(json, sizeof(json));
+  portENTER_CRITICAL(&sharedMux);
+  memcpy(sharedJson, json, len + 1);
+  sharedLen = len;
+  portEXIT_CRITICAL(&sharedMux);
+  sharedStale = false;
+  sharedAtMs = now;
+}
+
+void loopProfilerReset() {
+  memset(stageStats, 0, sizeof(stageStats));
+  memset(&iterationHist, 0, sizeof(iterationHist));
+  slowestCount = 0;
+  running = false;
+  sharedStale = true;
+}
+
+// Hängt formatierten Text an; false, wenn der Puffer nicht reicht
+static bool append(char* buf, size_t bufsize, size_t& n, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int w = vsnprintf(buf + n, bufsize - n, fmt, args);
+  va_end(args);
+  if (w < 0 || (size_t)w >= bufsize - n) return false;
+  n += w;
+  return true;
+}
+
+size_t loopProfilerJson(char* buf, size_t bufsize) {
+  if (!buf || bufsize == 0) return 0;
+  size_t n = 0;
+  LatencySummary it;
+  metricsHistSummary(iterationHist, it);
+  bool ok = append(buf, bufsize, n,
+                   "{\"iterations\":{\"n\":%lu,\"p50\":%lu,\"p95\":%lu,\"p99\":%lu,\"max\":%lu},\"stages\":{",
+                   (unsigned long)it.count, (unsigned long)it.p50, (unsigned long)it.p95,
+                   (unsigned long)it.p99, (unsigned long)it.max);
+  for (uint8_t s = 0; ok && s < LOOP_STAGE_COUNT; s++) {
+    const StageStats& st = stageStats[s];
+    uint32_t avgUs = st.count ? cyclesToUs(st.sumCycles / st.count) : 0;
+    ok = append(buf, bufsize, n, "%s\"%s\":{\"min\":%lu,\"avg\":%lu,\"max\":%lu}",
+                s ? "," : "", STAGE_NAMES[s],
+                (unsigned long)cyclesToUs(st.minCycles), (unsigned long)avgUs,
+                (unsigned long)cyclesToUs(st.maxCycles));
+  }
+  if (ok) ok = append(buf, bufsize, n, "},\"slowest\":[");
+  for (uint8_t i = 0; ok && i < slowestCount; i++) {
+    const SlowIteration& si = slowest[i];
+    ok = append(buf, bufsize, n, "%s{\"us\":%lu,\"stage\":\"%s\",\"stageUs\":%lu,\"atMs\":%lu}",
+                i ? "," : "", (unsigned long)si.totalUs, STAGE_NAMES[si.stage],
+                (unsigned long)si.stageUs, (unsigned long)si.atMs);
+  }
+  if (ok) ok = append(buf, bufsize, n, "]}");
+  if (!ok) {
+    buf[0] = '\0';
+    return 0;
+  }
+  return n;
+}
+
+size_t loopProfilerCopy(char* buf, size_t bufsize) {
+  if (!buf || bufsize == 0) return 0;
+  portENTER_CRITICAL(&sharedMux);
+  size_t len = sharedLen < bufsize ? sharedLen : 0;
+  memcpy(buf, sharedJson, len);
+  portEXIT_CRITICAL(&sharedMux);
+  buf[len] = '\0';
+  return len;
+}
@@ -0,0 +1,39 @@
+// File: LoopProfiler.h
+
+#pragma once
+#include "Config.h"
+#include "Metrics.h"
+
+// Zeitmessung der loop()-Stufen mit dem CPU-Zykluszähler. Jede Stufe
+// hält min/avg/max, die Gesamtdauer einer Iteration (ohne delay) landet
+// in einem Histogramm, die langsamsten Iterationen werden mit der
+// verursachenden Stufe festgehalten. Nur vom Loop-Task benutzen; andere
+// Tasks lesen die Kopie, die loopProfilerEnd() jede Sekunde ablegt.
+// Einzelne Stufen über ~17 s (2^32 Zyklen @ 240 MHz) laufen über.
+
+#define LOOP_PROFILER_TOP_N 5
+#define LOOP_PROFILER_JSON_SIZE 1280
+#define LOOP_PROFILER_SHARE_MS  1000
+
+enum LoopStage : uint8_t {
+  LOOP_WIFI,            // BOOT-Taste, maintainWiFi()
+  LOOP_OTA,             // ArduinoOTA.handle()
+  LOOP_SNAPSHOT,        // snapshotCacheUpdate(), radarHistoryTick()
+  LOOP_WEB,             // handleWebServer()
+  LOOP_MQTT_CONNECT,    // mqttReconnect()
+  LOOP_MQTT_LOOP,       // mqttClient.loop()
+  LOOP_PUBLISH,         // Radar-, Zonen-, Status-Publish
+  LOOP_COMMANDS,        // radarCommandDispatch(), handleMqttCommands()
+  LOOP_RADAR_CHECK,     // checkRadarConnection() inkl. restartRadarSerial()
+  LOOP_STAGE_COUNT
+};
+
+void loopProfilerBegin();                 // Iterationsbeginn
+void loopProfilerMark(LoopStage stage);   // Zeit seit der letzten Marke → stage
+void loopProfilerEnd();                   // Iteration abschließen
+void loopProfilerReset();
+
+// {"iterations":{n,p50,p95,p99,max},"stages":{...},"slowest":[...]}
+size_t loopProfilerJson(char* buf, size_t bufsize);
+// Beliebiger Task: zuletzt abgelegte Kopie (höchstens LOOP_PROFILER_SHARE_MS alt)
+size_t loopProfilerCopy(char* buf, size_t bufsize);
@@ -2,11 +2,18 @@
 
 #include "MQTTHandler.h"
 #include <string.h>
+#include <atomic>
 #include "Config.h"
 #include "RadarHandler.h"
+#include "RadarRecorder.h"
+#include "RadarZones.h"
+#include "Metrics.h"
+#include "LoopProfiler.h"
+#include "EventQueue.h"
+#include "RadarBinary.h"
 #include "WebServerHandler.h"
 
-static void logMqttDiag(const char* prefix, const char* topic, const char* payload, bool retain) {
+static void logMqttDiag(const char* prefix, const char* topic, size_t len, bool retain) {
   char bssidBuf[18];
   bssidBuf[0] = '\0';
   if (WiFi.status() == WL_CONNECTED && WiFi.BSSID() != nullptr) {
@@ -21,13 +28,12 @@ static void logMqttDiag(const char* prefix, const char* topic, const char* paylo
     bssidBuf[sizeof(bssidBuf) - 1] = '\0';
   }
 
-  size_t len = payload ? strlen(payload) : 0;
   logPrintf("%s topic=%s len=%u retain=%d\n",
             prefix,
             topic ? topic : "(null)",
             static_cast<unsigned int>(len),
             retain ? 1 : 0);
-  logPrintf("MQTT state=%d connected=%d\n", mqttClient.state(), mqttClient.connected() ? 1 : 0);
+  logPrintf("MQTT link=%s rc=%d\n", mqttLinkName(mqttLinkState()), mqttLastState());
   logPrintf("WiFi status=%d RSSI=%d CH=%d BSSID=%s IP=%s\n",
             WiFi.status(),
             WiFi.RSSI(),
@@ -54,29 +60,49 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
 }
 
 bool safePublish(const char* topic, const char* payload) {
-  if (!mqttClient.connected()) {
-    logMqttDiag("MQTT publish blocked (disconnected)", topic, payload, false);
+  if (!mqttConnected()) {
+    logMqttDiag("MQTT publish blocked (disconnected)", topic, strlen(payload), false);
     return false;
   }
   if (!mqttClient.publish(topic, payload)) {
-    logMqttDiag("MQTT publish post (failed)", topic, payload, false);
+    logMqttDiag("MQTT publish post (failed)", topic, strlen(payload), false);
+    return false;
+  }
+  return true;
+}
+
+bool safePublish(const char* topic, const uint8_t* payload, size_t len) {
+  if (!mqttConnected()) {
+    logMqttDiag("MQTT publish blocked (disconnected)", topic, len, false);
+    return false;
+  }
+  if (!mqttClient.publish(topic, payload, len)) {
+    logMqttDiag("MQTT publish post (failed)", topic, len, false);
     return false;
   }
   return true;
 }
 
 bool safePublishRetain(const char* topic, const char* payload) {
-  if (!mqttClient.connected()) {
-    logMqttDiag("MQTT retain publish blocked (disconnected)", topic, payload, true);
+  if (!mqttConnected()) {
+    logMqttDiag("MQTT retain publish blocked (disconnected)", topic, strlen(payload), true);
     return false;
   }
   if (!mqttClient.publish(topic, payload, true)) {
-    logMqttDiag("MQTT retain publish post (failed)", topic, payload, true);
+    logMqttDiag("MQTT retain publish post (failed)", topic, strlen(payload), true);
     return false;
   }
   return true;
 }
 
+void publishAck(const char* msg) {
+  char topic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("ack", topic, sizeof(topic));
+  // Nur live: ein nach dem Reconnect nachgeliefertes ACK wäre veraltet
+  // und belegte Ring und NVS-Budget der Präsenz-/Zonen-Ereignisse
+  safePublish(topic, msg);
+}
+
 void processMqttCommand(const String& cmd) {
   logPrint("MQTT CMD: ");
   logPrintln(cmd);
@@ -85,11 +111,11 @@ void processMqttCommand(const String& cmd) {
   buildMqttTopic("ack", ackTopic, sizeof(ackTopic));
 
   if (cmd == "config") {
-    safePublish(ackTopic, "config OK");
+    publishAck("config OK");
     startConfigPortal = true;
   }
   else if (cmd == "reboot") {
-    safePublish(ackTopic, "reboot OK");
+    publishAck("reboot OK");
     rebootRequested = true;
     rebootRequestedAt = millis();
   }
@@ -99,17 +125,17 @@ void processMqttCommand(const String& cmd) {
   else if (cmd.startsWith("setRange:")) {
     String val = cmd.substring(9);
     if (val.length() == 0) {
-      safePublish(ackTopic, "setRange ERROR: invalid value");
+      publishAck("setRange ERROR: invalid value");
       return;
     }
     char* endPtr = nullptr;
     float v = strtof(val.c_str(), &endPtr);
     if (endPtr == val.c_str() || *endPtr != '\0') {
-      safePublish(ackTopic, "setRange ERROR: invalid value");
+      publishAck("setRange ERROR: invalid value");
     } else if (v > 0.5f && v <= 15.0f) {
       setMaxRadarRange(v);
     } else {
-      safePublish(ackTopic, "setRange ERROR: invalid value");
+      publishAck("setRange ERROR: invalid value");
     }
   }
   else if (cmd.startsWith("setHold:")) {
@@ -117,33 +143,158 @@ void processMqttCommand(const String& cmd) {
     if (v >= 0 && v <= 10000) {
       setHoldInterval(v);
     } else {
-      safePublish(ackTopic, "setHold ERROR: invalid value");
+      publishAck("setHold ERROR: invalid value");
+    }
+  }
+  else if (cmd.startsWith("setFilter:")) {
+    RadarFilterMode mode;
+    if (radarFilterFromName(cmd.substring(10).c_str(), mode)) {
+      radarPipelineSetFilter(mode);
+      char msg[32];
+      snprintf(msg, sizeof(msg), "setFilter OK: %s", radarFilterName(mode));
+      publishAck(msg);
+    } else {
+      publishAck("setFilter ERROR: use ema or kalman");
     }
   }
+  else if (cmd == "setPublish:interval" || cmd == "setPublish:change") {
+    g_publishOnChange = cmd.endsWith("change");
+    publishAck(g_publishOnChange ? "setPublish OK: change" : "setPublish OK: interval");
+  }
+  else if (cmd.startsWith("setPayload:")) {
+    RadarPayloadMode mode;
+    if (radarPayloadFromName(cmd.substring(11).c_str(), mode)) {
+      g_payloadMode = mode;
+      char msg[32];
+      snprintf(msg, sizeof(msg), "setPayload OK: %s", radarPayloadName(mode));
+      publishAck(msg);
+    } else {
+      publishAck("setPayload ERROR: use json, bin or both");
+    }
+  }
+  else if (cmd.startsWith("setDeadband:")) {
+    // setDeadband:<mm>,<deg>,<cm/s>
+    char* endPtr = nullptr;
+    String val = cmd.substring(12);
+    const char* p = val.c_str();
+    long mm = strtol(p, &endPtr, 10);
+    float deg = (*endPtr == ',') ? strtof(endPtr + 1, &endPtr) : -1.0f;
+    long spd = (*endPtr == ',') ? strtol(endPtr + 1, &endPtr, 10) : -1;
+    if (*endPtr != '\0' || mm < 0 || mm > 5000 || deg < 0.0f || deg > 180.0f || spd < 0 || spd > 1000) {
+      publishAck("setDeadband ERROR: use <mm>,<deg>,<cm/s>");
+    } else {
+      g_deadbandMm       = (uint16_t)mm;
+      g_deadbandCdeg     = (uint16_t)lroundf(deg * 100.0f);
+      g_deadbandSpeedCmS = (uint16_t)spd;
+      char msg[64];
+      snprintf(msg, sizeof(msg), "setDeadband OK: %ldmm %.1fdeg %ldcm/s", mm, deg, spd);
+      publishAck(msg);
+    }
+  }
+  else if (cmd.startsWith("setHeartbeat:")) {
+    long v = cmd.substring(13).toInt();
+    if (v >= 1000 && v <= 3600000) {
+      g_heartbeatMs = (uint32_t)v;
+      publishAck("setHeartbeat OK");
+    } else {
+      publishAck("setHeartbeat ERROR: invalid value");
+    }
+  }
+  else if (cmd.startsWith("zone:set:")) {
+    // zone:set:<name>:<x,y;x,y;...>
+    String rest = cmd.substring(9);
+    int sep = rest.indexOf(':');
+    String name = sep > 0 ? rest.substring(0, sep) : String("");
+    if (sep > 0 && radarZoneSet(name.c_str(), rest.substring(sep + 1).c_str())) {
+      publishAck(("zone OK: " + name).c_str());
+    } else {
+      publishAck("zone ERROR: use zone:set:<name>:<x,y;x,y;x,y...> (3-8 points, max 8 zones)");
+    }
+  }
+  else if (cmd.startsWith("zone:del:")) {
+    if (radarZoneRemove(cmd.substring(9).c_str())) {
+      publishAck("zone DELETED");
+    } else {
+      publishAck("zone ERROR: unknown zone");
+    }
+  }
+  else if (cmd == "zone:clear") {
+    radarZonesClear();
+    publishAck("zone CLEARED");
+  }
+  else if (cmd == "zone:list") {
+    bool any = false;
+    for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+      char line[160];
+      if (!radarZoneDescribe(z, line, sizeof(line))) continue;
+      safePublish(ackTopic, line);
+      any = true;
+    }
+    if (!any) safePublish(ackTopic, "zone: none defined");
+  }
+  else if (cmd == "record:on") {
+    if (radarRecorderStart()) {
+      char msg[64];
+      snprintf(msg, sizeof(msg), "record ON (%u frames)", radarRecorderCapacity());
+      publishAck(msg);
+    } else {
+      publishAck("record ERROR: replay active or no memory");
+    }
+  }
+  else if (cmd == "record:off") {
+    radarRecorderStop();
+    char msg[48];
+    snprintf(msg, sizeof(msg), "record OFF (%u frames)", radarRecorderCount());
+    publishAck(msg);
+  }
+  else if (cmd == "record:clear") {
+    if (radarRecorderReplaying()) {
+      publishAck("record ERROR: replay active");
+    } else {
+      radarRecorderClear();
+      publishAck("record CLEARED");
+    }
+  }
+  else if (cmd == "replay:on") {
+    if (radarRecorderStartReplay()) {
+      publishAck("replay ON");
+    } else {
+      publishAck("replay ERROR: recording active or empty");
+    }
+  }
+  else if (cmd == "replay:off") {
+    radarRecorderStopReplay();
+    publishAck("replay OFF");
+  }
+  else if (cmd == "resetMetrics") {
+    metricsReset();
+    loopProfilerReset();
+    publishAck("resetMetrics OK");
+  }
   else if (cmd == "getStatus") {
     if (!mqttTelemetryEnabled) {
-      safePublish(ackTopic, "getStatus ERROR: telemetry disabled");
+      publishAck("getStatus ERROR: telemetry disabled");
     } else {
       publishStatus();
-      safePublish(ackTopic, "getStatus OK");
+      publishAck("getStatus OK");
     }
   }
   else if (cmd == "webServer:on") {
     if (!webServerEnabled) {
-      safePublish(ackTopic, "webServer ERROR: disabled");
+      publishAck("webServer ERROR: disabled");
     } else if (configPortalActive) {
-      safePublish(ackTopic, "webServer ERROR: config portal active");
+      publishAck("webServer ERROR: config portal active");
     } else {
       setupWebServer();
-      safePublish(ackTopic, "webServer ON");
+      publishAck("webServer ON");
     }
   }
   else if (cmd == "webServer:off") {
     if (!webServerEnabled) {
-      safePublish(ackTopic, "webServer ERROR: disabled");
+      publishAck("webServer ERROR: disabled");
     } else {
       stopWebServer();
-      safePublish(ackTopic, "webServer OFF");
+      publishAck("webServer OFF");
     }
   }
   else if (cmd == "help") {
@@ -154,7 +305,16 @@ void processMqttCommand(const String& cmd) {
       "resetRadar - Restart radar serial\n"
       "setRange:<value> - Set max range (0-15m)\n"
       "setHold:<value> - Set hold interval (0-10000ms)\n"
+      "setFilter:ema|kalman - Select target smoothing\n"
+      "setPublish:interval|change - Radar publish mode\n"
+      "setPayload:json|bin|both - Radar payload (<topic>, <topic>/bin)\n"
+      "setDeadband:<mm>,<deg>,<cm/s> - Change-mode deadbands\n"
+      "setHeartbeat:<ms> - Change-mode max silence (1000-3600000)\n"
+      "zone:set:<name>:<x,y;...>|del:<name>|list|clear - Zones\n"
+      "record:on|off|clear - Raw frame recorder\n"
+      "replay:on|off - Replay recorded frames\n"
       "getStatus - Publish current status\n"
+      "resetMetrics - Clear latency and loop profiles\n"
       "webServer:on - Start HTTP status server\n"
       "webServer:off - Stop HTTP status server\n"
       "help - Show this help";
@@ -166,40 +326,61 @@ void processMqttCommand(const String& cmd) {
   else {
     logPrint("Unknown command: ");
     logPrintln(cmd);
-    safePublish(ackTopic, "ERROR: Unknown command. Send 'help' for available commands.");
+    publishAck("ERROR: Unknown command. Send 'help' for available commands.");
   }
 }
 
-void mqttReconnect() {
-  static unsigned long lastAttempt = 0;
-  static uint32_t attemptCount = 0;
-  const unsigned long RECONNECT_INTERVAL = 5000; // 5 Sekunden zwischen Versuchen
+// ---------------------------------------------------------
+// Verbindungsaufbau im eigenen Task
+// ---------------------------------------------------------
+// PubSubClient::connect() blockiert für TCP-Connect, DNS und das Warten auf
+// CONNACK (bis zum Socket-Timeout). Das übernimmt ein eigener Task auf dem
+// PRO-Core; der Loop fasst mqttClient nur im Zustand UP an, der Task nur
+// im Zustand CONNECTING. Übergaben laufen über mqttLink (acquire/release).
 
-  if (WiFi.status() != WL_CONNECTED) return;
-  if (mqttClient.connected()) return;
+static std::atomic<uint8_t> mqttLink{MQTT_LINK_DOWN};
+static std::atomic<bool>    mqttJustConnected{false};
+static bool                 mqttPaused = false;    // mqttDisconnect() bis mqttResume(), nur Loop
+static TaskHandle_t         mqttConnectTaskHandle = nullptr;
+static portMUX_TYPE         mqttServerMux = portMUX_INITIALIZER_UNLOCKED;
+static char                 mqttPendingHost[64];
+static uint16_t             mqttPendingPort = 0;
+static bool                 mqttServerChanged = false;
+static char                 mqttHost[64];          // gehört dem Connect-Task
+static volatile uint32_t    mqttAttempts = 0;
+static volatile uint32_t    mqttBackoff = 0;
+static volatile int         mqttLastRc = 0;
 
-  unsigned long now = millis();
-  if (now - lastAttempt < RECONNECT_INTERVAL) {
-    return; // Zu früh für neuen Versuch
-  }
+static uint32_t nextBackoff(uint32_t failures) {
+  // Exponentiell ab MQTT_BACKOFF_MIN_MS, gedeckelt; "equal jitter": halbe
+  // Wartezeit fest, halbe zufällig, damit mehrere Sensoren nicht synchron
+  // auf den Broker losgehen
+  uint32_t exp = MQTT_BACKOFF_MIN_MS;
+  for (uint32_t i = 1; i < failures && exp < MQTT_BACKOFF_MAX_MS; i++) exp *= 2;
+  if (exp > MQTT_BACKOFF_MAX_MS) exp = MQTT_BACKOFF_MAX_MS;
+  return exp / 2 + esp_random() % (exp / 2 + 1);
+}
 
-  lastAttempt = now;
-  attemptCount++;
+static bool connectOnce() {
+  portENTER_CRITICAL(&mqttServerMux);
+  bool changed = mqttServerChanged;
+  uint16_t port = mqttPendingPort;
+  if (changed) {
+    memcpy(mqttHost, mqttPendingHost, sizeof(mqttHost));
+    mqttServerChanged = false;
+  }
+  portEXIT_CRITICAL(&mqttServerMux);
+  if (changed) mqttClient.setServer(mqttHost, port);
 
-  logPrintf("MQTT reconnect #%lu... ", attemptCount);
-  logPrintf("WiFi status=%d RSSI=%d CH=%d BSSID=%s IP=%s\n",
-            WiFi.status(),
-            WiFi.RSSI(),
-            WiFi.channel(),
-            (g_lastBssid[0] != '\0') ? g_lastBssid : "n/a",
-            WiFi.localIP().toString().c_str());
+  mqttAttempts++;
+  logPrintf("MQTT connect #%lu to %s:%u\n", (unsigned long)mqttAttempts, mqttHost, port);
 
   // SICHERHEIT: Ohne String-Konkatenation
   char id[20];
-  snprintf(id, sizeof(id), "RD03D-%04X", random(0xffff));
+  snprintf(id, sizeof(id), "RD03D-%04X", (unsigned)(esp_random() & 0xFFFF));
 
-  char willTopic[80];
-  snprintf(willTopic, sizeof(willTopic), "%s/status", g_mqttTopic.c_str());
+  char willTopic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("status", willTopic, sizeof(willTopic));
 
   // SICHERHEIT: Mit Last Will Testament
   bool connected = mqttClient.connect(
@@ -209,20 +390,157 @@ void mqttReconnect() {
     true,                        // Retain
     "{\"status\":\"offline\"}"   // LWT Message
   );
+  mqttLastRc = mqttClient.state();
+  if (!connected) {
+    logPrintf("MQTT connect FAILED rc=%d\n", mqttLastRc);
+    return false;
+  }
+
+  char cmdTopic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("cmd", cmdTopic, sizeof(cmdTopic));
+  mqttClient.subscribe(cmdTopic);
+  logPrintf("MQTT connected OK id=%s host=%s:%u\n", id, mqttHost, port);
+  return true;
+}
+
+static void mqttConnectTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    uint32_t failures = 0;
+
+    while (mqttLink.load(std::memory_order_acquire) == MQTT_LINK_CONNECTING) {
+      if (WiFi.status() != WL_CONNECTED) {
+        vTaskDelay(pdMS_TO_TICKS(500));
+        continue;
+      }
+      if (connectOnce()) {
+        mqttBackoff = 0;
+        mqttJustConnected.store(true, std::memory_order_relaxed);
+        uint8_t expected = MQTT_LINK_CONNECTING;
+        if (!mqttLink.compare_exchange_strong(expected, MQTT_LINK_UP, std::memory_order_acq_rel)) {
+          // Währenddessen abgebrochen (mqttDisconnect): Verbindung wieder schließen
+          mqttClient.disconnect();
+          mqttJustConnected.store(false, std::memory_order_relaxed);
+        }
+        break;
+      }
+      mqttBackoff = nextBackoff(++failures);
+      // In Scheiben warten, damit ein Abbruch schnell greift
+      uint32_t waited = 0;
+      while (waited < mqttBackoff &&
+             mqttLink.load(std::memory_order_acquire) == MQTT_LINK_CONNECTING) {
+        uint32_t step = min<uint32_t>(mqttBackoff - waited, 250);
+        vTaskDelay(pdMS_TO_TICKS(step));
+        waited += step;
+      }
+    }
+  }
+}
+
+static void dropLink() {
+  uint8_t expected = MQTT_LINK_UP;
+  if (mqttLink.compare_exchange_strong(expected, MQTT_LINK_DOWN, std::memory_order_acq_rel)) {
+    mqttClient.disconnect();
+    return;
+  }
+  // Laufender Versuch: Task bricht nach dem aktuellen connect() ab
+  expected = MQTT_LINK_CONNECTING;
+  mqttLink.compare_exchange_strong(expected, MQTT_LINK_DOWN, std::memory_order_acq_rel);
+}
+
+void setupMqtt() {
+  mqttSetServer(g_mqttServer.c_str(), g_mqttPort.toInt());
+  mqttClient.setCallback(mqttCallback);
+
+  // SICHERHEIT: Größere Buffer und längere Keep-Alive
+  mqttClient.setBufferSize(MQTT_BUFFER_SIZE);  // Größerer Buffer für JSON
+  mqttClient.setKeepAlive(60);    // 60 Sekunden Keep-Alive (statt 15)
+  mqttClient.setSocketTimeout(15); // Wartezeit auf CONNACK, nur im Connect-Task
+
+  if (!mqttConnectTaskHandle) {
+    xTaskCreatePinnedToCore(mqttConnectTask, "mqttConnect", MQTT_CONNECT_STACK_SIZE,
+                            nullptr, MQTT_CONNECT_PRIORITY, &mqttConnectTaskHandle,
+                            MQTT_CONNECT_CORE);
+  }
+  mqttReconnect();
+}
 
-  if (connected) {
-    logPrintf("MQTT connected OK id=%s host=%s:%s\n",
-              id, g_mqttServer.c_str(), g_mqttPort.c_str());
+void mqttSetServer(const char* host, uint16_t port) {
+  portENTER_CRITICAL(&mqttServerMux);
+  strncpy(mqttPendingHost, host ? host : "", sizeof(mqttPendingHost) - 1);
+  mqttPendingHost[sizeof(mqttPendingHost) - 1] = '\0';
+  mqttPendingPort = port;
+  mqttServerChanged = true;
+  portEXIT_CRITICAL(&mqttServerMux);
+  // Bestehende Verbindung trennen, der nächste Versuch nutzt den neuen Server
+  if (mqttLink.load(std::memory_order_acquire) == MQTT_LINK_UP) dropLink();
+}
 
-    // SICHERHEIT: Ohne String-Konkatenation
-    char cmdTopic[80];
-    snprintf(cmdTopic, sizeof(cmdTopic), "%s/cmd", g_mqttTopic.c_str());
-    mqttClient.subscribe(cmdTopic);
+// Nicht-blockierend: stößt nur den Connect-Task an und meldet den Wechsel
+void mqttReconnect() {
+  if (mqttPaused || WiFi.status() != WL_CONNECTED) return;
 
-    // Sofort Status senden
-    publishStatus();
-  } else {
-    logPrintf("MQTT connect FAILED rc=%d\n", mqttClient.state());
-    logMqttDiag("MQTT connect failed diag", g_mqttTopic.c_str(), nullptr, false);
+  uint8_t state = mqttLink.load(std::memory_order_acquire);
+  if (state == MQTT_LINK_UP) {
+    if (mqttClient.connected()) {
+      if (mqttJustConnected.exchange(false, std::memory_order_relaxed)) {
+        // Sofort Status senden
+        publishStatus();
+      }
+      return;
+    }
+    mqttLastRc = mqttClient.state();
+    logPrintf("MQTT connection lost rc=%d\n", mqttLastRc);
+    logMqttDiag("MQTT connection lost diag", g_mqttTopic.c_str(), 0, false);
+    state = MQTT_LINK_DOWN;
+    mqttLink.store(MQTT_LINK_DOWN, std::memory_order_release);
+  }
+  if (state == MQTT_LINK_DOWN && mqttConnectTaskHandle) {
+    mqttLink.store(MQTT_LINK_CONNECTING, std::memory_order_release);
+    xTaskNotifyGive(mqttConnectTaskHandle);
   }
 }
+
+void mqttDisconnect() {
+  // Sonst stieße der nächste mqttReconnect() einen abgebrochenen Versuch
+  // gleich wieder an
+  mqttPaused = true;
+  dropLink();
+}
+
+void mqttResume() {
+  mqttPaused = false;
+  mqttReconnect();
+}
+
+bool mqttConnected() {
+  return mqttLink.load(std::memory_order_acquire) == MQTT_LINK_UP && mqttClient.connected();
+}
+
+void mqttLoop() {
+  if (mqttLink.load(std::memory_order_acquire) == MQTT_LINK_UP) mqttClient.loop();
+}
+
+void nonBlockingDelay(unsigned long ms) {
+  unsigned long start = millis();
+  while (millis() - start < ms) {
+    mqttLoop();
+    yield();
+  }
+}
+
+MqttLinkState mqttLinkState() {
+  return (MqttLinkState)mqttLink.load(std::memory_order_acquire);
+}
+
+const char* mqttLinkName(MqttLinkState state) {
+  switch (state) {
+    case MQTT_LINK_UP:         return "up";
+    case MQTT_LINK_CONNECTING: return "connecting";
+    default:                   return "down";
+  }
+}
+
+uint32_t mqttConnectAttempts() { return mqttAttempts; }
+uint32_t mqttBackoffMs()       { return mqttBackoff; }
+int      mqttLastState()       { return mqttLastRc; }
@@ -4,8 +4,30 @@
 #include "Config.h"
 #include <Arduino.h>
 
+enum MqttLinkState : uint8_t {
+  MQTT_LINK_DOWN,
+  MQTT_LINK_CONNECTING,     // Connect-Task arbeitet (Backoff + connect)
+  MQTT_LINK_UP
+};
+
 void mqttCallback(char* topic, byte* payload, unsigned int length);
 void processMqttCommand(const String& cmd);
-void mqttReconnect();
+
+// Verbindungsverwaltung; alle Aufrufe blockieren nicht
+void setupMqtt();
+void mqttReconnect();                         // pro Loop: Verlust erkennen, Task anstoßen
+void mqttDisconnect();                        // trennt und pausiert bis mqttResume()
+void mqttResume();
+void mqttSetServer(const char* host, uint16_t port);
+bool mqttConnected();                         // statt mqttClient.connected()
+void mqttLoop();                              // statt mqttClient.loop()
+void nonBlockingDelay(unsigned long ms);      // wartet und bedient dabei MQTT
+MqttLinkState mqttLinkState();
+const char* mqttLinkName(MqttLinkState state);
+uint32_t mqttConnectAttempts();
+uint32_t mqttBackoffMs();                     // aktuelle Wartezeit bis zum nächsten Versuch
+int      mqttLastState();                     // PubSubClient-rc des letzten Versuchs
 bool safePublish(const char* topic, const char* payload);
+bool safePublish(const char* topic, const uint8_t* payload, size_t len);
 bool safePublishRetain(const char* topic, const char* payload);
+void publishAck(const char* msg);            // <topic>/ack, nur live (nicht in der EventQueue)
@@ -0,0 +1,106 @@
+// File: Metrics.cpp
+
+#include "Metrics.h"
+
+// Obergrenzen der Buckets in µs, letzter Bucket offen
+static const uint32_t BUCKET_LIMIT_US[METRICS_BUCKETS - 1] = {
+  100, 200, 500, 1000, 2000, 5000, 10000, 20000,
+  50000, 100000, 200000, 500000, 1000000, 2000000, 5000000
+};
+
+static const char* const STAGE_NAMES[LAT_STAGE_COUNT] = {
+  "frame", "parsed", "json", "mqtt", "sse", "ws"
+};
+
+// Geschrieben vom Ingest-Task (frame/parsed) und vom Loop (Rest)
+static portMUX_TYPE     metricsMux = portMUX_INITIALIZER_UNLOCKED;
+static MetricsHistogram histograms[LAT_STAGE_COUNT];
+
+static uint8_t bucketFor(uint32_t us) {
+  uint8_t b = 0;
+  while (b < METRICS_BUCKETS - 1 && us > BUCKET_LIMIT_US[b]) b++;
+  return b;
+}
+
+void metricsHistRecord(MetricsHistogram& h, uint32_t us) {
+  h.buckets[bucketFor(us)]++;
+  h.count++;
+  if (us > h.maxUs) h.maxUs = us;
+}
+
+static uint32_t percentile(const MetricsHistogram& h, uint32_t pct) {
+  if (h.count == 0) return 0;
+  // Rang aufrunden, damit p99 bei kleinen Stichproben den langsamsten trifft
+  uint32_t rank = (uint32_t)(((uint64_t)h.count * pct + 99) / 100);
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+    seen += h.buckets[b];
+    if (seen >= rank) {
+      uint32_t limit = (b < METRICS_BUCKETS - 1) ? BUCKET_LIMIT_US[b] : h.maxUs;
+      return min(limit, h.maxUs);
+    }
+  }
+  return h.maxUs;
+}
+
+void metricsHistSummary(const MetricsHistogram& h, LatencySummary& out) {
+  out.count = h.count;
+  out.p50   = percentile(h, 50);
+  out.p95   = percentile(h, 95);
+  out.p99   = percentile(h, 99);
+  out.max   = h.maxUs;
+}
+
+void metricsRecordLatency(LatencyStage stage, uint32_t us) {
+  if (stage >= LAT_STAGE_COUNT) return;
+  portENTER_CRITICAL(&metricsMux);
+  metricsHistRecord(histograms[stage], us);
+  portEXIT_CRITICAL(&metricsMux);
+}
+
+void metricsLatencySummary(LatencyStage stage, LatencySummary& out) {
+  out = LatencySummary{};
+  if (stage >= LAT_STAGE_COUNT) return;
+  MetricsHistogram h;
+  portENTER_CRITICAL(&metricsMux);
+  h = histograms[stage];
+  portEXIT_CRITICAL(&metricsMux);
+  metricsHistSummary(h, out);
+}
+
+const char* metricsStageName(LatencyStage stage) {
+  return stage < LAT_STAGE_COUNT ? STAGE_NAMES[stage] : "?";
+}
+
+void metricsReset() {
+  portENTER_CRITICAL(&metricsMux);
+  memset(histograms, 0, sizeof(histograms));
+  portEXIT_CRITICAL(&metricsMux);
+}
+
+size_t metricsLatencyJson(char* buf, size_t bufsize) {
+  if (!buf || bufsize == 0) return 0;
+  size_t n = 0;
+  buf[n++] = '{';
+  for (uint8_t s = 0; s < LAT_STAGE_COUNT && n < bufsize; s++) {
+    LatencySummary sum;
+    metricsLatencySummary((LatencyStage)s, sum);
+    int w = snprintf(buf + n, bufsize - n,
+                     "%s\"%s\":{\"n\":%lu,\"p50\":%lu,\"p95\":%lu,\"p99\":%lu,\"max\":%lu}",
+                     s ? "," : "", STAGE_NAMES[s],
+                     (unsigned long)sum.count, (unsigned long)sum.p50, (unsigned long)sum.p95,
+                     (unsigned long)sum.p99, (unsigned long)sum.max);
+    if (w < 0 || (size_t)w >= bufsize - n) {
+      buf[0] = '\0';
+      return 0;
+    }
+    n += w;
+  }
+  if (n + 2 > bufsize) {
+    buf[0] = '\0';
+    return 0;
+  }
+  buf[n++] = '}';
+  buf[n] = '\0';
+  return n;
+}
@@ -0,0 +1,46 @@
+// File: Metrics.h
+
+#pragma once
+#include "Config.h"
+
+// Ende-zu-Ende-Latenz je Frame, gemessen ab dem UART-Read, in dem das
+// erste Byte des Frames lag. Jede Stufe zählt das Alter des Frames beim
+// Erreichen der Stufe in festen Histogramm-Buckets (µs); Perzentile sind
+// die Obergrenze des jeweiligen Buckets (höchstens max).
+
+#define METRICS_BUCKETS 16
+#define METRICS_JSON_SIZE 640      // metricsLatencyJson() für alle Stufen
+
+enum LatencyStage : uint8_t {
+  LAT_FRAME,        // Frame vollständig (Parser)
+  LAT_PARSED,       // Tracking fertig, Snapshot veröffentlicht
+  LAT_JSON,         // MQTT-Payload serialisiert
+  LAT_MQTT,         // an mqttClient.publish übergeben
+  LAT_SSE,          // an den SSE-Client geschrieben
+  LAT_WS,           // Binär-Frame an /ws-Clients übergeben
+  LAT_STAGE_COUNT
+};
+
+struct LatencySummary {
+  uint32_t count;
+  uint32_t p50, p95, p99, max;   // µs
+};
+
+// Histogramm mit den Buckets oben; ohne eigene Sperre, für genau einen
+// Schreiber (Latenz-Stufen sichern sich selbst ab)
+struct MetricsHistogram {
+  uint32_t buckets[METRICS_BUCKETS];
+  uint32_t count;
+  uint32_t maxUs;
+};
+
+void metricsHistRecord(MetricsHistogram& h, uint32_t us);
+void metricsHistSummary(const MetricsHistogram& h, LatencySummary& out);
+
+void metricsRecordLatency(LatencyStage stage, uint32_t us);
+void metricsLatencySummary(LatencyStage stage, LatencySummary& out);
+const char* metricsStageName(LatencyStage stage);
+void metricsReset();
+
+// {"frame":{"n":..,"p50":..,"p95":..,"p99":..,"max":..},...}
+size_t metricsLatencyJson(char* buf, size_t bufsize);
@@ -0,0 +1,45 @@
+// File: RadarAssociation.cpp
+
+#include "RadarAssociation.h"
+
+static const uint8_t PERMUTATIONS[6][3] = {
+  {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}
+};
+
+static const uint32_t GATE_SQ = (uint32_t)RADAR_ASSOC_GATE_MM * RADAR_ASSOC_GATE_MM;
+
+// Kosten eines Paars: d² innerhalb des Gates, sonst Gate² (= "keine
+// Zuordnung"). So gewinnt immer die Permutation mit den meisten und
+// dann den nächstgelegenen Treffern.
+static uint32_t pairCost(const RadarPoint& t, const RadarPoint& d) {
+  if (!t.valid || !d.valid) return GATE_SQ;
+  int32_t dx = d.x - t.x;
+  int32_t dy = d.y - t.y;
+  if (dx < 0) dx = -dx;
+  if (dy < 0) dy = -dy;
+  if (dx >= RADAR_ASSOC_GATE_MM || dy >= RADAR_ASSOC_GATE_MM) return GATE_SQ;
+  uint32_t d2 = (uint32_t)(dx * dx) + (uint32_t)(dy * dy);
+  return d2 < GATE_SQ ? d2 : GATE_SQ;
+}
+
+void radarAssociate(const RadarPoint tracks[3], const RadarPoint dets[3], int8_t detForTrack[3]) {
+  uint32_t cost[3][3];
+  for (int t = 0; t < 3; t++) {
+    for (int d = 0; d < 3; d++) cost[t][d] = pairCost(tracks[t], dets[d]);
+  }
+
+  int best = 0;
+  uint32_t bestCost = UINT32_MAX;
+  for (int p = 0; p < 6; p++) {
+    uint32_t c = cost[0][PERMUTATIONS[p][0]] + cost[1][PERMUTATIONS[p][1]] + cost[2][PERMUTATIONS[p][2]];
+    if (c < bestCost) {
+      bestCost = c;
+      best = p;
+    }
+  }
+
+  for (int t = 0; t < 3; t++) {
+    uint8_t d = PERMUTATIONS[best][t];
+    detForTrack[t] = cost[t][d] < GATE_SQ ? (int8_t)d : -1;
+  }
+}
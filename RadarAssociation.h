@@ -0,0 +1,19 @@
+// File: RadarAssociation.h
+
+#pragma once
+#include <stdint.h>
+
+// Zuordnung der drei Sensor-Slots zu den Tracks. Der RD-03D vertauscht
+// seine Slots, daher wird pro Frame die Zuordnung mit minimaler Summe der
+// quadrierten Abstände über alle 3! Permutationen gesucht. Paare jenseits
+// des Gates gelten als nicht zugeordnet.
+
+#define RADAR_ASSOC_GATE_MM 800   // max. Sprung zwischen Prognose und Messung
+
+struct RadarPoint {
+  int32_t x, y;   // mm
+  bool    valid;
+};
+
+// detForTrack[t] = Index der Messung für Track t oder -1
+void radarAssociate(const RadarPoint tracks[3], const RadarPoint dets[3], int8_t detForTrack[3]);
@@ -0,0 +1,83 @@
+// File: RadarBinary.cpp
+
+#include "RadarBinary.h"
+#include "RadarMath.h"
+#include "RadarProtocol.h"
+
+static uint16_t getU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int16_t clampI16(int32_t v) {
+  if (v > 32767) return 32767;
+  if (v < -32767) return -32767;
+  return (int16_t)v;
+}
+
+size_t radarBinaryEncode(const RadarSnapshot& snap, uint8_t* out, size_t size) {
+  uint8_t count = 0;
+  for (int i = 0; i < 3; i++) if (snap.targets[i].presence) count++;
+  size_t len = RADAR_BIN_HEADER_SIZE + count * RADAR_BIN_TARGET_SIZE;
+  if (size < len) return 0;
+
+  out[0] = RADAR_BIN_VERSION;
+  out[1] = count;
+  radarPutU32(out + 2, snap.frame);
+  radarPutU32(out + 6, (uint32_t)snap.timeMs);
+  uint8_t* p = out + RADAR_BIN_HEADER_SIZE;
+  for (int i = 0; i < 3; i++) {
+    const RadarTarget& t = snap.targets[i];
+    if (!t.presence) continue;
+    radarPutU16(p + 0, t.id);
+    radarPutU16(p + 2, (uint16_t)t.x);
+    radarPutU16(p + 4, (uint16_t)t.y);
+    radarPutU16(p + 6, (uint16_t)clampI16(t.speed));
+    radarPutU16(p + 8, t.distRaw);
+    radarPutU16(p + 10, t.sigma);
+    p += RADAR_BIN_TARGET_SIZE;
+  }
+  return len;
+}
+
+bool radarBinaryDecode(const uint8_t* data, size_t len, RadarSnapshot& out) {
+  if (len < RADAR_BIN_HEADER_SIZE || data[0] != RADAR_BIN_VERSION) return false;
+  uint8_t count = data[1];
+  if (count > 3 || len != RADAR_BIN_HEADER_SIZE + (size_t)count * RADAR_BIN_TARGET_SIZE) return false;
+
+  out = RadarSnapshot{};
+  out.frame  = getU32(data + 2);
+  out.timeMs = getU32(data + 6);
+  const uint8_t* p = data + RADAR_BIN_HEADER_SIZE;
+  for (uint8_t i = 0; i < count; i++, p += RADAR_BIN_TARGET_SIZE) {
+    RadarTarget& t = out.targets[i];
+    t.presence   = true;
+    t.id         = getU16(p + 0);
+    t.x          = (int16_t)getU16(p + 2);
+    t.y          = (int16_t)getU16(p + 4);
+    t.speed      = (int16_t)getU16(p + 6);
+    t.distRaw    = getU16(p + 8);
+    t.sigma      = getU16(p + 10);
+    t.distanceXY = radarIsqrt32((uint32_t)((int32_t)t.x * t.x) + (uint32_t)((int32_t)t.y * t.y));
+    t.angleCdeg  = radarAtan2Cdeg(t.y, t.x);
+  }
+  return true;
+}
+
+const char* radarPayloadName(RadarPayloadMode mode) {
+  switch (mode) {
+    case RADAR_PAYLOAD_BIN:  return "bin";
+    case RADAR_PAYLOAD_BOTH: return "both";
+    default:                 return "json";
+  }
+}
+
+bool radarPayloadFromName(const char* name, RadarPayloadMode& mode) {
+  if (!strcmp(name, "json")) { mode = RADAR_PAYLOAD_JSON; return true; }
+  if (!strcmp(name, "bin"))  { mode = RADAR_PAYLOAD_BIN;  return true; }
+  if (!strcmp(name, "both")) { mode = RADAR_PAYLOAD_BOTH; return true; }
+  return false;
+}
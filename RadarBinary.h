@@ -0,0 +1,31 @@
+// File: RadarBinary.h
+
+#pragma once
+#include "Config.h"
+#include "RadarPipeline.h"
+
+// Kompakte Binärdarstellung eines Target-Snapshots für <topic>/bin
+// (setPayload:bin|both). Feste Records, keine Keys; Distanz und Winkel
+// werden beim Dekodieren aus x/y nachgerechnet (RadarMath, bitgenau wie
+// auf dem Sensor).
+//
+// Layout v1 (little endian), 10 + n·12 Bytes, max. 46:
+//   Header  version u8 | count u8 (0..3) | frame u32 | timeMs u32
+//   Target  id u16 | x i16 | y i16 | speed i16 (mm/s) | distRaw u16 | sigma u16 (mm, 0 = ohne Kalman)
+//
+// frame ist der fortlaufende Frame-Zähler des Ingest-Tasks (Lücken =
+// nicht publizierte Frames), timeMs die Uptime beim Frame. Neue Felder
+// bekommen eine neue Version; Decoder lehnen unbekannte Versionen ab.
+
+#define RADAR_BIN_VERSION      1
+#define RADAR_BIN_HEADER_SIZE  10
+#define RADAR_BIN_TARGET_SIZE  12
+#define RADAR_BIN_MAX_SIZE     (RADAR_BIN_HEADER_SIZE + 3 * RADAR_BIN_TARGET_SIZE)
+
+// 0 = out zu klein
+size_t radarBinaryEncode(const RadarSnapshot& snap, uint8_t* out, size_t size);
+// Auch für Host-Tools: füllt targets[0..count-1] (presence = true), rxUs = 0
+bool   radarBinaryDecode(const uint8_t* data, size_t len, RadarSnapshot& out);
+
+const char* radarPayloadName(RadarPayloadMode mode);
+bool radarPayloadFromName(const char* name, RadarPayloadMode& mode);
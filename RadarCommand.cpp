@@ -0,0 +1,274 @@
+// File: RadarCommand.cpp
+
+#include "RadarCommand.h"
+
+static const uint8_t CMD_HEADER[4] = { RADAR_CMD_HEADER_BYTES };
+static const uint8_t CMD_TAIL[4]   = { RADAR_CMD_TAIL_BYTES };
+static const size_t  ACK_MAX_LEN   = 32;
+
+struct RadarCmdRequest {
+  RadarCmdKind     kind;
+  RadarParamWrite  params[RADAR_CMD_MAX_PARAMS];
+  uint8_t          paramCount;
+  float            arg;
+  RadarCmdCallback callback;
+};
+
+enum CmdStep : uint8_t { STEP_IDLE, STEP_OPEN, STEP_READ, STEP_SET, STEP_CLOSE, STEP_SINGLE };
+
+struct ActiveCmd {
+  RadarCmdRequest req;
+  RadarCmdResult  res;
+  CmdStep         step;
+  uint8_t         paramIdx;
+  uint16_t        expectAck;
+  unsigned long   sentAt;
+  bool            ackSeen;
+  uint16_t        ackStatus;
+  bool            ackHasValue;
+  uint32_t        ackValue;
+};
+
+// 0x0008 (Read-Back) ist für den RD-03D nicht bestätigt. Bleibt das ACK
+// einmal aus, wird nur noch geschrieben, statt vor jedem Set die vollen
+// RADAR_CMD_ACK_TIMEOUT_MS zu warten (gilt bis zum Neustart)
+static bool          readBackOff = false;
+
+static QueueHandle_t cmdQueue    = nullptr;   // Loop → Ingest-Task
+static QueueHandle_t resultQueue = nullptr;   // Ingest-Task → Loop
+static ActiveCmd     active = {};
+
+// ACK-Scanner: nur vom Ingest-Task benutzt
+static uint8_t ackBuf[ACK_MAX_LEN];
+static uint8_t ackCount = 0;
+
+void radarCommandInit() {
+  if (!cmdQueue)    cmdQueue    = xQueueCreate(RADAR_CMD_QUEUE_LEN, sizeof(RadarCmdRequest));
+  if (!resultQueue) resultQueue = xQueueCreate(RADAR_CMD_QUEUE_LEN, sizeof(RadarCmdResult));
+}
+
+static bool enqueue(const RadarCmdRequest& req) {
+  if (!cmdQueue) return false;
+  return xQueueSend(cmdQueue, &req, 0) == pdPASS;
+}
+
+bool radarCommandSession(const RadarParamWrite* params, uint8_t count, float arg, RadarCmdCallback callback) {
+  if (!params || count == 0 || count > RADAR_CMD_MAX_PARAMS) return false;
+  RadarCmdRequest req = {};
+  req.kind       = RADAR_CMD_SESSION;
+  req.paramCount = count;
+  req.arg        = arg;
+  req.callback   = callback;
+  memcpy(req.params, params, count * sizeof(RadarParamWrite));
+  return enqueue(req);
+}
+
+bool radarCommandMultiTarget(RadarCmdCallback callback) {
+  RadarCmdRequest req = {};
+  req.kind     = RADAR_CMD_MULTI_TARGET;
+  req.callback = callback;
+  return enqueue(req);
+}
+
+uint8_t radarCommandPending() {
+  uint8_t n = cmdQueue ? (uint8_t)uxQueueMessagesWaiting(cmdQueue) : 0;
+  return n + (active.step != STEP_IDLE ? 1 : 0);
+}
+
+template <class Spec>
+static void sendStep(CmdStep step, const uint8_t* payload = nullptr) {
+  RadarCmdFrame<Spec> frame(payload);
+  Serial1.write(frame.bytes, frame.size());
+  active.step        = step;
+  active.expectAck   = Spec::ACK;
+  active.ackSeen     = false;
+  active.ackHasValue = false;
+  active.sentAt      = millis();
+}
+
+static const RadarParamWrite& currentParam() {
+  return active.req.params[active.paramIdx];
+}
+
+static void sendRead() {
+  uint8_t payload[RadarCmdReadParam::PAYLOAD];
+  radarPutU16(payload, currentParam().param);
+  sendStep<RadarCmdReadParam>(STEP_READ, payload);
+}
+
+static void sendSet() {
+  uint8_t payload[RadarCmdSetParam::PAYLOAD];
+  radarPutU16(payload, currentParam().param);
+  radarPutU32(payload + 2, currentParam().value);
+  sendStep<RadarCmdSetParam>(STEP_SET, payload);
+}
+
+// Nächsten Parameter beginnen oder die Session schließen
+static void nextParam() {
+  if (active.paramIdx >= active.req.paramCount) {
+    sendStep<RadarCmdClose>(STEP_CLOSE);
+  } else if (readBackOff) {
+    sendSet();
+  } else {
+    sendRead();
+  }
+}
+
+static void finish() {
+  RadarCmdResult& res = active.res;
+  res.kind       = active.req.kind;
+  res.paramCount = active.req.paramCount;
+  res.arg        = active.req.arg;
+  res.callback   = active.req.callback;
+  memcpy(res.params, active.req.params, sizeof(res.params));
+  if (resultQueue && xQueueSend(resultQueue, &res, 0) != pdPASS) {
+    logPrintln("Radar CMD: Ergebnis-Queue voll, Ergebnis verworfen");
+  }
+  active.step = STEP_IDLE;
+}
+
+static void onAck(uint16_t cmdRaw, uint16_t status, const uint8_t* extra, uint16_t extraLen) {
+  if (active.step == STEP_IDLE) return;
+  if (cmdRaw != active.expectAck) {
+    logPrintf("Radar ACK unexpected cmd=0x%04X expecting 0x%04X\n", cmdRaw, active.expectAck);
+    return;
+  }
+  active.ackSeen   = true;
+  active.ackStatus = status;
+  if (extraLen >= 4) {
+    active.ackHasValue = true;
+    active.ackValue = extra[0] | (extra[1] << 8) | ((uint32_t)extra[2] << 16) | ((uint32_t)extra[3] << 24);
+  }
+}
+
+void radarCommandFeed(const uint8_t* data, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    if (ackCount == 0) {
+      const uint8_t* next = (const uint8_t*)memchr(data + i, CMD_HEADER[0], len - i);
+      if (!next) return;
+      i = next - data;
+    }
+    uint8_t b = data[i++];
+    if (ackCount < sizeof(CMD_HEADER)) {
+      if (b != CMD_HEADER[ackCount]) {
+        ackCount = (b == CMD_HEADER[0]) ? 1 : 0;
+        if (ackCount) ackBuf[0] = b;
+        continue;
+      }
+      ackBuf[ackCount++] = b;
+      continue;
+    }
+    ackBuf[ackCount++] = b;
+    if (ackCount < 6) continue;
+
+    uint16_t plen  = ackBuf[4] | (ackBuf[5] << 8);
+    size_t   total = 4 + 2 + plen + 4;
+    if (plen < 2 || total > ACK_MAX_LEN) {
+      ackCount = 0;
+      continue;
+    }
+    if (ackCount < total) continue;
+
+    if (memcmp(ackBuf + total - 4, CMD_TAIL, 4) == 0) {
+      uint16_t cmdRaw = ackBuf[6] | (ackBuf[7] << 8);
+      uint16_t status = plen >= 4 ? (uint16_t)(ackBuf[8] | (ackBuf[9] << 8)) : 0;
+      uint16_t extraLen = plen >= 4 ? plen - 4 : 0;
+      onAck(cmdRaw, status, ackBuf + 10, extraLen);
+    }
+    ackCount = 0;
+  }
+}
+
+static void recordFailure(bool timeout, uint16_t status) {
+  if (active.res.ok) {
+    active.res.status  = status;
+    active.res.timeout = timeout;
+  }
+  active.res.ok = false;
+}
+
+static void startNext() {
+  RadarCmdRequest req;
+  if (!cmdQueue || xQueueReceive(cmdQueue, &req, 0) != pdPASS) return;
+  active = ActiveCmd{};
+  active.req = req;
+  active.res.ok = true;
+  if (req.kind == RADAR_CMD_MULTI_TARGET) {
+    sendStep<RadarCmdMultiTarget>(STEP_SINGLE);
+  } else {
+    uint8_t version[RadarCmdOpen::PAYLOAD] = {0x01, 0x00};
+    sendStep<RadarCmdOpen>(STEP_OPEN, version);
+  }
+}
+
+bool radarCommandPoll() {
+  if (active.step == STEP_IDLE) {
+    startNext();
+    return active.step != STEP_IDLE;
+  }
+
+  bool timedOut = millis() - active.sentAt >= RADAR_CMD_ACK_TIMEOUT_MS;
+  if (!active.ackSeen && !timedOut) return true;
+
+  switch (active.step) {
+    case STEP_OPEN:
+      // Ohne Open-ACK trotzdem weitermachen; maßgeblich sind die Set-ACKs
+      if (!active.ackSeen) logPrintln("Radar CMD: kein ACK auf open");
+      nextParam();
+      break;
+
+    case STEP_READ:
+      if (!active.ackSeen) {
+        readBackOff = true;
+        logPrintln("Radar CMD: kein ACK auf Read-Back 0x0008 (beim RD-03D unbestätigt), Read-Back aus");
+      }
+      // Read-Back: bereits aktive Werte nicht erneut schreiben
+      if (active.ackSeen && active.ackStatus == 0 && active.ackHasValue &&
+          active.ackValue == currentParam().value) {
+        active.res.skipped++;
+        active.paramIdx++;
+        nextParam();
+      } else {
+        sendSet();
+      }
+      break;
+
+    case STEP_SET:
+      if (active.ackSeen && active.ackStatus == 0) {
+        active.res.written++;
+      } else {
+        if (active.ackSeen) {
+          logPrintf("Radar ACK 0x%04X param 0x%04X status=%u\n",
+                    active.expectAck, currentParam().param, active.ackStatus);
+        }
+        recordFailure(!active.ackSeen, active.ackStatus);
+      }
+      active.paramIdx++;
+      nextParam();
+      break;
+
+    case STEP_CLOSE:
+      if (!active.ackSeen) logPrintln("Radar CMD: kein ACK auf close");
+      finish();
+      break;
+
+    case STEP_SINGLE:
+      if (!active.ackSeen || active.ackStatus != 0) recordFailure(!active.ackSeen, active.ackStatus);
+      finish();
+      break;
+
+    default:
+      active.step = STEP_IDLE;
+      break;
+  }
+  return active.step != STEP_IDLE;
+}
+
+void radarCommandDispatch() {
+  if (!resultQueue) return;
+  RadarCmdResult res;
+  while (xQueueReceive(resultQueue, &res, 0) == pdPASS) {
+    if (res.callback) res.callback(res);
+  }
+}
@@ -0,0 +1,52 @@
+// File: RadarCommand.h
+
+#pragma once
+#include "Config.h"
+#include "RadarProtocol.h"
+
+// Nicht-blockierende Konfiguration des RD-03D. Befehle werden aus dem Loop
+// eingereiht, der Ingest-Task arbeitet sie als Zustandsmaschine ab, während
+// Report-Frames weiterlaufen. Eine Session bündelt mehrere Parameter in
+// einem open/close-Paar: pro Parameter wird zuerst der aktuelle Wert
+// gelesen und nur bei Abweichung geschrieben. ACKs werden aus demselben
+// Empfangsstrom gelesen, die Ergebnisse im Loop per Callback zugestellt.
+
+#define RADAR_CMD_MAX_PARAMS 4
+
+enum RadarCmdKind : uint8_t {
+  RADAR_CMD_SESSION,       // open → (read → set)* → close
+  RADAR_CMD_MULTI_TARGET   // Einzelbefehl ohne open/close
+};
+
+struct RadarParamWrite {
+  uint16_t param;          // RadarParamId
+  uint32_t value;
+};
+
+struct RadarCmdResult;
+typedef void (*RadarCmdCallback)(const RadarCmdResult& result);
+
+struct RadarCmdResult {
+  RadarCmdKind     kind;
+  RadarParamWrite  params[RADAR_CMD_MAX_PARAMS];
+  uint8_t          paramCount;
+  float            arg;        // frei für den Aufrufer (z. B. Meter)
+  bool             ok;         // alle Parameter gesetzt bzw. bereits aktiv
+  bool             timeout;    // mindestens ein Set-ACK blieb aus
+  uint16_t         status;     // Status-Wort des ersten fehlgeschlagenen ACKs
+  uint8_t          written;    // geschriebene Parameter
+  uint8_t          skipped;    // laut Read-Back bereits aktiv
+  RadarCmdCallback callback;
+};
+
+void radarCommandInit();
+bool radarCommandSession(const RadarParamWrite* params, uint8_t count, float arg, RadarCmdCallback callback);
+bool radarCommandMultiTarget(RadarCmdCallback callback);
+uint8_t radarCommandPending();                         // eingereiht + aktiv
+
+// Ingest-Task (hält den Serial1-Lock)
+void radarCommandFeed(const uint8_t* data, size_t len); // ACK-Scanner
+bool radarCommandPoll();                               // true, solange ein Befehl läuft
+
+// Loop: fertige Befehle an ihre Callbacks übergeben
+void radarCommandDispatch();
@@ -1,12 +1,25 @@
 // File: RadarHandler.cpp
 
 #include "RadarHandler.h"
+#include "RadarPipeline.h"
+#include "RadarRecorder.h"
+#include "RadarZones.h"
+#include "RadarHistory.h"
+#include "RadarCommand.h"
+#include "Metrics.h"
+#include "LoopProfiler.h"
+#include "EventQueue.h"
+#include "RadarBinary.h"
+#include "SnapshotCache.h"
 #include "Config.h"
 #include "MQTTHandler.h"
 #include "WebServerHandler.h"
 #include <ArduinoJson.h>
 #include <esp_system.h>
 
+static TaskHandle_t      radarIngestTaskHandle = nullptr;
+static SemaphoreHandle_t radarSerialMutex      = nullptr; // Serial1-Zugriff: Ingest-Task vs. Konfiguration
+
 static const char* resetReasonToString(esp_reset_reason_t reason) {
   switch (reason) {
     case ESP_RST_POWERON:    return "power-on";
@@ -23,356 +36,404 @@ static const char* resetReasonToString(esp_reset_reason_t reason) {
   }
 }
 
-void enableMultiTargetMode() {
-  Serial1.write(multiTargetCmd, sizeof(multiTargetCmd));
-}
-
-bool readSensorAck(uint16_t expectedCmd, uint32_t timeoutMs) {
-  const uint8_t HDR[4] = {0xFD,0xFC,0xFB,0xFA};
-  uint32_t start = millis();
-  uint8_t buf[20];
-  uint8_t idx = 0;
-  while (millis() - start < timeoutMs) {
-    if (!Serial1.available()) continue;
-    buf[idx++] = Serial1.read();
-    if (idx >= 8 && memcmp(buf, HDR, 4) == 0) {
-      uint16_t len = buf[4] | (buf[5] << 8);
-      uint16_t full = 4 + 2 + len + 4;
-      if (idx >= full) {
-        uint16_t cmdRaw = buf[6] | (buf[7] << 8);
-        uint16_t st     = buf[8] | (buf[9] << 8);
-        uint16_t cmd    = cmdRaw & 0x00FF;
-        if (cmd == expectedCmd || cmdRaw == expectedCmd) {
-          if (st != 0) {
-            logPrintf("Radar ACK 0x%04X status=%u\n", cmdRaw, st);
-          }
-          return st == 0;
-        }
-        // Open/Close-ACKs können vor dem erwarteten SET kommen → still ignorieren
-        if (cmdRaw == 0x01FF || cmdRaw == 0x01FE) {
-          idx = 0;
-          continue;
-        }
-        // Unerwartetes ACK verwerfen und weiter warten
-        logPrintf("Radar ACK unexpected cmd=0x%04X expecting 0x%04X\n", cmdRaw, expectedCmd);
-        idx = 0;
-      }
-    }
-    if (idx >= sizeof(buf)) idx = 0;
+static void radarSerialLock() {
+  if (radarSerialMutex) xSemaphoreTakeRecursive(radarSerialMutex, portMAX_DELAY);
+}
+
+static void radarSerialUnlock() {
+  if (radarSerialMutex) xSemaphoreGiveRecursive(radarSerialMutex);
+}
+
+// Läuft im UART-Event-Task des HardwareSerial-Treibers: nur den Ingest-Task wecken
+static void onRadarUartReceive() {
+  if (radarIngestTaskHandle) xTaskNotifyGive(radarIngestTaskHandle);
+}
+
+static void onRadarUartError(hardwareSerial_error_t err) {
+  if (err == UART_BUFFER_FULL_ERROR || err == UART_FIFO_OVF_ERROR) {
+    radarRxOverflowCount++;
   }
-  return false;
 }
 
-void setMaxRadarRange(float m) {
-  while (Serial1.available()) {
-    Serial1.read();
+static void radarSerialBegin() {
+  // RX-Puffer muss vor begin() gesetzt werden
+  Serial1.setRxBufferSize(RADAR_RX_BUFFER_SIZE);
+  Serial1.begin(256000, SERIAL_8N1,
+                g_radarRxPin.toInt(),
+                g_radarTxPin.toInt());
+  Serial1.onReceive(onRadarUartReceive, false);
+  Serial1.onReceiveError(onRadarUartError);
+}
+
+static void radarIngestTask(void*) {
+  bool cmdBusy = false;
+  for (;;) {
+    uint32_t waitMs = radarRecorderReplaying() ? RADAR_REPLAY_STEP_MS : RADAR_INGEST_IDLE_MS;
+    if (cmdBusy) waitMs = RADAR_CMD_POLL_MS;   // ACK-Timeouts fein genug auflösen
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    radarSerialLock();
+    readRadarData();
+    cmdBusy = radarCommandPoll();
+    radarSerialUnlock();
+    radarRecorderReplayStep();
   }
+}
 
-  g_maxRangeMeters = m;
-  uint8_t gate = min((uint8_t)ceil(m / RANGE_GATE_SIZE), (uint8_t)15);
+void setupRadar() {
+  if (!radarSerialMutex) {
+    radarSerialMutex = xSemaphoreCreateRecursiveMutex();
+  }
+  radarPipelineInit();
+  radarZonesLoad();
+  radarCommandInit();
 
-  // Open
-  static const uint8_t openCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x04,0x00,0xFF,0x00,0x01,0x00,0x04,0x03,0x02,0x01
-  };
-  Serial1.write(openCmd, sizeof(openCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+  radarSerialBegin();
+  delay(100);
 
-  // Set
-  uint8_t setCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x08,0x00,0x07,0x00,0x01,0x00,
-    gate,0x00,0x00,0x00,0x04,0x03,0x02,0x01
-  };
-  Serial1.write(setCmd, sizeof(setCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+  applyRadarConfig();
+  enableMultiTargetMode();
 
-  // Close
-  static const uint8_t closeCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x02,0x00,0xFE,0x00,0x04,0x03,0x02,0x01
-  };
-  Serial1.write(closeCmd, sizeof(closeCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+  if (!radarIngestTaskHandle) {
+    // Gleicher Kern wie loopTask, aber höhere Priorität: MQTT/HTTP/OTA im
+    // Loop verdrängen Parsing und Tracking nicht, teilen sich aber die CPU.
+    // Alle SeqLock-Leser laufen im Loop (niedriger priorisiert, siehe SeqLock.h)
+    xTaskCreatePinnedToCore(radarIngestTask, "radarIngest", RADAR_INGEST_STACK_SIZE,
+                            nullptr, RADAR_INGEST_PRIORITY, &radarIngestTaskHandle,
+                            RADAR_INGEST_CORE);
+  }
+}
+
+// Callbacks laufen im Loop (radarCommandDispatch)
+static void onMultiTargetResult(const RadarCmdResult& r) {
+  if (!r.ok) logPrintln("Radar: Multi-Target-Modus nicht bestätigt");
+}
 
-  bool ok = readSensorAck(0x0007);
+static void onRangeResult(const RadarCmdResult& r) {
   char bufAck[64];
-  if (ok) {
-    snprintf(bufAck, sizeof(bufAck), "setRange→OK: %.2fm", m);
+  if (r.ok) {
+    snprintf(bufAck, sizeof(bufAck), "setRange→OK: %.2fm%s", r.arg, r.skipped ? " (unchanged)" : "");
   } else {
-    strcpy(bufAck, "setRange→ERROR");
+    snprintf(bufAck, sizeof(bufAck), "setRange→ERROR%s", r.timeout ? ": timeout" : "");
   }
-
-  char topic[MQTT_TOPIC_BUFFER_SIZE];
-  buildMqttTopic("ack", topic, sizeof(topic));
-  safePublish(topic, bufAck);
+  publishAck(bufAck);
 }
 
-void setHoldInterval(uint32_t ms) {
-  while (Serial1.available()) {
-    Serial1.read();
+static void onHoldResult(const RadarCmdResult& r) {
+  char bufAck[64];
+  if (r.ok) {
+    snprintf(bufAck, sizeof(bufAck), "setHold→OK: %ums%s", r.params[0].value, r.skipped ? " (unchanged)" : "");
+  } else {
+    snprintf(bufAck, sizeof(bufAck), "setHold→ERROR%s", r.timeout ? ": timeout" : "");
   }
+  publishAck(bufAck);
+}
 
-  g_holdIntervalMs = ms;
+static void onConfigResult(const RadarCmdResult& r) {
+  if (r.ok) {
+    logPrintf("Radar: Konfiguration OK (geschrieben %u, unverändert %u)\n", r.written, r.skipped);
+  } else {
+    logPrintf("Radar: Konfiguration fehlgeschlagen (%s, status=%u)\n",
+              r.timeout ? "timeout" : "error", r.status);
+  }
+}
 
-  static const uint8_t openCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x04,0x00,0xFF,0x00,0x01,0x00,0x04,0x03,0x02,0x01
-  };
-  Serial1.write(openCmd, sizeof(openCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+static uint8_t rangeToGate(float m) {
+  return min((uint8_t)ceil(m / RANGE_GATE_SIZE), (uint8_t)15);
+}
 
-  uint8_t lo = ms & 0xFF, hi = (ms >> 8) & 0xFF;
-  uint8_t setCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x08,0x00,0x07,0x00,0x04,0x00,
-    lo,hi,0x00,0x00,0x04,0x03,0x02,0x01
-  };
-  Serial1.write(setCmd, sizeof(setCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+void enableMultiTargetMode() {
+  if (!radarCommandMultiTarget(onMultiTargetResult)) {
+    logPrintln("Radar: Befehls-Queue voll (multi-target)");
+  }
+}
 
-  static const uint8_t closeCmd[] = {
-    0xFD,0xFC,0xFB,0xFA,0x02,0x00,0xFE,0x00,0x04,0x03,0x02,0x01
+// Range-Gate und Hold in einer gemeinsamen open/close-Session
+void applyRadarConfig() {
+  RadarParamWrite params[] = {
+    { RADAR_PARAM_RANGE_GATE, rangeToGate(g_maxRangeMeters) },
+    { RADAR_PARAM_HOLD_MS,    g_holdIntervalMs }
   };
-  Serial1.write(closeCmd, sizeof(closeCmd));
-  delayMicroseconds(RADAR_CMD_DELAY_US);
+  if (!radarCommandSession(params, 2, g_maxRangeMeters, onConfigResult)) {
+    logPrintln("Radar: Befehls-Queue voll (config)");
+  }
+}
 
-  bool ok = readSensorAck(0x0007);
-  char bufAck[64];
-  if (ok) {
-    snprintf(bufAck, sizeof(bufAck), "setHold→OK: %ums", ms);
-  } else {
-    strcpy(bufAck, "setHold→ERROR");
+void setMaxRadarRange(float m) {
+  g_maxRangeMeters = m;
+  RadarParamWrite param = { RADAR_PARAM_RANGE_GATE, rangeToGate(m) };
+  if (!radarCommandSession(&param, 1, m, onRangeResult)) {
+    publishAck("setRange→ERROR: busy");
   }
+}
 
-  char topic[MQTT_TOPIC_BUFFER_SIZE];
-  buildMqttTopic("ack", topic, sizeof(topic));
-  safePublish(topic, bufAck);
+void setHoldInterval(uint32_t ms) {
+  g_holdIntervalMs = ms;
+  RadarParamWrite param = { RADAR_PARAM_HOLD_MS, ms };
+  if (!radarCommandSession(&param, 1, 0.0f, onHoldResult)) {
+    publishAck("setHold→ERROR: busy");
+  }
 }
 
 void restartRadarSerial() {
   logPrintln("Restarting radar serial...");
   radarSerialRestartCount++;
 
+  // Ingest-Task bis zum Ende des Neustarts von Serial1 fernhalten
+  radarSerialLock();
+
   // SICHERHEIT: Buffer leeren BEVOR Serial1.end()
   while (Serial1.available()) {
     Serial1.read();
   }
 
-  // SICHERHEIT: radarCount zurücksetzen
-  radarCount = 0;
+  // SICHERHEIT: angefangenen Frame verwerfen
+  radarPipelineReset();
 
   Serial1.end();
 
   // Non-blocking delay mit MQTT-Loop
   unsigned long start = millis();
   while (millis() - start < 100) {
-    mqttClient.loop();
+    mqttLoop();
     yield();
   }
 
-  Serial1.begin(256000, SERIAL_8N1,
-                g_radarRxPin.toInt(),
-                g_radarTxPin.toInt());
+  radarSerialBegin();
 
   // Non-blocking delay mit MQTT-Loop
   start = millis();
   while (millis() - start < 100) {
-    mqttClient.loop();
+    mqttLoop();
     yield();
   }
 
-  setMaxRadarRange(g_maxRangeMeters);
+  applyRadarConfig();
   enableMultiTargetMode();
 
+  radarSerialUnlock();
+
   // SICHERHEIT: lastRadarDataTime aktualisieren
   lastRadarDataTime = millis();
 
-  char topic[MQTT_TOPIC_BUFFER_SIZE];
-  buildMqttTopic("ack", topic, sizeof(topic));
-  safePublish(topic, "resetRadar→OK");
+  publishAck("resetRadar→OK");
   logPrintln("Radar serial restarted");
 }
 
-void parseRadarFrame(const uint8_t* buf, uint8_t len) {
-  // SICHERHEIT: Strikte Validierung
-  if (!buf || len != RADAR_FRAME_SIZE) return;
-  if (buf[0] != 0xAA || buf[1] != 0xFF || buf[2] != 0x03 || buf[3] != 0x00) return;
-
-  unsigned long now = millis();
-  for (int i = 0; i < 3; i++) {
-    int offset = 4 + i * RADAR_TARGET_BLOCKSIZE;
+void readRadarData() {
+  uint8_t chunk[128];
 
-    // SICHERHEIT: Bounds-Check
-    if (offset + RADAR_TARGET_BLOCKSIZE > len) {
-      logPrint("WARN: parseRadarFrame offset out of bounds: ");
-      logPrintln(String(offset));
-      break;
-    }
+  while (Serial1.available()) {
+    size_t n = Serial1.read(chunk, sizeof(chunk));
+    if (n == 0) break;
+    lastRadarDataTime = millis();
+    radarBytesReceived += n;
+    radarCommandFeed(chunk, n);
+    radarPipelineFeed(chunk, n);
+  }
+}
 
-    const uint8_t* b = buf + offset;
+// snap ist snapshotCacheRadar(): Payload und Vergleichsstand gehören zur selben Version
+static bool publishJson(const RadarSnapshot& snap) {
+  const char* json = snapshotCacheGet(SNAPSHOT_TARGETS);
+  if (!json) {
+    logPrintln("WARN: radar JSON zu groß");
+    return false;
+  }
+  if (snap.rxUs) metricsRecordLatency(LAT_JSON, micros() - snap.rxUs);
 
-    // SICHERHEIT: cur initialisieren!
-    RadarTarget cur = {0};
-    bool seen = false;
+  if (!safePublish(g_mqttTopic.c_str(), json)) {
+    logPrintln("WARN: MQTT publish radar failed");
+    return false;
+  }
+  if (snap.rxUs) metricsRecordLatency(LAT_MQTT, micros() - snap.rxUs);
+  return true;
+}
 
-    for (int j = 0; j < RADAR_TARGET_BLOCKSIZE; j++) {
-      if (b[j]) { seen = true; break; }
-    }
+// measure: Latenz json/mqtt erfassen (bei "both" misst nur der JSON-Publish)
+static bool publishBinary(const RadarSnapshot& snap, bool measure) {
+  uint8_t bin[RADAR_BIN_MAX_SIZE];
+  size_t len = radarBinaryEncode(snap, bin, sizeof(bin));
+  if (measure && snap.rxUs) metricsRecordLatency(LAT_JSON, micros() - snap.rxUs);
 
-    if (seen) {
-      lastSeenTime[i] = now;
-      int16_t rx = (b[1] & 0x80)
-        ? ((b[1] & 0x7F) << 8 | b[0])
-        : -((b[1] & 0x7F) << 8 | b[0]);
-      int16_t ry = (b[3] & 0x80)
-        ? ((b[3] & 0x7F) << 8 | b[2])
-        : -((b[3] & 0x7F) << 8 | b[2]);
-      cur.presence = true;
-      cur.x = rx;
-      cur.y = ry;
-      cur.speed = (b[5] & 0x80)
-        ? ((b[5] & 0x7F)<<8|b[4])
-        : -((b[5] & 0x7F)<<8|b[4]);
-      cur.distRaw = (uint16_t)b[6] | ((uint16_t)b[7] << 8);
-      cur.distanceXY = sqrtf(rx*rx + ry*ry);
-      cur.angleDeg = atan2f(ry, rx) * 180.0f / PI;
-    }
-    else if (now - lastSeenTime[i] <= g_holdIntervalMs) {
-      cur = smoothed[i];
-      cur.presence = true;
-    }
-    else {
-      cur.presence = false;
-      cur.x = cur.y = cur.speed = cur.distRaw = cur.distanceXY = cur.angleDeg = 0;
-    }
+  char topic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("bin", topic, sizeof(topic));
+  if (!safePublish(topic, bin, len)) {
+    logPrintln("WARN: MQTT publish radar bin failed");
+    return false;
+  }
+  if (measure && snap.rxUs) metricsRecordLatency(LAT_MQTT, micros() - snap.rxUs);
+  return true;
+}
 
-    if (!smoothed[i].presence) {
-      smoothed[i] = cur;
-    } else if (cur.presence) {
-      smoothed[i].x         = ALPHA * smoothed[i].x + (1 - ALPHA) * cur.x;
-      smoothed[i].y         = ALPHA * smoothed[i].y + (1 - ALPHA) * cur.y;
-      smoothed[i].speed     = ALPHA * smoothed[i].speed + (1 - ALPHA) * cur.speed;
-      smoothed[i].distRaw   = cur.distRaw;
-      smoothed[i].distanceXY= sqrtf(smoothed[i].x*smoothed[i].x +
-                                   smoothed[i].y*smoothed[i].y);
-      smoothed[i].angleDeg  = atan2f(smoothed[i].y, smoothed[i].x) * 180.0f / PI;
+static bool publishTargets(const RadarSnapshot& snap) {
+  switch (g_payloadMode) {
+    case RADAR_PAYLOAD_BIN:
+      return publishBinary(snap, true);
+    case RADAR_PAYLOAD_BOTH: {
+      bool ok = publishJson(snap);
+      return publishBinary(snap, false) && ok;
     }
-    smoothed[i].presence = cur.presence;
+    default:
+      return publishJson(snap);
   }
 }
 
-void readRadarData() {
-  const uint16_t MAX_READ = 256;
-  uint16_t readCnt = 0;
-  static uint8_t lastF[RADAR_FRAME_SIZE];
+void publishRadarJson() {
+  if (!mqttConnected()) return;
+  const RadarSnapshot& snap = snapshotCacheRadar();
+  const RadarTarget* targets = snap.targets;
+  bool any = targets[0].presence || targets[1].presence || targets[2].presence;
+  unsigned long now = millis();
 
-  while (Serial1.available() && readCnt < MAX_READ) {
-    lastRadarDataTime = millis();
+  if (!any) {
+    // 0 Targets: max. 1× pro Sekunde
+    if (now - lastZeroPub < 1000) return;
+    lastZeroPub = now;
+  }
+  publishTargets(snap);
+}
 
-    // SICHERHEIT: Buffer-Overflow-Schutz BEVOR wir schreiben
-    if (radarCount >= sizeof(radarBuf)) {
-      radarCount = 0;
-      logPrintln("WARN: radarBuf overflow reset");
-    }
+static const RadarTarget* findTrack(const RadarTarget list[3], uint16_t id) {
+  for (int i = 0; i < 3; i++) {
+    if (list[i].presence && list[i].id == id) return &list[i];
+  }
+  return nullptr;
+}
 
-    uint8_t byte = Serial1.read();
+static uint32_t absDiff(int32_t a, int32_t b) {
+  return a > b ? (uint32_t)(a - b) : (uint32_t)(b - a);
+}
 
-    // Sync-Optimierung: Bei leerem Buffer nur auf Start-Marker warten
-    if (radarCount == 0 && byte != 0xAA) {
-      readCnt++;
-      continue; // Warte auf Frame-Start
+// 0 = unverändert, 1 = geändert innerhalb der Deadbands, 2 = Publish nötig
+static int compareToPublished(const RadarTarget cur[3], const RadarTarget pub[3]) {
+  int result = 0;
+  for (int i = 0; i < 3; i++) {
+    // Verschwundene Tracks
+    if (pub[i].presence && !findTrack(cur, pub[i].id)) return 2;
+  }
+  for (int i = 0; i < 3; i++) {
+    if (!cur[i].presence) continue;
+    const RadarTarget* p = findTrack(pub, cur[i].id);
+    if (!p) return 2;                                      // neuer Track
+
+    uint32_t dx = absDiff(cur[i].x, p->x);
+    uint32_t dy = absDiff(cur[i].y, p->y);
+    uint32_t da = absDiff(cur[i].angleCdeg, p->angleCdeg);
+    if (da > 18000) da = 36000 - da;
+    uint32_t dv = absDiff(radarSpeedCmS(cur[i]), radarSpeedCmS(*p));
+    if (dx > g_deadbandMm || dy > g_deadbandMm ||
+        dx * dx + dy * dy > (uint32_t)g_deadbandMm * g_deadbandMm ||
+        da > g_deadbandCdeg || dv > g_deadbandSpeedCmS) {
+      return 2;
     }
+    if (dx || dy || da || dv) result = 1;
+  }
+  return result;
+}
 
-    radarBuf[radarCount] = byte;
-    radarCount++;
-    readCnt++;
-
-    // Frame-Ende erkannt?
-    if (radarCount >= 2 &&
-        radarBuf[radarCount-2] == 0x55 &&
-        radarBuf[radarCount-1] == 0xCC) {
-
-      // SICHERHEIT: Nur gültige Frames verarbeiten
-      if (radarCount == RADAR_FRAME_SIZE) {
-        // Prüfen, ob das Frame echte Targets enthält:
-        bool hasAnyTarget = false;
-        for (int i = 0; i < 3; i++) {
-          int offset = 4 + i * RADAR_TARGET_BLOCKSIZE;
-
-          // SICHERHEIT: Bounds-Check vor Zugriff
-          if (offset + RADAR_TARGET_BLOCKSIZE > RADAR_FRAME_SIZE) {
-            break;
-          }
-
-          const uint8_t* blk = radarBuf + offset;
-          bool empty = true;
-          for (int j = 0; j < RADAR_TARGET_BLOCKSIZE; j++) {
-            if (blk[j]) { empty = false; break; }
-          }
-          if (!empty) {
-            hasAnyTarget = true;
-            break;
-          }
-        }
-
-        // Parsing auslösen, wenn
-        //    a) es neue Target-Daten sind (memcmp ≠ 0) oder
-        //    b) gar keine Targets mehr da sind (!hasAnyTarget)
-        if (memcmp(radarBuf, lastF, RADAR_FRAME_SIZE) != 0
-            || !hasAnyTarget) {
-          memcpy(lastF, radarBuf, RADAR_FRAME_SIZE);
-          parseRadarFrame(radarBuf, radarCount);
-        }
-      } else if (radarCount > RADAR_FRAME_SIZE) {
-        // SICHERHEIT: Ungültiger Frame zu lang
-        logPrint("WARN: Invalid frame size: ");
-        logPrintln(String(radarCount));
-      }
+void publishRadarOnChange() {
+  static RadarTarget   published[3];
+  static unsigned long lastPublishMs = 0;
+  static bool          havePublished = false;
 
-      radarCount = 0;
-    }
+  if (!mqttConnected()) {
+    havePublished = false;     // nach Reconnect sofort den aktuellen Stand senden
+    return;
   }
+  const RadarSnapshot& snap = snapshotCacheRadar();
+  const RadarTarget* targets = snap.targets;
+  unsigned long now = millis();
 
-  if (Serial1.available()) yield();
+  int change = havePublished ? compareToPublished(targets, published) : 2;
+  if (change < 2 && now - lastPublishMs < g_heartbeatMs) {
+    if (change == 1) radarPublishSuppressed++;
+    return;
+  }
+  if (publishTargets(snap)) {
+    memcpy(published, targets, sizeof(published));
+    lastPublishMs = now;
+    havePublished = true;
+  }
 }
 
-void publishRadarJson() {
-  if (!mqttClient.connected()) return;
-  StaticJsonDocument<512> doc;
-  int cnt = 0;
-  for (auto &t: smoothed) if (t.presence) cnt++;
-  doc["targetCount"] = cnt;
-  for (int i = 0; i < 3; i++) {
-    char key[12];
-    snprintf(key, sizeof(key), "target%d", i + 1);
-    auto o = doc.createNestedObject(key);
-    if (!smoothed[i].presence) {
-      o["presence"] = false;
-    } else {
-      o["presence"]  = true;
-      o["x"]         = round(smoothed[i].x);
-      o["y"]         = round(smoothed[i].y);
-      o["speed"]     = round(smoothed[i].speed);
-      o["distRaw"]   = round(smoothed[i].distRaw);
-      o["distance"]  = round(smoothed[i].distanceXY);
-      o["angleDeg"]  = round(smoothed[i].angleDeg);
+// Retained <topic>/zone/<name>, nur bei Änderung. Gelöschte Zonen werden
+// mit leerem Retained-Payload vom Broker entfernt.
+void publishZones() {
+  static RadarZoneState published[RADAR_ZONE_MAX];
+  if (!mqttConnected()) return;
+
+  RadarZoneState zones[RADAR_ZONE_MAX];
+  radarZonesSnapshot(zones);
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    RadarZoneState& last = published[z];
+    char suffix[8 + RADAR_ZONE_NAME_LEN];
+    char topic[MQTT_TOPIC_BUFFER_SIZE];
+
+    bool renamed = last.defined && (!zones[z].defined || strcmp(last.name, zones[z].name) != 0);
+    if (renamed) {
+      snprintf(suffix, sizeof(suffix), "zone/%s", last.name);
+      buildMqttTopic(suffix, topic, sizeof(topic));
+      if (!safePublishRetain(topic, "")) continue;
+      last.defined = false;
+    }
+    if (!zones[z].defined) continue;
+    if (last.defined && last.count == zones[z].count) continue;
+
+    char payload[48];
+    snprintf(payload, sizeof(payload), "{\"occupied\":%s,\"count\":%u}",
+             zones[z].count ? "true" : "false", zones[z].count);
+    snprintf(suffix, sizeof(suffix), "zone/%s", zones[z].name);
+    buildMqttTopic(suffix, topic, sizeof(topic));
+    if (safePublishRetain(topic, payload)) {
+      last = zones[z];
     }
   }
-  char buf[512];
-  serializeJson(doc, buf);
-  unsigned long now = millis();
+}
 
-  if (!cnt) {
-    // 0 Targets: max. 1× pro Sekunde
-    if (now - lastZeroPub < 1000) return;
-    lastZeroPub = now;
+// Übergänge statt Zustände: läuft jede Loop-Runde unabhängig von der
+// Verbindung, die EventQueue liefert nach. Präsenz ist bereits über
+// g_holdIntervalMs entprellt (lastSeenTime im Pipeline-Hold).
+void detectRadarEvents() {
+  static bool           present = false;
+  static RadarZoneState seen[RADAR_ZONE_MAX];
+  char body[EVENT_BODY_LEN];
+
+  RadarSnapshot snap;
+  radarPipelineSnapshot(snap);
+  uint8_t cnt = 0;
+  for (int i = 0; i < 3; i++) if (snap.targets[i].presence) cnt++;
+  if ((cnt > 0) != present) {
+    present = cnt > 0;
+    snprintf(body, sizeof(body), "\"present\":%s,\"count\":%u", present ? "true" : "false", cnt);
+    publishEvent(EVENT_PRESENCE, body);
   }
 
-  if (!safePublish(g_mqttTopic.c_str(), buf)) {
-    logPrintln("WARN: MQTT publish radar failed");
+  RadarZoneState zones[RADAR_ZONE_MAX];
+  radarZonesSnapshot(zones);
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    RadarZoneState& last = seen[z];
+    if (!zones[z].defined) {
+      last.defined = false;
+      continue;
+    }
+    // Neue/umbenannte Zone startet als "frei", Belegung wird als Übergang gemeldet
+    if (!last.defined || strcmp(last.name, zones[z].name) != 0) {
+      last = zones[z];
+      last.count = 0;
+    }
+    bool occupied = zones[z].count > 0;
+    if (occupied != (last.count > 0)) {
+      snprintf(body, sizeof(body), "\"zone\":\"%s\",\"occupied\":%s,\"count\":%u",
+               zones[z].name, occupied ? "true" : "false", zones[z].count);
+      publishEvent(EVENT_ZONE, body);
+    }
+    last.count = zones[z].count;
   }
 }
 
 void publishStatus() {
-  if (!mqttClient.connected()) return;
-  StaticJsonDocument<512> doc;
+  if (!mqttConnected()) return;
+  StaticJsonDocument<STATUS_JSON_SIZE> doc;
   doc["fwVersion"]      = FW_VERSION;
   doc["uptime_min"]     = millis()/60000;
   char uptimeStr[8];
@@ -388,13 +449,47 @@ void publishStatus() {
 #endif
   doc["temp_c"]         = temperatureRead();
   doc["mqttState"]      = mqttClient.state();
+  doc["mqttAttempts"]   = mqttConnectAttempts();
   doc["wifiReconnects"] = wifiReconnectCount;
   doc["radarTimeouts"]  = radarTimeoutCount;
   doc["radarSerialRestarts"] = radarSerialRestartCount;
   doc["lastRadarDelta"] = millis() - lastRadarDataTime;
+  doc["radarBytes"]     = radarBytesReceived;
+  const RadarParser& parser = radarPipelineParser();
+  doc["radarFrames"]    = parser.frames;
+  doc["radarResyncs"]   = parser.resyncs;
+  doc["radarDiscarded"] = parser.discardedBytes;
+  doc["recorder"]       = radarRecorderReplaying() ? "replay" : (radarRecorderRecording() ? "record" : "idle");
+  doc["recFrames"]      = radarRecorderCount();
+  doc["radarOverflows"] = radarRxOverflowCount;
+  doc["radarCmdPending"] = radarCommandPending();
+  doc["snapshotRetries"] = radarSnapshotRetries();
+  doc["eventsPending"]  = eventQueuePending();
+  doc["eventsDropped"]  = eventQueueDropped();
+  doc["eventsSpilled"]  = eventQueueSpilled();
+  doc["cacheVersion"]   = snapshotCacheVersion();
+  doc["cacheBuilds"]    = snapshotCacheBuilds();
+  doc["cacheHits"]      = snapshotCacheHits();
   doc["holdMs"]         = g_holdIntervalMs;
+  doc["pubMode"]        = g_publishOnChange ? "change" : "interval";
+  doc["payload"]        = radarPayloadName(g_payloadMode);
+  doc["dbMm"]           = g_deadbandMm;
+  doc["dbDeg"]          = g_deadbandCdeg / 100.0f;
+  doc["dbSpeed"]        = g_deadbandSpeedCmS;
+  doc["heartbeatMs"]    = g_heartbeatMs;
+  doc["radarSuppressed"] = radarPublishSuppressed;
+  doc["filter"]         = radarFilterName(radarPipelineFilter());
   doc["range_m"]        = g_maxRangeMeters;
   doc["webServer"]      = isWebServerRunning();
+  doc["sseClients"]     = sseClientCount();
+  doc["wsClients"]      = wsClientCount();
+  uint32_t lastOccupied;
+  doc["lastOccupiedAgoS"] = radarHistoryLastOccupied(lastOccupied)
+                            ? (long)(radarHistoryNowSec() - lastOccupied) : -1L;
+  char latency[METRICS_JSON_SIZE];
+  if (metricsLatencyJson(latency, sizeof(latency))) {
+    doc["latency"]      = serialized(latency);
+  }
 
   // Warnmeldungen hinzufügen
   JsonArray warnings = doc.createNestedArray("warnings");
@@ -411,7 +506,7 @@ void publishStatus() {
     warnings.add("Keine Radar-Daten");
   }
 
-  char buf[512];
+  char buf[STATUS_JSON_SIZE];
   serializeJson(doc, buf);
 
   char statusTopic[MQTT_TOPIC_BUFFER_SIZE];
@@ -422,6 +517,23 @@ void publishStatus() {
   }
 }
 
+void publishMetrics() {
+  if (!mqttConnected()) return;
+  char profile[LOOP_PROFILER_JSON_SIZE];
+  char latency[METRICS_JSON_SIZE];
+  if (!loopProfilerJson(profile, sizeof(profile))) strcpy(profile, "{}");
+  if (!metricsLatencyJson(latency, sizeof(latency))) strcpy(latency, "{}");
+
+  char buf[LOOP_PROFILER_JSON_SIZE + METRICS_JSON_SIZE + 48];
+  snprintf(buf, sizeof(buf), "{\"unit\":\"us\",\"loop\":%s,\"latency\":%s}", profile, latency);
+
+  char topic[MQTT_TOPIC_BUFFER_SIZE];
+  buildMqttTopic("metrics", topic, sizeof(topic));
+  if (!safePublish(topic, buf)) {
+    logPrintln("WARN: MQTT publish metrics failed");
+  }
+}
+
 void checkRadarConnection() {
   if (millis() - lastRadarDataTime > NO_DATA_TIMEOUT) {
     if (!serialResetAttempted) {
@@ -2,16 +2,22 @@
 
 #pragma once
 #include "Config.h"
+#include "RadarPipeline.h"
 
+void setupRadar();
 void enableMultiTargetMode();
-bool readSensorAck(uint16_t expectedCmd, uint32_t timeoutMs = 500);
+void applyRadarConfig();          // Range-Gate + Hold gebündelt, nur geänderte Werte schreiben
+// Nicht-blockierend: Ergebnis kommt später über das ack-Topic
 void setMaxRadarRange(float meters);
 void setHoldInterval(uint32_t ms);
 void restartRadarSerial();
 
 void readRadarData();
-void parseRadarFrame(const uint8_t* buf, uint8_t len);
 void checkRadarConnection();
 
 void publishRadarJson();
+void publishRadarOnChange();
+void publishZones();
+void detectRadarEvents();         // Präsenz-/Zonenwechsel → EventQueue, auch offline
 void publishStatus();
+void publishMetrics();            // <topic>/metrics: Loop-Profil + Latenzen
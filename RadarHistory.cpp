@@ -0,0 +1,223 @@
+// File: RadarHistory.cpp
+
+#include "RadarHistory.h"
+#include "RadarProtocol.h"
+
+static_assert(sizeof(RadarHistorySample) == RADAR_HISTORY_SAMPLE_SIZE, "Sample muss 3 Bytes haben");
+
+#define HISTORY_1S_SAMPLES    3600
+#define HISTORY_1MIN_SAMPLES  1440
+#define HISTORY_10MIN_SAMPLES 1008
+
+static RadarHistorySample ring1s[HISTORY_1S_SAMPLES];
+static RadarHistorySample ring1min[HISTORY_1MIN_SAMPLES];
+static RadarHistorySample ring10min[HISTORY_10MIN_SAMPLES];
+
+// Eine Auflösungsstufe: Ring plus Verdichtung der darunterliegenden Stufe
+struct HistoryTier {
+  RadarHistorySample* buf;
+  uint16_t capacity;
+  uint16_t resSec;
+  uint8_t  fold;          // Samples der Stufe darunter je Sample
+  uint32_t pushed;        // Sequenz des nächsten Samples = Uptime / resSec
+  uint8_t  slots;         // bisher verdichtete Samples der Stufe darunter
+  uint8_t  dataSlots;     // davon mit Frames
+  uint16_t occSum;
+  uint8_t  maxTargets;
+  uint8_t  zones;
+};
+
+static HistoryTier tiers[RADAR_HISTORY_RES_COUNT] = {
+  { ring1s,    HISTORY_1S_SAMPLES,    1,   1,  0, 0, 0, 0, 0, 0 },
+  { ring1min,  HISTORY_1MIN_SAMPLES,  60,  60, 0, 0, 0, 0, 0, 0 },
+  { ring10min, HISTORY_10MIN_SAMPLES, 600, 10, 0, 0, 0, 0, 0, 0 },
+};
+
+// Laufende Sekunde (Frames aus dem Ingest-Task)
+static uint16_t secFrames     = 0;
+static uint16_t secOccFrames  = 0;
+static uint8_t  secMaxTargets = 0;
+static uint8_t  secZones      = 0;
+
+// Uptime ohne millis()-Überlauf; Feed (Ingest) und Tick (Loop) liefern
+// leicht versetzte Zeitstempel, Rückschritte werden ignoriert
+static bool          clockStarted = false;
+static unsigned long clockLastMs  = 0;
+static uint64_t      clockMs      = 0;
+
+static bool     everOccupied    = false;
+static uint32_t lastOccupiedSec = 0;
+
+static portMUX_TYPE histMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const RadarHistorySample NO_DATA_SAMPLE = { 0, RADAR_HISTORY_NO_DATA, 0 };
+
+static uint32_t advanceClock(unsigned long nowMs) {
+  if (!clockStarted) {
+    clockStarted = true;
+    clockMs = nowMs;
+  } else if ((long)(nowMs - clockLastMs) > 0) {
+    clockMs += nowMs - clockLastMs;
+  } else {
+    return (uint32_t)(clockMs / 1000);
+  }
+  clockLastMs = nowMs;
+  return (uint32_t)(clockMs / 1000);
+}
+
+static void pushSample(uint8_t level, const RadarHistorySample& s) {
+  HistoryTier& t = tiers[level];
+  t.buf[t.pushed % t.capacity] = s;
+  t.pushed++;
+  if (level + 1 >= RADAR_HISTORY_RES_COUNT) return;
+
+  HistoryTier& up = tiers[level + 1];
+  if (s.targets != RADAR_HISTORY_NO_DATA) {
+    up.dataSlots++;
+    up.occSum += s.occ;
+    if (s.targets > up.maxTargets) up.maxTargets = s.targets;
+    up.zones |= s.zones;
+  }
+  if (++up.slots < up.fold) return;
+
+  RadarHistorySample folded = NO_DATA_SAMPLE;
+  if (up.dataSlots) {
+    folded.occ     = (uint8_t)((up.occSum + up.dataSlots / 2) / up.dataSlots);
+    folded.targets = up.maxTargets;
+    folded.zones   = up.zones;
+  }
+  up.slots = up.dataSlots = 0;
+  up.occSum = 0;
+  up.maxTargets = up.zones = 0;
+  pushSample(level + 1, folded);
+}
+
+// Alle Sekunden vor sec abschließen; nur die erste trägt die gesammelten Frames
+static void closeUntil(uint32_t sec) {
+  while (tiers[RADAR_HISTORY_1S].pushed < sec) {
+    RadarHistorySample s = NO_DATA_SAMPLE;
+    if (secFrames) {
+      s.occ     = (uint8_t)((secOccFrames * 255U + secFrames / 2) / secFrames);
+      s.targets = secMaxTargets;
+      s.zones   = secZones;
+    }
+    secFrames = secOccFrames = 0;
+    secMaxTargets = secZones = 0;
+    pushSample(RADAR_HISTORY_1S, s);
+  }
+}
+
+void radarHistoryFeed(unsigned long nowMs, uint8_t targets, uint8_t zoneMask) {
+  portENTER_CRITICAL(&histMux);
+  uint32_t sec = advanceClock(nowMs);
+  closeUntil(sec);
+  if (secFrames < UINT16_MAX) {
+    secFrames++;
+    if (targets) secOccFrames++;
+  }
+  if (targets > secMaxTargets) secMaxTargets = targets;
+  secZones |= zoneMask;
+  if (targets) {
+    everOccupied = true;
+    lastOccupiedSec = sec;
+  }
+  portEXIT_CRITICAL(&histMux);
+}
+
+void radarHistoryTick(unsigned long nowMs) {
+  portENTER_CRITICAL(&histMux);
+  closeUntil(advanceClock(nowMs));
+  portEXIT_CRITICAL(&histMux);
+}
+
+uint16_t radarHistoryResSeconds(RadarHistoryRes res) {
+  return res < RADAR_HISTORY_RES_COUNT ? tiers[res].resSec : 0;
+}
+
+bool radarHistoryResFromSeconds(uint32_t seconds, RadarHistoryRes& res) {
+  for (uint8_t i = 0; i < RADAR_HISTORY_RES_COUNT; i++) {
+    if (tiers[i].resSec == seconds) {
+      res = (RadarHistoryRes)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t radarHistoryNowSec() {
+  portENTER_CRITICAL(&histMux);
+  uint32_t sec = (uint32_t)(clockMs / 1000);
+  portEXIT_CRITICAL(&histMux);
+  return sec;
+}
+
+bool radarHistoryLastOccupied(uint32_t& sec) {
+  portENTER_CRITICAL(&histMux);
+  bool ever = everOccupied;
+  sec = lastOccupiedSec;
+  portEXIT_CRITICAL(&histMux);
+  return ever;
+}
+
+size_t radarHistoryExportBegin(RadarHistoryRes res, uint32_t fromSec, RadarHistoryRange& range) {
+  if (res >= RADAR_HISTORY_RES_COUNT) res = RADAR_HISTORY_1S;
+  const HistoryTier& t = tiers[res];
+  portENTER_CRITICAL(&histMux);
+  uint32_t pushed = t.pushed;
+  uint32_t oldest = pushed > t.capacity ? pushed - t.capacity : 0;
+  uint32_t first  = fromSec / t.resSec;
+  if (first < oldest) first = oldest;
+  if (first > pushed) first = pushed;
+  range.res      = res;
+  range.firstSeq = first;
+  range.count    = pushed - first;
+  range.nowSec   = (uint32_t)(clockMs / 1000);
+  portEXIT_CRITICAL(&histMux);
+  return RADAR_HISTORY_HEADER_SIZE + (size_t)range.count * RADAR_HISTORY_SAMPLE_SIZE;
+}
+
+// Samples blockweise unter der Sperre kopieren, damit der Ingest-Task nie
+// länger als ein paar Dutzend Kopien warten muss
+#define HISTORY_READ_BLOCK 32
+
+size_t radarHistoryExportRead(const RadarHistoryRange& range, size_t offset, uint8_t* out, size_t len) {
+  const HistoryTier& t = tiers[range.res];
+  size_t total = RADAR_HISTORY_HEADER_SIZE + (size_t)range.count * RADAR_HISTORY_SAMPLE_SIZE;
+  size_t written = 0;
+
+  if (offset < RADAR_HISTORY_HEADER_SIZE && written < len) {
+    uint8_t header[RADAR_HISTORY_HEADER_SIZE];
+    memcpy(header, RADAR_HISTORY_MAGIC, 4);
+    header[4] = RADAR_HISTORY_VERSION;
+    header[5] = RADAR_HISTORY_SAMPLE_SIZE;
+    radarPutU16(header + 6, t.resSec);
+    radarPutU32(header + 8, range.firstSeq * t.resSec);
+    radarPutU32(header + 12, range.count);
+    radarPutU32(header + 16, range.nowSec);
+    size_t n = min(len, (size_t)RADAR_HISTORY_HEADER_SIZE - offset);
+    memcpy(out, header + offset, n);
+    written += n;
+    offset += n;
+  }
+
+  while (written < len && offset < total) {
+    size_t rel = offset - RADAR_HISTORY_HEADER_SIZE;
+    uint32_t idx = rel / RADAR_HISTORY_SAMPLE_SIZE;
+    size_t within = rel % RADAR_HISTORY_SAMPLE_SIZE;
+    uint32_t n = min((uint32_t)HISTORY_READ_BLOCK, range.count - idx);
+
+    RadarHistorySample block[HISTORY_READ_BLOCK];
+    portENTER_CRITICAL(&histMux);
+    for (uint32_t i = 0; i < n; i++) {
+      uint32_t seq = range.firstSeq + idx + i;
+      block[i] = (seq + t.capacity >= t.pushed) ? t.buf[seq % t.capacity] : NO_DATA_SAMPLE;
+    }
+    portEXIT_CRITICAL(&histMux);
+
+    size_t bytes = min(len - written, (size_t)n * RADAR_HISTORY_SAMPLE_SIZE - within);
+    memcpy(out + written, (const uint8_t*)block + within, bytes);
+    written += bytes;
+    offset += bytes;
+  }
+  return written;
+}
@@ -0,0 +1,64 @@
+// File: RadarHistory.h
+
+#pragma once
+#include "Config.h"
+
+// Belegungsverlauf im RAM, drei Auflösungen mit fester Größe (statische
+// Ringe, kein Heap): 1 s für die letzte Stunde, 1 min für den letzten Tag,
+// 10 min für die letzte Woche. Der Ingest-Task meldet jeden Frame
+// (radarHistoryFeed), abgeschlossene Sekunden laufen in den 1-s-Ring und
+// werden dabei laufend zu Minuten bzw. 10-Minuten-Werten verdichtet – O(1)
+// pro Frame und pro Sample. Zeitbasis ist die Uptime in Sekunden; Sample k
+// einer Stufe beginnt bei k · Auflösung.
+//
+// Sample (3 Bytes):
+//   occ      Anteil der Frames mit mindestens einem Target, 0..255
+//   targets  höchste Target-Anzahl im Intervall, RADAR_HISTORY_NO_DATA = keine Frames
+//   zones    Bit z: Zone z war im Intervall belegt
+//
+// Export (/api/history, little endian), 20 + count·3 Bytes:
+//   Header  "RHST" | version u8 | sampleSize u8 | resSec u16 | firstSec u32 | count u32 | nowSec u32
+//   Sample  occ u8 | targets u8 | zones u8
+
+#define RADAR_HISTORY_MAGIC        "RHST"
+#define RADAR_HISTORY_VERSION      1
+#define RADAR_HISTORY_HEADER_SIZE  20
+#define RADAR_HISTORY_SAMPLE_SIZE  3
+#define RADAR_HISTORY_NO_DATA      0xFF
+
+enum RadarHistoryRes : uint8_t {
+  RADAR_HISTORY_1S,       // 3600 Samples = 1 h
+  RADAR_HISTORY_1MIN,     // 1440 Samples = 1 Tag
+  RADAR_HISTORY_10MIN,    // 1008 Samples = 1 Woche
+  RADAR_HISTORY_RES_COUNT
+};
+
+struct RadarHistorySample {
+  uint8_t occ;
+  uint8_t targets;
+  uint8_t zones;
+};
+
+// Vom Export festgehaltener Ausschnitt; Samples, die während des Streamens
+// überschrieben werden, kommen als NO_DATA
+struct RadarHistoryRange {
+  RadarHistoryRes res;
+  uint32_t        firstSeq;
+  uint32_t        count;
+  uint32_t        nowSec;
+};
+
+// Ingest-Task, pro Frame: aktueller Stand nach Tracking und Zonen
+void     radarHistoryFeed(unsigned long nowMs, uint8_t targets, uint8_t zoneMask);
+// Loop: Sekunden ohne Frames (Sensor still) ebenfalls abschließen
+void     radarHistoryTick(unsigned long nowMs);
+
+uint16_t radarHistoryResSeconds(RadarHistoryRes res);
+bool     radarHistoryResFromSeconds(uint32_t seconds, RadarHistoryRes& res);
+uint32_t radarHistoryNowSec();
+// Uptime-Sekunde der letzten belegten Sekunde; false = seit Boot nie belegt
+bool     radarHistoryLastOccupied(uint32_t& sec);
+
+// Export ab Uptime-Sekunde fromSec (auf die Auflösung abgerundet)
+size_t   radarHistoryExportBegin(RadarHistoryRes res, uint32_t fromSec, RadarHistoryRange& range);
+size_t   radarHistoryExportRead(const RadarHistoryRange& range, size_t offset, uint8_t* out, size_t len);
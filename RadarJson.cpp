@@ -0,0 +1,36 @@
+// File: RadarJson.cpp
+
+#include "RadarJson.h"
+
+uint8_t radarTargetCount(const RadarTarget targets[3]) {
+  uint8_t cnt = 0;
+  for (int i = 0; i < 3; i++) if (targets[i].presence) cnt++;
+  return cnt;
+}
+
+void radarJsonTargets(JsonWriter& w, const RadarTarget targets[3], bool withDistRaw) {
+  w.beginArray("targets");
+  for (int i = 0; i < 3; i++) {
+    const RadarTarget& t = targets[i];
+    if (!t.presence) continue;
+    w.beginObject()
+     .field("id", t.id)
+     .field("x", t.x)
+     .field("y", t.y)
+     .field("speed", radarSpeedCmS(t));
+    if (withDistRaw) w.field("distRaw", t.distRaw);
+    w.field("distance", t.distanceXY)
+     .field("angleDeg", radarAngleDeg(t));
+    if (t.sigma) w.field("sigma", t.sigma);
+    w.endObject();
+  }
+  w.endArray();
+}
+
+size_t radarTargetsJson(char* buf, size_t size, const RadarSnapshot& snap) {
+  JsonWriter w(buf, size);
+  w.beginObject().field("targetCount", radarTargetCount(snap.targets));
+  radarJsonTargets(w, snap.targets, true);
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
@@ -0,0 +1,17 @@
+// File: RadarJson.h
+
+#pragma once
+#include "Config.h"
+#include "JsonWriter.h"
+#include "RadarPipeline.h"
+
+// Target-JSON für <topic>, Dashboard und /api/radar über JsonWriter
+// (host-buildbar, siehe host/json_bench).
+
+#define RADAR_TARGETS_JSON_SIZE 512
+
+uint8_t radarTargetCount(const RadarTarget targets[3]);
+// Member "targets":[…]; distRaw nur im MQTT-Payload
+void    radarJsonTargets(JsonWriter& w, const RadarTarget targets[3], bool withDistRaw);
+// Komplettes <topic>-Payload {"targetCount":n,"targets":[…]}; 0 = Puffer zu klein
+size_t  radarTargetsJson(char* buf, size_t size, const RadarSnapshot& snap);
@@ -0,0 +1,95 @@
+// File: RadarMath.cpp
+
+#include "RadarMath.h"
+
+// atan(i/256) in Milligrad für i = 0..256 (0°..45°)
+static const uint16_t ATAN_MDEG[257] = {
+      0,   224,   448,   671,   895,  1119,  1343,  1566,  1790,  2013,
+   2237,  2460,  2684,  2907,  3130,  3353,  3576,  3799,  4022,  4245,
+   4467,  4690,  4912,  5134,  5356,  5578,  5799,  6021,  6242,  6463,
+   6684,  6905,  7125,  7345,  7565,  7785,  8005,  8224,  8443,  8662,
+   8881,  9099,  9317,  9535,  9752,  9970, 10187, 10403, 10620, 10836,
+  11051, 11267, 11482, 11697, 11911, 12125, 12339, 12553, 12766, 12978,
+  13191, 13403, 13614, 13825, 14036, 14247, 14457, 14666, 14876, 15085,
+  15293, 15501, 15709, 15916, 16123, 16329, 16535, 16740, 16945, 17150,
+  17354, 17558, 17761, 17964, 18166, 18368, 18569, 18770, 18970, 19170,
+  19370, 19569, 19767, 19965, 20163, 20360, 20556, 20752, 20947, 21142,
+  21337, 21531, 21724, 21917, 22109, 22301, 22493, 22683, 22874, 23063,
+  23253, 23441, 23629, 23817, 24004, 24191, 24376, 24562, 24747, 24931,
+  25115, 25298, 25481, 25663, 25844, 26025, 26206, 26386, 26565, 26744,
+  26922, 27100, 27277, 27453, 27629, 27805, 27979, 28154, 28327, 28501,
+  28673, 28845, 29017, 29187, 29358, 29527, 29697, 29865, 30033, 30201,
+  30368, 30534, 30700, 30865, 31030, 31194, 31357, 31520, 31682, 31844,
+  32005, 32166, 32326, 32486, 32645, 32803, 32961, 33118, 33275, 33431,
+  33587, 33742, 33896, 34050, 34203, 34356, 34509, 34660, 34811, 34962,
+  35112, 35262, 35410, 35559, 35707, 35854, 36001, 36147, 36293, 36438,
+  36582, 36726, 36870, 37013, 37155, 37297, 37439, 37579, 37720, 37859,
+  37999, 38137, 38276, 38413, 38550, 38687, 38823, 38959, 39094, 39228,
+  39362, 39496, 39629, 39762, 39894, 40025, 40156, 40286, 40416, 40546,
+  40675, 40803, 40931, 41059, 41186, 41312, 41438, 41564, 41689, 41814,
+  41938, 42061, 42184, 42307, 42429, 42551, 42672, 42793, 42913, 43033,
+  43152, 43271, 43390, 43508, 43625, 43742, 43859, 43975, 44091, 44206,
+  44321, 44435, 44549, 44662, 44775, 44888, 45000
+};
+
+// round(16·√i) für i = 0..255, Startwert für radarIsqrt32()
+static const uint8_t SQRT_SEED[256] = {
+    0,  16,  23,  28,  32,  36,  39,  42,  45,  48,  51,  53,  55,  58,  60,  62,
+   64,  66,  68,  70,  72,  73,  75,  77,  78,  80,  82,  83,  85,  86,  88,  89,
+   91,  92,  93,  95,  96,  97,  99, 100, 101, 102, 104, 105, 106, 107, 109, 110,
+  111, 112, 113, 114, 115, 116, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 139, 140, 141, 142,
+  143, 144, 145, 146, 147, 148, 148, 149, 150, 151, 152, 153, 153, 154, 155, 156,
+  157, 158, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 166, 167, 168, 169,
+  169, 170, 171, 172, 172, 173, 174, 175, 175, 176, 177, 177, 178, 179, 180, 180,
+  181, 182, 182, 183, 184, 185, 185, 186, 187, 187, 188, 189, 189, 190, 191, 191,
+  192, 193, 193, 194, 195, 195, 196, 197, 197, 198, 199, 199, 200, 200, 201, 202,
+  202, 203, 204, 204, 205, 206, 206, 207, 207, 208, 209, 209, 210, 210, 211, 212,
+  212, 213, 213, 214, 215, 215, 216, 216, 217, 218, 218, 219, 219, 220, 221, 221,
+  222, 222, 223, 223, 224, 225, 225, 226, 226, 227, 227, 228, 229, 229, 230, 230,
+  231, 231, 232, 232, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238, 239,
+  239, 240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247,
+  248, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 255
+};
+
+uint16_t radarIsqrt32(uint32_t v) {
+  if (v == 0) return 0;
+
+  // Obere 8 Bit (gerade Verschiebung) liefern über die Tabelle einen
+  // Startwert auf ~0,5 %, ein Newton-Schritt drückt den Fehler unter 1
+  uint32_t nbits = 32 - __builtin_clz(v);
+  uint32_t shift = nbits > 8 ? ((nbits - 7) & ~1U) : 0;
+  uint32_t x = ((uint32_t)SQRT_SEED[v >> shift] << (shift >> 1)) >> 4;
+  if (x == 0) x = 1;
+  x = (x + v / x) >> 1;
+
+  // auf floor(√v) korrigieren, danach zur nächsten Ganzzahl runden
+  if (x > 0xFFFF) x = 0xFFFF;
+  while (x * x > v) x--;
+  while (x < 0xFFFF && (x + 1) * (x + 1) <= v) x++;
+  if (v - x * x > x && x < 0xFFFF) x++;
+  return (uint16_t)x;
+}
+
+// atan(num/den) für 0 ≤ num ≤ den, den > 0, in Milligrad
+static uint32_t atanOctantMdeg(uint32_t num, uint32_t den) {
+  uint32_t r = (num << 16) / den;              // Q16, 0..65536
+  uint32_t idx = r >> 8;
+  uint32_t frac = r & 0xFF;
+  if (idx >= 256) return ATAN_MDEG[256];
+  uint32_t a = ATAN_MDEG[idx];
+  uint32_t b = ATAN_MDEG[idx + 1];
+  return a + (((b - a) * frac + 128) >> 8);
+}
+
+int16_t radarAtan2Cdeg(int32_t y, int32_t x) {
+  uint32_t ax = x < 0 ? -x : x;
+  uint32_t ay = y < 0 ? -y : y;
+  if (ax == 0 && ay == 0) return 0;
+
+  uint32_t mdeg = (ay <= ax) ? atanOctantMdeg(ay, ax)
+                             : 90000 - atanOctantMdeg(ax, ay);
+  if (x < 0) mdeg = 180000 - mdeg;
+  int32_t cdeg = (int32_t)((mdeg + 5) / 10);
+  return (int16_t)(y < 0 ? -cdeg : cdeg);
+}
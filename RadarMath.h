@@ -0,0 +1,10 @@
+// File: RadarMath.h
+
+#pragma once
+#include <stdint.h>
+
+// Ganzzahl-Mathematik für den Radar-Hot-Path: ersetzt sqrtf/atan2f pro
+// Target. Einheiten: mm, mm/s, Zentigrad (1/100°). Gültig für |x|,|y| ≤ 65535.
+
+uint16_t radarIsqrt32(uint32_t v);               // gerundet auf die nächste Ganzzahl
+int16_t  radarAtan2Cdeg(int32_t y, int32_t x);   // -18000..18000, Fehler ≤ 1 cdeg
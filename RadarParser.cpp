@@ -0,0 +1,128 @@
+// File: RadarParser.cpp
+
+#include "RadarParser.h"
+#include <string.h>
+
+static const uint8_t RADAR_HEADER[4] = {0xAA, 0xFF, 0x03, 0x00};
+static const uint8_t RADAR_TAIL[2]   = {0x55, 0xCC};
+static const size_t  RADAR_TAIL_POS  = RADAR_FRAME_SIZE - sizeof(RADAR_TAIL);
+
+static bool matchesHeaderPrefix(const uint8_t* b, size_t n) {
+  if (n > sizeof(RADAR_HEADER)) n = sizeof(RADAR_HEADER);
+  return memcmp(b, RADAR_HEADER, n) == 0;
+}
+
+static bool hasTail(const uint8_t* frame) {
+  return frame[RADAR_TAIL_POS] == RADAR_TAIL[0] &&
+         frame[RADAR_TAIL_POS + 1] == RADAR_TAIL[1];
+}
+
+// Ein abgeschnittener Frame, gefolgt vom nächsten echten Frame, kann zufällig
+// ein passendes Tail ergeben. Enthält der Kandidat einen vollständigen
+// Header, wird ab dort neu synchronisiert (liefert den Offset, sonst 0).
+static size_t embeddedHeaderOffset(const uint8_t* frame) {
+  for (size_t k = 1; k + sizeof(RADAR_HEADER) <= RADAR_TAIL_POS; k++) {
+    if (frame[k] == RADAR_HEADER[0] && matchesHeaderPrefix(frame + k, sizeof(RADAR_HEADER))) {
+      return k;
+    }
+  }
+  return 0;
+}
+
+static bool isValidFrame(const uint8_t* frame) {
+  return matchesHeaderPrefix(frame, sizeof(RADAR_HEADER)) &&
+         hasTail(frame) &&
+         embeddedHeaderOffset(frame) == 0;
+}
+
+static void discard(RadarParser& p, size_t n) {
+  if (n == 0) return;
+  p.discardedBytes += n;
+  if (p.inSync) {
+    p.inSync = false;
+    p.resyncs++;
+  }
+}
+
+static void emit(RadarParser& p, const uint8_t* frame, RadarFrameHandler onFrame) {
+  p.frames++;
+  p.inSync = true;
+  if (onFrame) onFrame(frame);
+}
+
+// Verworfenen Kandidaten im Staging-Puffer um mindestens ein Byte weiter
+// schieben, bis der Rest wieder ein gültiger Header-Anfang ist
+static void slide(RadarParser& p) {
+  uint8_t k = 1;
+  while (k < p.count && !matchesHeaderPrefix(p.buf + k, p.count - k)) k++;
+  discard(p, k);
+  p.count -= k;
+  if (p.count) memmove(p.buf, p.buf + k, p.count);
+}
+
+void radarParserInit(RadarParser& p) {
+  memset(&p, 0, sizeof(p));
+  p.inSync = true;
+}
+
+void radarParserReset(RadarParser& p) {
+  p.count = 0;
+  p.inSync = true;
+}
+
+void radarParserFeed(RadarParser& p, const uint8_t* data, size_t len, RadarFrameHandler onFrame) {
+  if (!data) return;
+  size_t i = 0;
+
+  while (i < len) {
+    if (p.count == 0) {
+      // Bis zum nächsten möglichen Header-Start springen
+      if (data[i] != RADAR_HEADER[0]) {
+        const uint8_t* next = (const uint8_t*)memchr(data + i, RADAR_HEADER[0], len - i);
+        size_t skip = next ? (size_t)(next - (data + i)) : (len - i);
+        discard(p, skip);
+        i += skip;
+        continue;
+      }
+
+      // Fast path: ganzer Frame liegt im Empfangspuffer → in place parsen
+      size_t avail = len - i;
+      if (avail >= RADAR_FRAME_SIZE) {
+        if (isValidFrame(data + i)) {
+          emit(p, data + i, onFrame);
+          i += RADAR_FRAME_SIZE;
+        } else {
+          discard(p, 1);
+          i++;
+        }
+        continue;
+      }
+      if (!matchesHeaderPrefix(data + i, avail)) {
+        discard(p, 1);
+        i++;
+        continue;
+      }
+    }
+
+    // Slow path: Frame läuft über das Chunk-Ende → stagen
+    size_t take = RADAR_FRAME_SIZE - p.count;
+    if (take > len - i) take = len - i;
+    memcpy(p.buf + p.count, data + i, take);
+    uint8_t before = p.count;
+    p.count += take;
+    i += take;
+
+    if (before < sizeof(RADAR_HEADER) && !matchesHeaderPrefix(p.buf, p.count)) {
+      slide(p);
+      continue;
+    }
+    if (p.count == RADAR_FRAME_SIZE) {
+      if (isValidFrame(p.buf)) {
+        emit(p, p.buf, onFrame);
+        p.count = 0;
+      } else {
+        slide(p);
+      }
+    }
+  }
+}
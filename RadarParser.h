@@ -0,0 +1,30 @@
+// File: RadarParser.h
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Config.h"
+
+// Streaming-Parser für RD-03D Report-Frames:
+//   AA FF 03 00 | 3 × 8 Byte Target | 55 CC   (RADAR_FRAME_SIZE Bytes)
+// Synchronisiert auf den vollständigen 4-Byte-Header, prüft das Tail an der
+// erwarteten Position und gleitet bei Fehlern byteweise weiter statt den
+// Puffer zu verwerfen. Vollständige Frames im Empfangspuffer werden ohne
+// Kopie direkt an den Handler übergeben; nur Frames, die über eine
+// Chunk-Grenze laufen, werden in buf zwischengespeichert.
+
+typedef void (*RadarFrameHandler)(const uint8_t* frame);
+
+struct RadarParser {
+  uint8_t  buf[RADAR_FRAME_SIZE];
+  uint8_t  count;
+  bool     inSync;
+  uint32_t frames;          // gültige Frames
+  uint32_t resyncs;         // Sync-Verluste (je zusammenhängender Verwurf)
+  uint32_t discardedBytes;  // Bytes, die keinem gültigen Frame angehörten
+};
+
+void radarParserInit(RadarParser& p);
+void radarParserReset(RadarParser& p);
+void radarParserFeed(RadarParser& p, const uint8_t* data, size_t len, RadarFrameHandler onFrame);
@@ -0,0 +1,300 @@
+// File: RadarPipeline.cpp
+// Frame → Targets: Deduplizierung, Parsing und Glättung. Bewusst ohne
+// Serial1-/Netzwerk-Abhängigkeiten, damit der Pfad auch im Host-Build
+// (host/) gegen aufgezeichnete Byte-Streams läuft.
+
+#include "RadarPipeline.h"
+#include "RadarRecorder.h"
+#include "RadarMath.h"
+#include "RadarAssociation.h"
+#include "RadarZones.h"
+#include "RadarHistory.h"
+#include "SeqLock.h"
+#include "Metrics.h"
+#include "Config.h"
+
+// smoothed[], lastSeenTime[] und radarKalman[] gehören allein dem
+// Ingest-Task; alle anderen lesen nur den veröffentlichten Snapshot.
+static SeqLock<RadarSnapshot> radarSnapshot;
+static std::atomic<uint32_t>  snapshotRetries{0};
+static uint32_t     snapshotFrame = 0;
+
+// Latenz-Zeitstempel (nur Ingest-Task)
+static uint32_t     chunkRxUs   = 0;   // micros() des aktuellen UART-Reads
+static uint32_t     carryRxUs   = 0;   // Start des über Chunk-Grenzen laufenden Frames
+static uint32_t     frameRxUs   = 0;   // erstes Byte des gerade geparsten Frames
+static RadarParser  radarParser;
+static RadarKalman  radarKalman[3];
+static volatile RadarFilterMode radarFilterRequested = RADAR_FILTER_EMA;
+static RadarFilterMode radarFilterActive = RADAR_FILTER_EMA;
+static uint16_t     nextTrackId = 1;
+static uint8_t      zoneMask    = 0;   // belegte Zonen nach dem letzten geparsten Frame
+
+static void publishSnapshot(unsigned long now) {
+  RadarSnapshot snap;
+  snap.frame  = ++snapshotFrame;
+  snap.timeMs = now;
+  snap.rxUs   = frameRxUs;
+  memcpy(snap.targets, smoothed, sizeof(snap.targets));
+  radarSnapshot.write(snap);
+}
+
+// Vor dem Start des Ingest-Tasks aufrufen
+void radarPipelineInit() {
+  radarParserInit(radarParser);
+  memset(radarKalman, 0, sizeof(radarKalman));
+  memset(smoothed, 0, sizeof(smoothed));
+  memset(lastSeenTime, 0, sizeof(lastSeenTime));
+  publishSnapshot(millis());
+}
+
+void radarPipelineReset() {
+  radarParserReset(radarParser);
+}
+
+const RadarParser& radarPipelineParser() {
+  return radarParser;
+}
+
+void radarPipelineSetFilter(RadarFilterMode mode) {
+  radarFilterRequested = mode;
+}
+
+RadarFilterMode radarPipelineFilter() {
+  return radarFilterRequested;
+}
+
+void radarPipelineSnapshot(RadarSnapshot& out) {
+  uint32_t retries = radarSnapshot.read(out);
+  if (retries) snapshotRetries.fetch_add(retries, std::memory_order_relaxed);
+}
+
+void getRadarTargets(RadarTarget out[3]) {
+  RadarSnapshot snap;
+  radarPipelineSnapshot(snap);
+  memcpy(out, snap.targets, sizeof(snap.targets));
+}
+
+uint32_t radarSnapshotRetries() {
+  return snapshotRetries.load(std::memory_order_relaxed);
+}
+
+// RD-03D Vorzeichenformat: Bit 15 gesetzt = positiv, sonst negativ
+static int16_t decodeSigned(const uint8_t* b) {
+  int16_t mag = (int16_t)(((b[1] & 0x7F) << 8) | b[0]);
+  return (b[1] & 0x80) ? mag : -mag;
+}
+
+// EMA in Ganzzahl-Arithmetik: prev·α + cur·(1-α), α als Q8
+static const int32_t ALPHA_Q8 = (int32_t)(ALPHA * 256.0f + 0.5f);
+
+static int32_t emaQ8(int32_t prev, int32_t cur) {
+  return prev + (((cur - prev) * (256 - ALPHA_Q8) + 128) >> 8);
+}
+
+static void updatePolar(RadarTarget& t) {
+  t.distanceXY = radarIsqrt32((uint32_t)((int32_t)t.x * t.x) + (uint32_t)((int32_t)t.y * t.y));
+  t.angleCdeg  = radarAtan2Cdeg(t.y, t.x);
+}
+
+static int16_t clampMm(float v) {
+  if (v > 32767.0f) return 32767;
+  if (v < -32767.0f) return -32767;
+  return (int16_t)lroundf(v);
+}
+
+static void kalmanOutput(int i) {
+  const RadarKalman& k = radarKalman[i];
+  RadarTarget& out = smoothed[i];
+  out.x     = clampMm(k.s[0]);
+  out.y     = clampMm(k.s[1]);
+  out.speed = lroundf(radarKalmanRadialSpeed(k));
+  out.sigma = radarKalmanSigma(k);
+  updatePolar(out);
+}
+
+// Neuer Track aus einer nicht zugeordneten Messung
+static void trackStart(int i, const RadarTarget& det, unsigned long now) {
+  smoothed[i] = det;
+  smoothed[i].id = nextTrackId++;
+  if (nextTrackId == 0) nextTrackId = 1;
+  lastSeenTime[i] = now;
+  if (radarFilterActive == RADAR_FILTER_KALMAN) {
+    radarKalmanInit(radarKalman[i], det.x, det.y, (float)det.speed, now);
+    kalmanOutput(i);
+  } else {
+    updatePolar(smoothed[i]);
+  }
+}
+
+// Zugeordnete Messung einarbeiten (Kalman wurde bereits prädiziert)
+static void trackUpdate(int i, const RadarTarget& det, unsigned long now) {
+  RadarTarget& t = smoothed[i];
+  lastSeenTime[i] = now;
+  t.distRaw = det.distRaw;
+  if (radarFilterActive == RADAR_FILTER_KALMAN) {
+    RadarKalman& k = radarKalman[i];
+    if (!radarKalmanUpdate(k, det.x, det.y, (float)det.speed)) {
+      radarKalmanInit(k, det.x, det.y, (float)det.speed, now);
+    }
+    kalmanOutput(i);
+    return;
+  }
+  // Polarwerte nur einmal pro Target aus dem geglätteten Ergebnis rechnen
+  t.x     = (int16_t)emaQ8(t.x, det.x);
+  t.y     = (int16_t)emaQ8(t.y, det.y);
+  t.speed = emaQ8(t.speed, det.speed);
+  updatePolar(t);
+}
+
+// Ohne Messung: innerhalb des Hold-Intervalls EMA einfrieren bzw. Kalman
+// weiter prädizieren, danach Track freigeben
+static void trackCoast(int i, unsigned long now) {
+  if (now - lastSeenTime[i] > g_holdIntervalMs) {
+    radarKalman[i].active = false;
+    smoothed[i] = RadarTarget{};
+    return;
+  }
+  if (radarFilterActive == RADAR_FILTER_KALMAN) kalmanOutput(i);
+}
+
+// Filterwechsel: Tracks neu aufsetzen, damit kein Zustand des anderen
+// Filters übernommen wird
+static void applyFilterMode() {
+  RadarFilterMode mode = radarFilterRequested;
+  if (mode == radarFilterActive) return;
+  radarFilterActive = mode;
+  for (int i = 0; i < 3; i++) {
+    radarKalman[i].active = false;
+    smoothed[i] = RadarTarget{};
+  }
+}
+
+void parseRadarFrame(const uint8_t* buf, uint8_t len) {
+  // SICHERHEIT: Strikte Validierung
+  if (!buf || len != RADAR_FRAME_SIZE) return;
+  if (buf[0] != 0xAA || buf[1] != 0xFF || buf[2] != 0x03 || buf[3] != 0x00) return;
+
+  unsigned long now = millis();
+  applyFilterMode();
+
+  RadarTarget det[3] = {};
+  RadarPoint  detPos[3] = {};
+  for (int i = 0; i < 3; i++) {
+    int offset = 4 + i * RADAR_TARGET_BLOCKSIZE;
+
+    // SICHERHEIT: Bounds-Check
+    if (offset + RADAR_TARGET_BLOCKSIZE > len) {
+      break;
+    }
+
+    const uint8_t* b = buf + offset;
+    bool seen = false;
+    for (int j = 0; j < RADAR_TARGET_BLOCKSIZE; j++) {
+      if (b[j]) { seen = true; break; }
+    }
+    if (!seen) continue;
+
+    det[i].presence = true;
+    det[i].x        = decodeSigned(b);
+    det[i].y        = decodeSigned(b + 2);
+    det[i].speed    = (int32_t)decodeSigned(b + 4) * 10;   // cm/s → mm/s
+    det[i].distRaw  = (uint16_t)b[6] | ((uint16_t)b[7] << 8);
+    detPos[i] = RadarPoint{ det[i].x, det[i].y, true };
+  }
+
+  // Tracks auf den aktuellen Zeitpunkt prognostizieren und zuordnen
+  RadarPoint trackPos[3] = {};
+  for (int i = 0; i < 3; i++) {
+    if (!smoothed[i].presence) continue;
+    if (radarFilterActive == RADAR_FILTER_KALMAN) {
+      radarKalmanPredict(radarKalman[i], now);
+      trackPos[i] = RadarPoint{ (int32_t)radarKalman[i].s[0], (int32_t)radarKalman[i].s[1], true };
+    } else {
+      trackPos[i] = RadarPoint{ smoothed[i].x, smoothed[i].y, true };
+    }
+  }
+  int8_t detForTrack[3];
+  radarAssociate(trackPos, detPos, detForTrack);
+
+  bool detUsed[3] = { false, false, false };
+  for (int i = 0; i < 3; i++) {
+    if (!smoothed[i].presence) continue;
+    if (detForTrack[i] >= 0) {
+      detUsed[detForTrack[i]] = true;
+      trackUpdate(i, det[detForTrack[i]], now);
+    } else {
+      trackCoast(i, now);
+    }
+  }
+
+  // Übrige Messungen eröffnen neue Tracks in freien Plätzen
+  for (int d = 0; d < 3; d++) {
+    if (!det[d].presence || detUsed[d]) continue;
+    for (int i = 0; i < 3; i++) {
+      if (smoothed[i].presence) continue;
+      trackStart(i, det[d], now);
+      break;
+    }
+  }
+  publishSnapshot(now);
+  if (frameRxUs) metricsRecordLatency(LAT_PARSED, micros() - frameRxUs);
+  zoneMask = radarZonesEvaluate(smoothed);
+}
+
+static void pipelineFrame(const uint8_t* frame) {
+  static uint8_t lastF[RADAR_FRAME_SIZE];
+
+  // Prüfen, ob das Frame echte Targets enthält:
+  bool hasAnyTarget = false;
+  for (int i = 0; i < 3; i++) {
+    const uint8_t* blk = frame + 4 + i * RADAR_TARGET_BLOCKSIZE;
+    for (int j = 0; j < RADAR_TARGET_BLOCKSIZE; j++) {
+      if (blk[j]) { hasAnyTarget = true; break; }
+    }
+    if (hasAnyTarget) break;
+  }
+
+  // Parsing auslösen, wenn
+  //    a) es neue Target-Daten sind (memcmp ≠ 0) oder
+  //    b) gar keine Targets mehr da sind (!hasAnyTarget)
+  if (memcmp(frame, lastF, RADAR_FRAME_SIZE) != 0 || !hasAnyTarget) {
+    memcpy(lastF, frame, RADAR_FRAME_SIZE);
+    parseRadarFrame(frame, RADAR_FRAME_SIZE);
+  }
+
+  // Verlauf zählt jeden Frame, auch unveränderte (stehende Person)
+  uint8_t count = 0;
+  for (int i = 0; i < 3; i++) if (smoothed[i].presence) count++;
+  radarHistoryFeed(millis(), count, zoneMask);
+}
+
+// Replay: keine UART-Zeitstempel, Latenzen werden nicht erfasst
+void radarPipelineFrame(const uint8_t* frame) {
+  frameRxUs = 0;
+  pipelineFrame(frame);
+}
+
+static void handleLiveFrame(const uint8_t* frame) {
+  radarRecorderCapture(frame);
+  // Frames aus dem Staging-Puffer begannen in einem früheren Chunk
+  frameRxUs = (frame == radarParser.buf) ? carryRxUs : chunkRxUs;
+  if (!frameRxUs) frameRxUs = 1;
+  metricsRecordLatency(LAT_FRAME, micros() - frameRxUs);
+  // Während eines Replays bestimmen ausschließlich die aufgezeichneten Frames die Targets
+  if (radarRecorderReplaying()) return;
+  pipelineFrame(frame);
+}
+
+void radarPipelineFeed(const uint8_t* data, size_t len) {
+  chunkRxUs = micros();
+  uint8_t carried = radarParser.count;
+  radarParserFeed(radarParser, data, len, handleLiveFrame);
+  // Rest-Frame im Staging-Puffer: nur wenn er schon vor diesem Chunk
+  // begann (ohne Emit einfach gewachsen), bleibt der alte Zeitstempel
+  if (!radarParser.count) {
+    carryRxUs = 0;
+  } else if (carried == 0 || radarParser.count != carried + len) {
+    carryRxUs = chunkRxUs;
+  }
+}
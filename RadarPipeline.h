@@ -0,0 +1,31 @@
+// File: RadarPipeline.h
+
+#pragma once
+#include "Config.h"
+#include "RadarParser.h"
+#include "RadarTracker.h"
+
+void radarPipelineInit();
+void radarPipelineReset();
+void radarPipelineFeed(const uint8_t* data, size_t len);
+void radarPipelineFrame(const uint8_t* frame);
+const RadarParser& radarPipelineParser();
+
+// Umschalten wirkt ab dem nächsten Frame im Ingest-Task
+void radarPipelineSetFilter(RadarFilterMode mode);
+RadarFilterMode radarPipelineFilter();
+
+// Vom Ingest-Task nach jedem Frame veröffentlichter Zustand
+struct RadarSnapshot {
+  uint32_t      frame;        // fortlaufend, ändert sich mit jedem Frame
+  unsigned long timeMs;       // millis() des Frames
+  uint32_t      rxUs;         // micros() beim Lesen des ersten Frame-Bytes (0 = keine Messung)
+  RadarTarget   targets[3];
+};
+
+void parseRadarFrame(const uint8_t* buf, uint8_t len);
+
+// Lock-frei (Seqlock): blockiert den Ingest-Task nie
+void radarPipelineSnapshot(RadarSnapshot& out);
+void getRadarTargets(RadarTarget out[3]);
+uint32_t radarSnapshotRetries();
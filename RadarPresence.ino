@@ -13,6 +13,11 @@
 
 #include "Config.h"
 #include "RadarHandler.h"
+#include "RadarCommand.h"
+#include "LoopProfiler.h"
+#include "EventQueue.h"
+#include "SnapshotCache.h"
+#include "RadarHistory.h"
 #include "MQTTHandler.h"
 #include "OTAHandler.h"
 #include "WebServerHandler.h"
@@ -175,8 +180,7 @@ bool syncConfigFromWiFiManager() {
 
   if (changed) {
     saveParamCallback();
-    mqttClient.disconnect();
-    mqttClient.setServer(g_mqttServer.c_str(), g_mqttPort.toInt());
+    mqttSetServer(g_mqttServer.c_str(), g_mqttPort.toInt());
     if (hostChanged) {
       logPrintln("Hostname geaendert -> WiFi reconnect");
       WiFi.disconnect(false);
@@ -302,30 +306,18 @@ void setup() {
   logPrint(g_radarRxPin);
   logPrint(" TX=");
   logPrintln(g_radarTxPin);
-  Serial1.begin(256000, SERIAL_8N1,
-                g_radarRxPin.toInt(),
-                g_radarTxPin.toInt());
-  delay(100);
-
   logPrintln("Setze Radar-Parameter...");
-  setMaxRadarRange(g_maxRangeMeters);
-  enableMultiTargetMode();
-  logPrintln("Radar konfiguriert");
+  eventQueueInit();
+  snapshotCacheInit();
+  setupRadar();
+  logPrintln("Radar konfiguriert, Ingest-Task gestartet");
 
   // MQTT setup
   logPrint("MQTT Server: ");
   logPrint(g_mqttServer);
   logPrint(":");
   logPrintln(g_mqttPort);
-  mqttClient.setServer(g_mqttServer.c_str(), g_mqttPort.toInt());
-  mqttClient.setCallback(mqttCallback);
-
-  // SICHERHEIT: Größere Buffer und längere Keep-Alive
-  mqttClient.setBufferSize(512);  // Größerer Buffer für JSON
-  mqttClient.setKeepAlive(60);    // 60 Sekunden Keep-Alive (statt 15)
-  mqttClient.setSocketTimeout(15); // 15 Sekunden Socket-Timeout
-
-  mqttReconnect();
+  setupMqtt();   // Verbindung baut der MQTT-Connect-Task im Hintergrund auf
 
   // WebServer setup
   if (webServerEnabled) {
@@ -344,6 +336,8 @@ void setup() {
 // loop()
 // ---------------------------------------------------------
 void loop() {
+  loopProfilerBegin();
+
   // Check BOOT button for config portal (hold for 3 seconds)
   static unsigned long bootPressStart = 0;
   static bool bootPressed = false;
@@ -377,44 +371,70 @@ void loop() {
     logPrintln(String(WiFi.status()));
     lastWiFiCheck = millis();
   }
+  loopProfilerMark(LOOP_WIFI);
 
   // OTA handling
   if (otaEnabled) {
     ArduinoOTA.handle();
     if (otaInProgress) return;
   }
+  loopProfilerMark(LOOP_OTA);
+
+  // Gemeinsamer Snapshot für Web und MQTT, Version nur bei Änderung
+  snapshotCacheUpdate();
+  // Verlauf: Sekunden ohne Radar-Frames schließt sonst niemand ab
+  radarHistoryTick(millis());
+  loopProfilerMark(LOOP_SNAPSHOT);
 
   // WebServer
   if (webServerEnabled) {
     handleWebServer();
   }
+  loopProfilerMark(LOOP_WEB);
 
   // MQTT
   bool wifiConnected = (WiFi.status() == WL_CONNECTED);
   if (wifiConnected) {
-    if (!mqttClient.connected()) mqttReconnect();
-    mqttClient.loop();
+    mqttReconnect();
+    loopProfilerMark(LOOP_MQTT_CONNECT);
+    mqttLoop();
   }
-
-  // Radar data
-  readRadarData();
+  loopProfilerMark(LOOP_MQTT_LOOP);
 
   // Publishing
   unsigned long now = millis();
   if (wifiConnected && mqttTelemetryEnabled) {
-    if (now - lastRadarPub >= RADAR_INTERVAL_MS) {
+    if (g_publishOnChange) {
+      if (now - lastRadarPub >= RADAR_CHANGE_POLL_MS) {
+        lastRadarPub = now;
+        publishRadarOnChange();
+      }
+    } else if (now - lastRadarPub >= RADAR_INTERVAL_MS) {
       lastRadarPub = now;
       publishRadarJson();
     }
+    publishZones();
     if (now - lastStatusPub >= STATUS_INTERVAL) {
       lastStatusPub = now;
       publishStatus();
     }
+    if (now - lastMetricsPub >= METRICS_INTERVAL) {
+      lastMetricsPub = now;
+      publishMetrics();
+    }
   }
+  // Ereignisse auch ohne Verbindung erfassen, nachgeliefert wird gedrosselt
+  detectRadarEvents();
+  if (wifiConnected) eventQueueFlush();
+  loopProfilerMark(LOOP_PUBLISH);
 
   // Command handling
+  radarCommandDispatch();
   handleMqttCommands();
+  loopProfilerMark(LOOP_COMMANDS);
   checkRadarConnection();
+  loopProfilerMark(LOOP_RADAR_CHECK);
+  loopProfilerEnd();
 
   delay(1);
 }
@@ -432,7 +452,7 @@ void handleMqttCommands() {
     if (webServerEnabled) {
       stopWebServer();
     }
-    mqttClient.disconnect();
+    mqttDisconnect();
 
     WiFi.disconnect(true);
     delay(100);
@@ -445,7 +465,7 @@ void handleMqttCommands() {
     configPortalActive = false;
     logPrintf("Config-Portal beendet, ok=%d\n", portalOk ? 1 : 0);
 
-    bool updated = syncConfigFromWiFiManager();
+    syncConfigFromWiFiManager();
     if (webServerEnabled) {
       setupWebServer();
     }
@@ -455,9 +475,7 @@ void handleMqttCommands() {
       wifiReconnectIssued = true;
       lastWiFiReconnectAttempt = millis();
     }
-    if ((updated || portalOk) && WiFi.status() == WL_CONNECTED) {
-      mqttReconnect();
-    }
+    mqttResume();   // ohne WLAN übernimmt der Loop, sobald es wieder steht
   }
   if (rebootRequested) {
     const unsigned long REBOOT_DELAY_MS = 1000;
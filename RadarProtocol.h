@@ -0,0 +1,70 @@
+// File: RadarProtocol.h
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Typisierte RD-03D Befehlsrahmen:
+//   FD FC FB FA | len (LE) | cmd (LE) | payload | 04 03 02 01
+// Kopf (inkl. Länge und Befehls-ID) und Rahmengröße entstehen zur
+// Compile-Zeit aus der Befehlsdefinition; zur Laufzeit wird nur noch die
+// Payload eingesetzt. ACKs tragen cmd | 0x0100 und beginnen mit einem
+// 16-Bit-Status (0 = OK).
+
+#define RADAR_CMD_HEADER_BYTES 0xFD, 0xFC, 0xFB, 0xFA
+#define RADAR_CMD_TAIL_BYTES   0x04, 0x03, 0x02, 0x01
+
+template <uint16_t Cmd, uint16_t PayloadLen>
+struct RadarCmdSpec {
+  enum : uint16_t {
+    ID      = Cmd,
+    ACK     = Cmd | 0x0100,
+    PAYLOAD = PayloadLen,
+    LEN     = 2 + PayloadLen,          // Längenfeld: cmd + payload
+    FRAME   = 4 + 2 + 2 + PayloadLen + 4
+  };
+};
+
+typedef RadarCmdSpec<0x00FF, 2> RadarCmdOpen;         // payload: Protokollversion 0x0001
+typedef RadarCmdSpec<0x00FE, 0> RadarCmdClose;
+typedef RadarCmdSpec<0x0007, 6> RadarCmdSetParam;     // payload: param (u16), value (u32)
+typedef RadarCmdSpec<0x0008, 2> RadarCmdReadParam;    // payload: param (u16); ACK: status, value (u32); RD-03D unbestätigt
+typedef RadarCmdSpec<0x0090, 0> RadarCmdMultiTarget;
+
+// Parameter-IDs für RadarCmdSetParam / RadarCmdReadParam
+enum RadarParamId : uint16_t {
+  RADAR_PARAM_RANGE_GATE = 0x0001,     // 1-15 Gates à RANGE_GATE_SIZE
+  RADAR_PARAM_HOLD_MS    = 0x0004
+};
+
+template <class Spec>
+struct RadarCmdFrame {
+  uint8_t bytes[Spec::FRAME];
+
+  explicit RadarCmdFrame(const uint8_t* payload = nullptr) {
+    static const uint8_t head[8] = {
+      RADAR_CMD_HEADER_BYTES,
+      (uint8_t)(Spec::LEN & 0xFF), (uint8_t)(Spec::LEN >> 8),
+      (uint8_t)(Spec::ID & 0xFF),  (uint8_t)(Spec::ID >> 8)
+    };
+    static const uint8_t tail[4] = { RADAR_CMD_TAIL_BYTES };
+    memcpy(bytes, head, sizeof(head));
+    if (Spec::PAYLOAD > 0 && payload) memcpy(bytes + sizeof(head), payload, Spec::PAYLOAD);
+    memcpy(bytes + sizeof(head) + Spec::PAYLOAD, tail, sizeof(tail));
+  }
+
+  size_t size() const { return sizeof(bytes); }
+};
+
+inline void radarPutU16(uint8_t* p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+
+inline void radarPutU32(uint8_t* p, uint32_t v) {
+  p[0] = v & 0xFF;
+  p[1] = (v >> 8) & 0xFF;
+  p[2] = (v >> 16) & 0xFF;
+  p[3] = (v >> 24) & 0xFF;
+}
@@ -0,0 +1,235 @@
+// File: RadarRecorder.cpp
+
+#include "RadarRecorder.h"
+#include "RadarPipeline.h"
+
+static portMUX_TYPE recMux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t*  recBuf        = nullptr;
+static uint32_t  recCapacity   = 0;
+static uint32_t  recHead       = 0;   // nächster Schreibplatz
+static uint32_t  recCount      = 0;
+static bool      recActive     = false;
+static bool      recExporting  = false; // Capture pausiert, solange ein Export läuft
+static bool      recImporting  = false; // Aufnahme/Replay gesperrt, Ring gehört dem Import
+static bool      replayActive  = false;
+static uint32_t  replayPos     = 0;
+static uint32_t  replayStartMs = 0;
+static uint8_t   exportHeader[RADAR_REC_HEADER_SIZE];
+static uint32_t  exportCount   = 0;
+static uint32_t  exportFirst   = 0;
+static uint8_t   importHeader[RADAR_REC_HEADER_SIZE];
+static uint32_t  importExpected = 0;   // Records laut Header
+static uint32_t  importRecords  = 0;   // vollständig geschriebene Records
+static bool      importValid    = false;
+
+static void putLe16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+static void putLe32(uint8_t* p, uint32_t v) { for (int i = 0; i < 4; i++) p[i] = (v >> (8 * i)) & 0xFF; }
+static uint32_t getLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t* recordAt(uint32_t idx) {
+  return recBuf + (size_t)idx * RADAR_REC_RECORD_SIZE;
+}
+
+// Index des ältesten Records + n
+static uint32_t ringIndex(uint32_t n) {
+  return (recHead + recCapacity - recCount + n) % recCapacity;
+}
+
+static bool allocateRing() {
+  if (recBuf) return true;
+  uint32_t cap = RADAR_RECORDER_INTERNAL_FRAMES;
+  uint8_t* buf = nullptr;
+  if (psramFound()) {
+    buf = (uint8_t*)ps_malloc((size_t)RADAR_RECORDER_PSRAM_FRAMES * RADAR_REC_RECORD_SIZE);
+    if (buf) cap = RADAR_RECORDER_PSRAM_FRAMES;
+  }
+  if (!buf) {
+    buf = (uint8_t*)malloc((size_t)cap * RADAR_REC_RECORD_SIZE);
+  }
+  if (!buf) return false;
+  recBuf = buf;
+  recCapacity = cap;
+  logPrintf("Recorder: %u Frames Puffer (%s)\n", cap,
+            cap == RADAR_RECORDER_PSRAM_FRAMES ? "PSRAM" : "intern");
+  return true;
+}
+
+bool radarRecorderStart() {
+  if (replayActive || recImporting) return false;
+  if (!allocateRing()) return false;
+  portENTER_CRITICAL(&recMux);
+  recHead = 0;
+  recCount = 0;
+  recActive = true;
+  portEXIT_CRITICAL(&recMux);
+  return true;
+}
+
+void radarRecorderStop() {
+  recActive = false;
+}
+
+void radarRecorderClear() {
+  portENTER_CRITICAL(&recMux);
+  recHead = 0;
+  recCount = 0;
+  portEXIT_CRITICAL(&recMux);
+}
+
+bool radarRecorderStartReplay() {
+  if (recActive || recImporting || recCount == 0) return false;
+  replayPos = 0;
+  replayStartMs = millis();
+  replayActive = true;
+  return true;
+}
+
+void radarRecorderStopReplay() {
+  replayActive = false;
+}
+
+bool radarRecorderRecording() { return recActive; }
+bool radarRecorderImporting() { return recImporting; }
+bool radarRecorderReplaying() { return replayActive; }
+uint32_t radarRecorderCount() { return recCount; }
+uint32_t radarRecorderCapacity() { return recCapacity; }
+
+void radarRecorderCapture(const uint8_t* frame) {
+  if (!recActive || recExporting || !recBuf) return;
+  portENTER_CRITICAL(&recMux);
+  uint8_t* rec = recordAt(recHead);
+  putLe32(rec, millis());
+  memcpy(rec + 4, frame, RADAR_FRAME_SIZE);
+  recHead = (recHead + 1) % recCapacity;
+  if (recCount < recCapacity) recCount++;
+  portEXIT_CRITICAL(&recMux);
+}
+
+// Frames im aufgezeichneten Zeitabstand erneut durch die Pipeline schicken
+void radarRecorderReplayStep() {
+  if (!replayActive) return;
+  uint32_t first = getLe32(recordAt(ringIndex(0)));
+  uint32_t elapsed = millis() - replayStartMs;
+  while (replayPos < recCount) {
+    const uint8_t* rec = recordAt(ringIndex(replayPos));
+    if (getLe32(rec) - first > elapsed) return;
+    radarPipelineFrame(rec + 4);
+    replayPos++;
+  }
+  replayActive = false;
+  logPrintf("Replay beendet: %u Frames\n", replayPos);
+}
+
+size_t radarRecorderExportBegin() {
+  portENTER_CRITICAL(&recMux);
+  recExporting = true;
+  exportCount = recCount;
+  exportFirst = recCount ? ringIndex(0) : 0;
+  portEXIT_CRITICAL(&recMux);
+
+  memcpy(exportHeader, RADAR_REC_MAGIC, 4);
+  exportHeader[4] = RADAR_REC_VERSION;
+  exportHeader[5] = RADAR_FRAME_SIZE;
+  putLe16(exportHeader + 6, RADAR_REC_RECORD_SIZE);
+  putLe32(exportHeader + 8, exportCount);
+  return RADAR_REC_HEADER_SIZE + (size_t)exportCount * RADAR_REC_RECORD_SIZE;
+}
+
+size_t radarRecorderExportRead(size_t offset, uint8_t* out, size_t len) {
+  size_t total = RADAR_REC_HEADER_SIZE + (size_t)exportCount * RADAR_REC_RECORD_SIZE;
+  size_t written = 0;
+  while (written < len && offset < total) {
+    size_t n;
+    if (offset < RADAR_REC_HEADER_SIZE) {
+      n = min(len - written, (size_t)RADAR_REC_HEADER_SIZE - offset);
+      memcpy(out + written, exportHeader + offset, n);
+    } else {
+      size_t rel = offset - RADAR_REC_HEADER_SIZE;
+      uint32_t idx = (exportFirst + rel / RADAR_REC_RECORD_SIZE) % recCapacity;
+      size_t within = rel % RADAR_REC_RECORD_SIZE;
+      n = min(len - written, (size_t)RADAR_REC_RECORD_SIZE - within);
+      memcpy(out + written, recordAt(idx) + within, n);
+    }
+    written += n;
+    offset += n;
+  }
+  return written;
+}
+
+void radarRecorderExportEnd() {
+  recExporting = false;
+}
+
+static bool parseHeaderOnly(const uint8_t* data, uint32_t& count) {
+  if (memcmp(data, RADAR_REC_MAGIC, 4) != 0) return false;
+  if (data[4] != RADAR_REC_VERSION || data[5] != RADAR_FRAME_SIZE) return false;
+  if ((uint16_t)(data[6] | (data[7] << 8)) != RADAR_REC_RECORD_SIZE) return false;
+  count = getLe32(data + 8);
+  return true;
+}
+
+bool radarRecorderImportBegin() {
+  if (recActive || replayActive || recExporting || recImporting) return false;
+  if (!allocateRing()) return false;
+  portENTER_CRITICAL(&recMux);
+  recHead = 0;
+  recCount = 0;
+  recImporting = true;
+  portEXIT_CRITICAL(&recMux);
+  importExpected = importRecords = 0;
+  importValid = false;
+  return true;
+}
+
+bool radarRecorderImportWrite(size_t offset, const uint8_t* data, size_t len) {
+  if (!recImporting) return false;
+  while (len > 0) {
+    size_t n;
+    if (offset < RADAR_REC_HEADER_SIZE) {
+      n = min(len, (size_t)RADAR_REC_HEADER_SIZE - offset);
+      memcpy(importHeader + offset, data, n);
+      if (offset + n == RADAR_REC_HEADER_SIZE) {
+        // Nur den Header prüfen, die Records kommen erst noch
+        importValid = parseHeaderOnly(importHeader, importExpected);
+        if (!importValid) return false;
+      }
+    } else {
+      if (!importValid) return false;
+      size_t rel = offset - RADAR_REC_HEADER_SIZE;
+      uint32_t idx = rel / RADAR_REC_RECORD_SIZE;
+      size_t within = rel % RADAR_REC_RECORD_SIZE;
+      n = min(len, (size_t)RADAR_REC_RECORD_SIZE - within);
+      if (idx < recCapacity && idx < importExpected) {
+        memcpy(recordAt(idx) + within, data, n);
+        if (within + n == RADAR_REC_RECORD_SIZE) importRecords = idx + 1;
+      }
+    }
+    data += n;
+    offset += n;
+    len -= n;
+  }
+  return true;
+}
+
+uint32_t radarRecorderImportEnd(bool complete) {
+  if (!recImporting) return 0;
+  uint32_t expected = min(importExpected, recCapacity);
+  uint32_t loaded = (complete && importValid && importRecords == expected) ? importRecords : 0;
+  portENTER_CRITICAL(&recMux);
+  recHead = loaded % recCapacity;
+  recCount = loaded;
+  recImporting = false;
+  portEXIT_CRITICAL(&recMux);
+  if (loaded) {
+    logPrintf("Recorder: %u Frames importiert%s\n", loaded,
+              importExpected > loaded ? " (Rest über Kapazität verworfen)" : "");
+  }
+  return loaded;
+}
+
+bool radarRecordingParseHeader(const uint8_t* data, size_t len, uint32_t& count) {
+  if (!data || len < RADAR_REC_HEADER_SIZE || !parseHeaderOnly(data, count)) return false;
+  return len >= RADAR_REC_HEADER_SIZE + (size_t)count * RADAR_REC_RECORD_SIZE;
+}
@@ -0,0 +1,50 @@
+// File: RadarRecorder.h
+
+#pragma once
+#include "Config.h"
+
+// Aufzeichnung roher RD-03D-Frames in einen Ringpuffer fester Größe
+// (PSRAM falls vorhanden, sonst begrenzt im internen RAM) samt Export als
+// kompakte Binärdatei und Replay zurück in die Radar-Pipeline. Eine
+// exportierte Datei lässt sich per Import wieder in den Ring laden und
+// ebenso abspielen.
+//
+// Dateiformat (.rdr, little endian):
+//   Header  "RDRC" | version u8 | frameSize u8 | recordSize u16 | count u32
+//   Record  captureMs u32 | frame[RADAR_FRAME_SIZE]
+
+#define RADAR_REC_MAGIC        "RDRC"
+#define RADAR_REC_VERSION      1
+#define RADAR_REC_HEADER_SIZE  12
+#define RADAR_REC_RECORD_SIZE  (4 + RADAR_FRAME_SIZE)
+
+bool     radarRecorderStart();
+void     radarRecorderStop();
+void     radarRecorderClear();
+bool     radarRecorderStartReplay();
+void     radarRecorderStopReplay();
+bool     radarRecorderRecording();
+bool     radarRecorderReplaying();
+uint32_t radarRecorderCount();
+uint32_t radarRecorderCapacity();
+
+// Ingest-Task: Live-Frame mitschneiden bzw. fällige Replay-Frames einspeisen
+void     radarRecorderCapture(const uint8_t* frame);
+void     radarRecorderReplayStep();
+
+// Export: Größe der Datei und byteweiser Lesezugriff ab offset
+size_t   radarRecorderExportBegin();
+size_t   radarRecorderExportRead(size_t offset, uint8_t* out, size_t len);
+void     radarRecorderExportEnd();
+
+// Import einer .rdr-Datei in den Ring (ersetzt dessen Inhalt), stückweise in
+// Dateireihenfolge. Nicht während Aufnahme, Replay oder Export; Records über
+// die Kapazität hinaus werden verworfen. End liefert die geladenen Frames
+// (0 = Header ungültig, Datei unvollständig oder abgebrochen).
+bool     radarRecorderImportBegin();
+bool     radarRecorderImportWrite(size_t offset, const uint8_t* data, size_t len);
+uint32_t radarRecorderImportEnd(bool complete);
+bool     radarRecorderImporting();
+
+// Header einer .rdr-Datei prüfen (auch für host/radar_bench)
+bool     radarRecordingParseHeader(const uint8_t* data, size_t len, uint32_t& count);
@@ -0,0 +1,143 @@
+// File: RadarTracker.cpp
+// Kalmanfilter für die Target-Glättung. Die drei Messungen werden
+// sequenziell als Skalare eingearbeitet – keine Matrixinversion, nur ein
+// paar Dutzend Float-Multiplikationen pro Frame und Target.
+
+#include "RadarTracker.h"
+#include "RadarMath.h"
+#include <string.h>
+#include <math.h>
+
+static const float MIN_RADIAL_RANGE_MM = 100.0f; // darunter ist die Radialrichtung unbestimmt
+
+// Skalare Messung mit Jacobi-Zeile H, Varianz r und innov = z - h(s).
+// gate > 0: Messungen jenseits gate·σ der Innovation werden verworfen.
+static bool scalarUpdate(RadarKalman& k, const float H[4], float innov, float r, float gate = 0.0f) {
+  float PH[4];
+  for (int i = 0; i < 4; i++) {
+    PH[i] = k.P[i][0] * H[0] + k.P[i][1] * H[1] + k.P[i][2] * H[2] + k.P[i][3] * H[3];
+  }
+  float S = H[0] * PH[0] + H[1] * PH[1] + H[2] * PH[2] + H[3] * PH[3] + r;
+  if (S <= 0.0f) return false;
+  if (gate > 0.0f && innov * innov > gate * gate * S) return false;
+  float invS = 1.0f / S;
+  for (int i = 0; i < 4; i++) {
+    float Ki = PH[i] * invS;
+    k.s[i] += Ki * innov;
+    for (int j = 0; j < 4; j++) k.P[i][j] -= Ki * PH[j];
+  }
+  return true;
+}
+
+// Position-only Updates: H ist ein Einheitsvektor
+static void positionUpdate(RadarKalman& k, int axis, float z) {
+  const float H[4] = { axis == 0 ? 1.0f : 0.0f, axis == 1 ? 1.0f : 0.0f, 0.0f, 0.0f };
+  scalarUpdate(k, H, z - k.s[axis], KALMAN_POS_NOISE * KALMAN_POS_NOISE);
+}
+
+void radarKalmanInit(RadarKalman& k, float x, float y, float vr, unsigned long now) {
+  memset(&k, 0, sizeof(k));
+  k.active = true;
+  k.lastMs = now;
+  k.s[0] = x;
+  k.s[1] = y;
+
+  const float rPos = KALMAN_POS_NOISE * KALMAN_POS_NOISE;
+  const float rVel = KALMAN_INIT_VEL_NOISE * KALMAN_INIT_VEL_NOISE;
+  k.P[0][0] = rPos;
+  k.P[1][1] = rPos;
+  k.P[2][2] = rVel;
+  k.P[3][3] = rVel;
+
+  // Radialgeschwindigkeit als erste Geschwindigkeitsschätzung einarbeiten
+  float range = sqrtf(x * x + y * y);
+  if (range >= MIN_RADIAL_RANGE_MM) {
+    const float H[4] = { 0.0f, 0.0f, x / range, y / range };
+    scalarUpdate(k, H, vr - radarKalmanRadialSpeed(k),
+                 KALMAN_SPEED_NOISE * KALMAN_SPEED_NOISE);
+  }
+}
+
+void radarKalmanPredict(RadarKalman& k, unsigned long now) {
+  unsigned long dtMs = now - k.lastMs;
+  k.lastMs = now;
+  if (dtMs == 0) return;
+  if (dtMs > KALMAN_MAX_DT_MS) dtMs = KALMAN_MAX_DT_MS;
+  float dt = dtMs * 0.001f;
+
+  k.s[0] += k.s[2] * dt;
+  k.s[1] += k.s[3] * dt;
+
+  // P = F·P·Fᵀ mit F = [I dt·I; 0 I], ausgeschrieben
+  float (&P)[4][4] = k.P;
+  for (int i = 0; i < 4; i++) {          // Zeilen: P ← F·P
+    P[0][i] += dt * P[2][i];
+    P[1][i] += dt * P[3][i];
+  }
+  for (int i = 0; i < 4; i++) {          // Spalten: P ← P·Fᵀ
+    P[i][0] += dt * P[i][2];
+    P[i][1] += dt * P[i][3];
+  }
+
+  // Q: weißes Beschleunigungsrauschen, je Achse q·[dt⁴/4 dt³/2; dt³/2 dt²]
+  const float q   = KALMAN_ACCEL_NOISE * KALMAN_ACCEL_NOISE;
+  const float dt2 = dt * dt;
+  const float qPP = q * dt2 * dt2 * 0.25f;
+  const float qPV = q * dt2 * dt * 0.5f;
+  const float qVV = q * dt2;
+  P[0][0] += qPP; P[1][1] += qPP;
+  P[0][2] += qPV; P[2][0] += qPV;
+  P[1][3] += qPV; P[3][1] += qPV;
+  P[2][2] += qVV; P[3][3] += qVV;
+}
+
+bool radarKalmanUpdate(RadarKalman& k, float x, float y, float vr) {
+  // Gating: passt die Messung nicht zum Track (Slot-Wechsel des Sensors,
+  // Sprung), neu aufsetzen statt den Zustand mitzuziehen
+  const float rPos = KALMAN_POS_NOISE * KALMAN_POS_NOISE;
+  float ex = x - k.s[0], ey = y - k.s[1];
+  float d2 = ex * ex / (k.P[0][0] + rPos) + ey * ey / (k.P[1][1] + rPos);
+  if (d2 > KALMAN_GATE * KALMAN_GATE) return false;
+
+  positionUpdate(k, 0, x);
+  positionUpdate(k, 1, y);
+
+  // Radialgeschwindigkeit h(s) = (x·vx + y·vy)/r, linearisiert um den Zustand
+  float px = k.s[0], py = k.s[1];
+  float range = sqrtf(px * px + py * py);
+  if (range < MIN_RADIAL_RANGE_MM) return true;
+  float ux = px / range, uy = py / range;
+  float vrPred = ux * k.s[2] + uy * k.s[3];
+  const float H[4] = {
+    (k.s[2] - ux * vrPred) / range,
+    (k.s[3] - uy * vrPred) / range,
+    ux,
+    uy
+  };
+  // Ausreißer der Radialgeschwindigkeit verwerfen, Position bleibt übernommen
+  scalarUpdate(k, H, vr - vrPred, KALMAN_SPEED_NOISE * KALMAN_SPEED_NOISE, KALMAN_GATE);
+  return true;
+}
+
+float radarKalmanRadialSpeed(const RadarKalman& k) {
+  float range = sqrtf(k.s[0] * k.s[0] + k.s[1] * k.s[1]);
+  if (range < MIN_RADIAL_RANGE_MM) return 0.0f;
+  return (k.s[0] * k.s[2] + k.s[1] * k.s[3]) / range;
+}
+
+uint16_t radarKalmanSigma(const RadarKalman& k) {
+  float var = 0.5f * (k.P[0][0] + k.P[1][1]);
+  if (var <= 0.0f) return 0;
+  if (var > 4.0e9f) return 0xFFFF;
+  return radarIsqrt32((uint32_t)var);
+}
+
+const char* radarFilterName(RadarFilterMode mode) {
+  return mode == RADAR_FILTER_KALMAN ? "kalman" : "ema";
+}
+
+bool radarFilterFromName(const char* name, RadarFilterMode& mode) {
+  if (!strcmp(name, "ema"))    { mode = RADAR_FILTER_EMA;    return true; }
+  if (!strcmp(name, "kalman")) { mode = RADAR_FILTER_KALMAN; return true; }
+  return false;
+}
@@ -0,0 +1,36 @@
+// File: RadarTracker.h
+
+#pragma once
+#include <stdint.h>
+
+// Konstant-Geschwindigkeits-Kalmanfilter pro Target-Slot.
+// Zustand: x, y (mm), vx, vy (mm/s). Messungen: x, y und die vom Sensor
+// gelieferte Radialgeschwindigkeit (positiv = entfernt sich).
+
+#define KALMAN_ACCEL_NOISE    600.0f  // mm/s², Manöver-Rauschen (gehende Person)
+#define KALMAN_POS_NOISE       60.0f  // mm, 1σ Positionsmessung RD-03D
+#define KALMAN_SPEED_NOISE    150.0f  // mm/s, 1σ Radialgeschwindigkeit
+#define KALMAN_INIT_VEL_NOISE 1000.0f // mm/s, 1σ unbekannte Tangentialgeschwindigkeit
+#define KALMAN_MAX_DT_MS      1000    // längere Lücken werden gekappt
+#define KALMAN_GATE             5.0f  // σ, darüber gilt eine Messung als neuer Track
+
+enum RadarFilterMode : uint8_t {
+  RADAR_FILTER_EMA = 0,
+  RADAR_FILTER_KALMAN = 1
+};
+
+struct RadarKalman {
+  bool          active;
+  float         s[4];      // x, y, vx, vy
+  float         P[4][4];
+  unsigned long lastMs;
+};
+
+void radarKalmanInit(RadarKalman& k, float x, float y, float vr, unsigned long now);
+void radarKalmanPredict(RadarKalman& k, unsigned long now);
+bool radarKalmanUpdate(RadarKalman& k, float x, float y, float vr);   // false = außerhalb Gate
+float radarKalmanRadialSpeed(const RadarKalman& k);   // mm/s
+uint16_t radarKalmanSigma(const RadarKalman& k);      // mm, 1σ Positionsunsicherheit
+
+const char* radarFilterName(RadarFilterMode mode);
+bool radarFilterFromName(const char* name, RadarFilterMode& mode);
@@ -0,0 +1,240 @@
+// File: RadarZones.cpp
+// Zonen-Definitionen liegen in Preferences ("myRadar", Keys zone0..zone7)
+// als "name|x,y;x,y;…". Das Raster wird im Loop neu aufgebaut und per
+// Pointer-Tausch übernommen, damit der Ingest-Task nie auf ein halb
+// gefülltes Raster schaut.
+
+#include "RadarZones.h"
+#include "RadarPipeline.h"
+
+struct RadarZone {
+  bool    defined;
+  char    name[RADAR_ZONE_NAME_LEN];
+  uint8_t vertexCount;
+  int16_t vx[RADAR_ZONE_MAX_VERTICES];
+  int16_t vy[RADAR_ZONE_MAX_VERTICES];
+};
+
+// "name|" + je Punkt max. "-32767,-32767;"
+static const size_t ZONE_SPEC_LEN = RADAR_ZONE_NAME_LEN + RADAR_ZONE_MAX_VERTICES * 14 + 2;
+
+static portMUX_TYPE zoneMux = portMUX_INITIALIZER_UNLOCKED;   // schützt zoneGrid, zoneCounts, Schreiben in zones
+static RadarZone    zones[RADAR_ZONE_MAX];                     // nur im Loop verändert (storeZone)
+static uint8_t*     zoneGrid = nullptr;
+static uint8_t      zoneCounts[RADAR_ZONE_MAX];
+
+static bool validName(const char* name) {
+  size_t len = strlen(name);
+  if (len == 0 || len >= RADAR_ZONE_NAME_LEN) return false;
+  for (size_t i = 0; i < len; i++) {
+    char c = name[i];
+    bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_' || c == '-';
+    if (!ok) return false;
+  }
+  return true;
+}
+
+static bool parsePoints(const char* points, RadarZone& z) {
+  z.vertexCount = 0;
+  const char* p = points;
+  while (*p) {
+    if (z.vertexCount >= RADAR_ZONE_MAX_VERTICES) return false;
+    char* end = nullptr;
+    long x = strtol(p, &end, 10);
+    if (end == p || *end != ',') return false;
+    p = end + 1;
+    long y = strtol(p, &end, 10);
+    if (end == p || (*end != ';' && *end != '\0')) return false;
+    if (x < -32767 || x > 32767 || y < -32767 || y > 32767) return false;
+    z.vx[z.vertexCount] = (int16_t)x;
+    z.vy[z.vertexCount] = (int16_t)y;
+    z.vertexCount++;
+    p = (*end == ';') ? end + 1 : end;
+  }
+  return z.vertexCount >= 3;
+}
+
+// Crossing-Number-Test; läuft nur beim Rasteraufbau
+static bool pointInZone(const RadarZone& z, float px, float py) {
+  bool inside = false;
+  for (uint8_t i = 0, j = z.vertexCount - 1; i < z.vertexCount; j = i++) {
+    float xi = z.vx[i], yi = z.vy[i], xj = z.vx[j], yj = z.vy[j];
+    if ((yi > py) != (yj > py) && px < (xj - xi) * (py - yi) / (yj - yi) + xi) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+static void rebuildGrid() {
+  uint8_t* grid = (uint8_t*)calloc(RADAR_ZONE_GRID_W * RADAR_ZONE_GRID_H, 1);
+  if (!grid) {
+    logPrintln("Zones: kein Speicher für Raster");
+    return;
+  }
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    if (!zones[z].defined) continue;
+    uint8_t bit = 1 << z;
+    for (int gy = 0; gy < RADAR_ZONE_GRID_H; gy++) {
+      float cy = gy * RADAR_ZONE_CELL_MM + RADAR_ZONE_CELL_MM / 2.0f;
+      for (int gx = 0; gx < RADAR_ZONE_GRID_W; gx++) {
+        float cx = RADAR_ZONE_X_MIN_MM + gx * RADAR_ZONE_CELL_MM + RADAR_ZONE_CELL_MM / 2.0f;
+        if (pointInZone(zones[z], cx, cy)) grid[gy * RADAR_ZONE_GRID_W + gx] |= bit;
+      }
+    }
+  }
+
+  portENTER_CRITICAL(&zoneMux);
+  uint8_t* old = zoneGrid;
+  zoneGrid = grid;
+  portEXIT_CRITICAL(&zoneMux);
+  free(old);
+
+  // Zählwerte sofort auf das neue Raster bringen statt bis zum nächsten Frame
+  RadarTarget targets[3];
+  getRadarTargets(targets);
+  radarZonesEvaluate(targets);
+}
+
+// Der Loop liest zones ohne Sperre; andere Tasks nur über radarZonesSnapshot()
+static void storeZone(uint8_t slot, const RadarZone& zone) {
+  portENTER_CRITICAL(&zoneMux);
+  zones[slot] = zone;
+  portEXIT_CRITICAL(&zoneMux);
+}
+
+static void zoneKey(uint8_t slot, char* key, size_t keysize) {
+  snprintf(key, keysize, "zone%u", slot);
+}
+
+static void saveZone(uint8_t slot) {
+  char key[8];
+  zoneKey(slot, key, sizeof(key));
+  char spec[ZONE_SPEC_LEN] = "";
+  if (zones[slot].defined) {
+    size_t n = snprintf(spec, sizeof(spec), "%s|", zones[slot].name);
+    for (uint8_t i = 0; i < zones[slot].vertexCount && n < sizeof(spec); i++) {
+      n += snprintf(spec + n, sizeof(spec) - n, "%s%d,%d", i ? ";" : "",
+                    zones[slot].vx[i], zones[slot].vy[i]);
+    }
+  }
+  prefs.begin("myRadar", false);
+  prefs.putString(key, spec);
+  prefs.end();
+}
+
+static int findZone(const char* name) {
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    if (zones[z].defined && !strcmp(zones[z].name, name)) return z;
+  }
+  return -1;
+}
+
+void radarZonesLoad() {
+  prefs.begin("myRadar", true);
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    storeZone(z, RadarZone{});
+    char key[8];
+    zoneKey(z, key, sizeof(key));
+    char spec[ZONE_SPEC_LEN];
+    strncpy(spec, prefs.getString(key, "").c_str(), sizeof(spec) - 1);
+    spec[sizeof(spec) - 1] = '\0';
+    char* sep = strchr(spec, '|');
+    if (!sep || sep == spec) continue;
+    *sep = '\0';
+    RadarZone zone = {};
+    if (!validName(spec) || !parsePoints(sep + 1, zone)) {
+      logPrintf("Zones: ungültiger Eintrag %s verworfen\n", key);
+      continue;
+    }
+    zone.defined = true;
+    memcpy(zone.name, spec, strlen(spec) + 1);   // Länge per validName() geprüft
+    storeZone(z, zone);
+  }
+  prefs.end();
+  rebuildGrid();
+}
+
+bool radarZoneSet(const char* name, const char* points) {
+  if (!validName(name)) return false;
+  RadarZone zone = {};
+  if (!parsePoints(points, zone)) return false;
+
+  int slot = findZone(name);
+  if (slot < 0) {
+    for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+      if (!zones[z].defined) { slot = z; break; }
+    }
+  }
+  if (slot < 0) return false;
+
+  zone.defined = true;
+  memcpy(zone.name, name, strlen(name) + 1);
+  storeZone(slot, zone);
+  saveZone(slot);
+  rebuildGrid();
+  return true;
+}
+
+bool radarZoneRemove(const char* name) {
+  int slot = findZone(name);
+  if (slot < 0) return false;
+  storeZone(slot, RadarZone{});
+  saveZone(slot);
+  rebuildGrid();
+  return true;
+}
+
+void radarZonesClear() {
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    if (!zones[z].defined) continue;
+    storeZone(z, RadarZone{});
+    saveZone(z);
+  }
+  rebuildGrid();
+}
+
+bool radarZoneDescribe(uint8_t slot, char* buf, size_t bufsize) {
+  if (slot >= RADAR_ZONE_MAX || !zones[slot].defined || bufsize == 0) return false;
+  size_t n = snprintf(buf, bufsize, "%s:", zones[slot].name);
+  for (uint8_t i = 0; i < zones[slot].vertexCount && n < bufsize; i++) {
+    n += snprintf(buf + n, bufsize - n, "%s%d,%d", i ? ";" : "", zones[slot].vx[i], zones[slot].vy[i]);
+  }
+  return true;
+}
+
+uint8_t radarZonesEvaluate(const RadarTarget targets[3]) {
+  uint8_t counts[RADAR_ZONE_MAX] = {0};
+  portENTER_CRITICAL(&zoneMux);
+  if (zoneGrid) {
+    for (int i = 0; i < 3; i++) {
+      if (!targets[i].presence) continue;
+      int gx = (targets[i].x - RADAR_ZONE_X_MIN_MM) / RADAR_ZONE_CELL_MM;
+      int gy = targets[i].y / RADAR_ZONE_CELL_MM;
+      if (targets[i].x < RADAR_ZONE_X_MIN_MM || targets[i].y < 0 ||
+          gx >= RADAR_ZONE_GRID_W || gy >= RADAR_ZONE_GRID_H) continue;
+      uint8_t bits = zoneGrid[gy * RADAR_ZONE_GRID_W + gx];
+      for (uint8_t z = 0; bits; z++, bits >>= 1) {
+        if (bits & 1) counts[z]++;
+      }
+    }
+  }
+  memcpy(zoneCounts, counts, sizeof(zoneCounts));
+  portEXIT_CRITICAL(&zoneMux);
+  uint8_t mask = 0;
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    if (counts[z]) mask |= 1 << z;
+  }
+  return mask;
+}
+
+void radarZonesSnapshot(RadarZoneState out[RADAR_ZONE_MAX]) {
+  portENTER_CRITICAL(&zoneMux);
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    out[z].defined = zones[z].defined;
+    memcpy(out[z].name, zones[z].name, sizeof(out[z].name));
+    out[z].count = zoneCounts[z];
+  }
+  portEXIT_CRITICAL(&zoneMux);
+}
@@ -0,0 +1,34 @@
+// File: RadarZones.h
+
+#pragma once
+#include "Config.h"
+
+// Polygon-Zonen in Sensorkoordinaten (mm). Jede Zone wird beim Anlegen in
+// ein grobes Raster (RADAR_ZONE_CELL_MM) vorberechnet; pro Zelle hält ein
+// Bit je Zone die Zugehörigkeit, die Klassifikation pro Target ist damit
+// ein einzelner Array-Zugriff.
+
+#define RADAR_ZONE_MAX          8      // ein Bit pro Zone im Raster
+#define RADAR_ZONE_MAX_VERTICES 8
+#define RADAR_ZONE_NAME_LEN     16
+#define RADAR_ZONE_CELL_MM      100
+#define RADAR_ZONE_X_MIN_MM     (-6000)
+#define RADAR_ZONE_X_MAX_MM     6000
+#define RADAR_ZONE_Y_MAX_MM     8000
+#define RADAR_ZONE_GRID_W       ((RADAR_ZONE_X_MAX_MM - RADAR_ZONE_X_MIN_MM) / RADAR_ZONE_CELL_MM)
+#define RADAR_ZONE_GRID_H       (RADAR_ZONE_Y_MAX_MM / RADAR_ZONE_CELL_MM)
+
+struct RadarZoneState {
+  bool    defined;
+  char    name[RADAR_ZONE_NAME_LEN];
+  uint8_t count;          // Targets in der Zone beim letzten Frame
+};
+
+void radarZonesLoad();                                  // Preferences → Raster
+bool radarZoneSet(const char* name, const char* points); // "x,y;x,y;…", ≥ 3 Punkte
+bool radarZoneRemove(const char* name);
+void radarZonesClear();
+bool radarZoneDescribe(uint8_t slot, char* buf, size_t bufsize);
+
+uint8_t radarZonesEvaluate(const RadarTarget targets[3]); // pro geparstem Frame; Bit z = Zone z belegt
+void radarZonesSnapshot(RadarZoneState out[RADAR_ZONE_MAX]);  // beliebiger Task
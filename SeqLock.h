@@ -0,0 +1,45 @@
+// File: SeqLock.h
+
+#pragma once
+#include <atomic>
+#include <string.h>
+
+// Sequenz-Lock für genau einen Schreiber und beliebig viele Leser.
+// Der Schreiber blockiert nie; Leser kopieren und wiederholen, falls
+// währenddessen geschrieben wurde (ungerade bzw. geänderte Sequenz).
+// T muss trivial kopierbar sein. Leser dürfen den Schreiber nicht auf
+// demselben Kern mit höherer Priorität unterbrechen (sonst Endlosschleife).
+template <class T>
+class SeqLock {
+public:
+  void write(const T& value) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&data, &value, sizeof(T));
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Liefert die Anzahl der Wiederholungen (0 = erster Versuch konsistent)
+  uint32_t read(T& out) const {
+    uint32_t retries = 0;
+    for (;;) {
+      uint32_t s1 = seq.load(std::memory_order_acquire);
+      if ((s1 & 1) == 0) {
+        memcpy(&out, &data, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == s1) return retries;
+      }
+      retries++;
+    }
+  }
+
+  // Anzahl abgeschlossener Schreibvorgänge
+  uint32_t version() const {
+    return seq.load(std::memory_order_acquire) >> 1;
+  }
+
+private:
+  std::atomic<uint32_t> seq{0};
+  T data{};
+};
@@ -0,0 +1,384 @@
+// File: SnapshotCache.cpp
+
+#include "SnapshotCache.h"
+#include "RadarJson.h"
+#include "MQTTHandler.h"
+#include <esp_system.h>
+
+// Abgetasteter Dashboard-Status. Wird vor dem Füllen genullt, damit
+// memcmp auch über Padding-Bytes stabil vergleicht.
+enum StatusWarning : uint8_t {
+  WARN_WEAK_WIFI = 1 << 0,
+  WARN_LOW_HEAP  = 1 << 1,
+  WARN_TIMEOUTS  = 1 << 2,
+  WARN_NO_DATA   = 1 << 3
+};
+
+struct DashboardStatus {
+  float       tempC;
+  float       rangeM;
+  uint32_t    serialRestarts;
+  uint32_t    uptimeMin;
+  uint32_t    heapFree;
+  uint32_t    holdMs;
+  uint32_t    mqttBackoffMs;
+  int32_t     rssi;
+  const char* apName;
+  uint8_t     mqttLink;
+  uint8_t     warnings;     // StatusWarning-Bits
+  char        uptime[8];
+  char        ip[16];
+  char        bssid[18];
+};
+
+struct CacheEntry {
+  char*    buf;
+  size_t   size;
+  size_t   len;
+  uint32_t version;
+  bool     valid;
+};
+
+static char dashboardBuf[JSON_BUFFER_SIZE];
+static char targetsBuf[RADAR_TARGETS_JSON_SIZE];
+static char statusBuf[STATUS_EVENT_JSON_SIZE];
+static char logBuf[LOG_EVENT_JSON_SIZE];
+
+static CacheEntry entries[SNAPSHOT_FORMAT_COUNT] = {
+  { dashboardBuf, sizeof(dashboardBuf), 0, 0, false },
+  { targetsBuf,   sizeof(targetsBuf),   0, 0, false },
+  { statusBuf,    sizeof(statusBuf),    0, 0, false },
+};
+static CacheEntry logEntry = { logBuf, sizeof(logBuf), 0, 0, false };
+static uint32_t   logEntryAfter = 0;
+
+static RadarSnapshot   radar;
+static DashboardStatus status;
+static uint32_t        version = 1;          // Radar, Status oder Logs geändert
+static uint32_t        radarVersion = 1;
+static uint32_t        statusVersion = 1;
+static uint32_t        logSeq = 0;           // zuletzt gesehene Log-Zeile
+static uint32_t        dashboardLogSeq = 0;  // neueste Log-Zeile im Dashboard-Puffer
+static uint32_t        bootTag = 0;
+static uint32_t        buildCount = 0;
+static uint32_t        hitCount = 0;
+static unsigned long   lastStatusSample = 0;
+static bool            statusSampled = false;
+static const char*     resetReason = "unknown";
+static SemaphoreHandle_t cacheMutex = nullptr;  // Loop vs. HTTP-Handler im async_tcp-Task
+
+static void cacheLock() {
+  if (cacheMutex) xSemaphoreTake(cacheMutex, portMAX_DELAY);
+}
+
+static void cacheUnlock() {
+  if (cacheMutex) xSemaphoreGive(cacheMutex);
+}
+
+static const char* resetReasonToString(esp_reset_reason_t reason) {
+  switch (reason) {
+    case ESP_RST_POWERON:    return "power-on";
+    case ESP_RST_EXT:        return "external";
+    case ESP_RST_SW:         return "software";
+    case ESP_RST_PANIC:      return "panic";
+    case ESP_RST_INT_WDT:    return "int-watchdog";
+    case ESP_RST_TASK_WDT:   return "task-watchdog";
+    case ESP_RST_WDT:        return "watchdog";
+    case ESP_RST_DEEPSLEEP:  return "deep-sleep";
+    case ESP_RST_BROWNOUT:   return "brown-out";
+    case ESP_RST_SDIO:       return "sdio";
+    default:                 return "unknown";
+  }
+}
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return 10 + (c - 'a');
+  if (c >= 'A' && c <= 'F') return 10 + (c - 'A');
+  return -1;
+}
+
+static bool parseBssidString(const char* str, uint8_t out[6]) {
+  if (!str) return false;
+  for (int i = 0; i < 6; i++) {
+    int hi = hexNibble(str[i * 3]);
+    int lo = hexNibble(str[i * 3 + 1]);
+    if (hi < 0 || lo < 0) return false;
+    out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    if (i < 5 && str[i * 3 + 2] != ':') return false;
+  }
+  return true;
+}
+
+static bool bssidEquals(const uint8_t a[6], const uint8_t b[6]) {
+  return memcmp(a, b, 6) == 0;
+}
+
+static const char* apNameFor(const uint8_t bssid[6]) {
+  const uint8_t apFlur[6]       = {0xAE,0x42,0xA1,0x5F,0x78,0x98};
+  const uint8_t apWohnzimmer[6] = {0xAE,0x42,0xA1,0x5F,0x78,0xAE};
+  const uint8_t apKueche[6]     = {0xAE,0x42,0xA1,0x5F,0x78,0xCE};
+  if (bssidEquals(bssid, apFlur))       return "AP-Flur";
+  if (bssidEquals(bssid, apWohnzimmer)) return "AP-Wohnzimmer";
+  if (bssidEquals(bssid, apKueche))     return "AP-Kueche";
+  return "-";
+}
+
+// Einzige Stelle mit WiFi-/Temperatur-/Heap-Abfragen für das Dashboard
+// Heap und Temperatur grob gerastert, sonst zählt praktisch jede Abtastung
+// als Änderung und die Status-Version steigt alle 2 s
+static void sampleStatus(DashboardStatus& s) {
+  memset(&s, 0, sizeof(s));
+  s.tempC          = roundf(temperatureRead());
+  s.rangeM         = g_maxRangeMeters;
+  s.serialRestarts = radarSerialRestartCount;
+  s.uptimeMin      = millis() / 60000;
+  formatUptime(s.uptime, sizeof(s.uptime));
+  s.rssi           = WiFi.RSSI();
+  IPAddress ip = WiFi.localIP();
+  snprintf(s.ip, sizeof(s.ip), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  uint32_t heapFree = ESP.getFreeHeap();
+  s.heapFree       = heapFree / 1024 * 1024;
+  s.holdMs         = g_holdIntervalMs;
+  s.mqttLink       = (uint8_t)mqttLinkState();
+  s.mqttBackoffMs  = mqttBackoffMs();
+
+  uint8_t bssidBytes[6] = {0};
+  bool haveBssidBytes = false;
+  if (WiFi.status() == WL_CONNECTED && WiFi.BSSID() != nullptr) {
+    memcpy(bssidBytes, WiFi.BSSID(), sizeof(bssidBytes));
+    haveBssidBytes = true;
+    snprintf(s.bssid, sizeof(s.bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+             bssidBytes[0], bssidBytes[1], bssidBytes[2],
+             bssidBytes[3], bssidBytes[4], bssidBytes[5]);
+    strncpy(g_lastBssid, s.bssid, sizeof(g_lastBssid) - 1);
+    g_lastBssid[sizeof(g_lastBssid) - 1] = '\0';
+  } else if (g_lastBssid[0] != '\0') {
+    strncpy(s.bssid, g_lastBssid, sizeof(s.bssid) - 1);
+    haveBssidBytes = parseBssidString(s.bssid, bssidBytes);
+  }
+  s.apName = haveBssidBytes ? apNameFor(bssidBytes) : "-";
+
+  if (s.rssi < -80)                                      s.warnings |= WARN_WEAK_WIFI;
+  if (heapFree < 10000)                                  s.warnings |= WARN_LOW_HEAP;
+  if (radarTimeoutCount > 0)                             s.warnings |= WARN_TIMEOUTS;
+  if (millis() - lastRadarDataTime > NO_DATA_TIMEOUT)    s.warnings |= WARN_NO_DATA;
+}
+
+static void writeStatusFields(JsonWriter& w) {
+  const DashboardStatus& s = status;
+  w.field("fwVersion", FW_VERSION);
+  w.field("resetReason", resetReason);
+  w.field("temp_c", s.tempC);
+  w.field("radarSerialRestarts", (unsigned long)s.serialRestarts);
+  w.field("range_m", s.rangeM);
+  w.field("uptime_min", (unsigned long)s.uptimeMin);
+  w.field("uptime", s.uptime);
+  w.field("rssi", (long)s.rssi);
+  w.field("ip", s.ip);
+  w.field("heap_free", (unsigned long)s.heapFree);
+  w.field("holdMs", (unsigned long)s.holdMs);
+  w.field("mqttLink", mqttLinkName((MqttLinkState)s.mqttLink));
+  w.field("mqttBackoffMs", (unsigned long)s.mqttBackoffMs);
+  w.field("bssid", s.bssid[0] ? s.bssid : "-");
+  w.field("apName", s.apName);
+
+  w.beginArray("warnings");
+  if (s.warnings & WARN_WEAK_WIFI) w.value("Schwaches WiFi-Signal");
+  if (s.warnings & WARN_LOW_HEAP)  w.value("Wenig freier Heap");
+  if (s.warnings & WARN_TIMEOUTS)  w.value("Radar-Timeouts erkannt");
+  if (s.warnings & WARN_NO_DATA)   w.value("Keine Radar-Daten");
+  w.endArray();
+}
+
+// Log-Zeilen (afterSeq, upToSeq] als Array; wird der Puffer knapp,
+// entfallen die ältesten Zeilen
+static void writeLogLines(JsonWriter& w, const char* key, uint32_t afterSeq, uint32_t upToSeq) {
+  w.beginArray(key);
+  char line[SERIAL_LOG_LINE_LEN];
+  if (upToSeq - afterSeq > SERIAL_LOG_LINES) afterSeq = upToSeq - SERIAL_LOG_LINES;
+  uint32_t first = upToSeq + 1;
+  size_t budget = w.remaining() > 8 ? w.remaining() - 8 : 0;
+  while (first > afterSeq + 1) {
+    if (!getSerialLogLineBySeq(first - 1, line, sizeof(line))) break;
+    size_t need = strlen(line) + 3;
+    if (need > budget) break;
+    budget -= need;
+    first--;
+  }
+  for (uint32_t seq = first; seq <= upToSeq; seq++) {
+    if (!getSerialLogLineBySeq(seq, line, sizeof(line)) || line[0] == '\0') continue;
+    if (w.remaining() < strlen(line) + 8) break;
+    w.value(line);
+  }
+  w.endArray();
+}
+
+static size_t buildDashboard(char* buffer, size_t bufsize) {
+  JsonWriter w(buffer, bufsize);
+  w.beginObject();
+  w.field("targetCount", radarTargetCount(radar.targets));
+  writeStatusFields(w);
+  radarJsonTargets(w, radar.targets, false);
+
+  // Zuletzt, damit knapper Platz nur Log-Zeilen kostet
+  dashboardLogSeq = getSerialLogSeq();
+  w.field("logSeq", (unsigned long)dashboardLogSeq);
+  writeLogLines(w, "serialLogs", 0, dashboardLogSeq);
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
+
+static size_t buildStatus(char* buffer, size_t bufsize) {
+  JsonWriter w(buffer, bufsize);
+  w.beginObject();
+  writeStatusFields(w);
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
+
+static uint32_t formatVersion(SnapshotFormat fmt) {
+  switch (fmt) {
+    case SNAPSHOT_TARGETS: return radarVersion;
+    case SNAPSHOT_STATUS:  return statusVersion;
+    default:               return version;
+  }
+}
+
+void snapshotCacheInit() {
+  if (!cacheMutex) cacheMutex = xSemaphoreCreateMutex();
+  bootTag = esp_random();
+  resetReason = resetReasonToString(esp_reset_reason());
+}
+
+void snapshotCacheUpdate() {
+  RadarSnapshot snap;
+  radarPipelineSnapshot(snap);
+  unsigned long now = millis();
+  bool sample = !statusSampled || now - lastStatusSample >= SNAPSHOT_STATUS_SAMPLE_MS;
+  DashboardStatus fresh;
+  if (sample) sampleStatus(fresh);   // WiFi-Abfragen außerhalb der Sperre
+
+  cacheLock();
+  bool changed = false;
+  if (memcmp(snap.targets, radar.targets, sizeof(radar.targets)) != 0) {
+    radarVersion++;
+    changed = true;
+  }
+  radar = snap;
+
+  if (sample) {
+    if (!statusSampled || memcmp(&fresh, &status, sizeof(status)) != 0) {
+      status = fresh;
+      statusVersion++;
+      changed = true;
+    }
+    lastStatusSample = now;
+    statusSampled = true;
+  }
+  // Logs haben eigene SSE-Events, zählen aber für Dashboard und ETag
+  uint32_t seq = getSerialLogSeq();
+  if (seq != logSeq) {
+    logSeq = seq;
+    changed = true;
+  }
+  if (changed) version++;
+  cacheUnlock();
+}
+
+uint32_t snapshotCacheVersion() {
+  return version;
+}
+
+uint32_t snapshotCacheRadarVersion() {
+  return radarVersion;
+}
+
+uint32_t snapshotCacheStatusVersion() {
+  return statusVersion;
+}
+
+const RadarSnapshot& snapshotCacheRadar() {
+  return radar;
+}
+
+static const char* getLocked(SnapshotFormat fmt, size_t* len) {
+  CacheEntry& e = entries[fmt];
+  uint32_t v = formatVersion(fmt);
+  if (e.valid && e.version == v) {
+    hitCount++;
+  } else {
+    switch (fmt) {
+      case SNAPSHOT_TARGETS: e.len = radarTargetsJson(e.buf, e.size, radar); break;
+      case SNAPSHOT_STATUS:  e.len = buildStatus(e.buf, e.size); break;
+      default:               e.len = buildDashboard(e.buf, e.size); break;
+    }
+    e.version = v;
+    e.valid = true;
+    buildCount++;
+  }
+  if (len) *len = e.len;
+  return e.len ? e.buf : nullptr;
+}
+
+// Der zurückgegebene Puffer bleibt gültig, bis der Loop die Version
+// weiterzählt: nur der Loop ändert Versionen, andere Tasks bauen höchstens
+// einen veralteten Eintrag neu – nie den, den der Loop gerade liest.
+const char* snapshotCacheGet(SnapshotFormat fmt, size_t* len) {
+  if (fmt >= SNAPSHOT_FORMAT_COUNT) return nullptr;
+  cacheLock();
+  const char* json = getLocked(fmt, len);
+  cacheUnlock();
+  return json;
+}
+
+size_t snapshotCacheCopy(SnapshotFormat fmt, char* out, size_t size, uint32_t* atVersion) {
+  if (fmt >= SNAPSHOT_FORMAT_COUNT || !out) return 0;
+  size_t len = 0;
+  cacheLock();
+  const char* json = getLocked(fmt, &len);
+  if (!json || len >= size) len = 0;
+  else memcpy(out, json, len + 1);
+  if (atVersion) *atVersion = version;
+  cacheUnlock();
+  return len;
+}
+
+uint32_t snapshotCacheDashboardLogSeq() {
+  return dashboardLogSeq;
+}
+
+const char* snapshotCacheLogEvent(uint32_t afterSeq, uint32_t* upToSeq, size_t* len) {
+  uint32_t seq = getSerialLogSeq();
+  cacheLock();
+  if (logEntry.valid && logEntry.version == seq && logEntryAfter == afterSeq) {
+    hitCount++;
+  } else {
+    JsonWriter w(logEntry.buf, logEntry.size);
+    w.beginObject();
+    w.field("seq", (unsigned long)seq);
+    writeLogLines(w, "lines", afterSeq, seq);
+    w.endObject();
+    logEntry.len = w.ok() ? w.length() : 0;
+    logEntry.version = seq;
+    logEntry.valid = true;
+    logEntryAfter = afterSeq;
+    buildCount++;
+  }
+  cacheUnlock();
+  if (upToSeq) *upToSeq = seq;
+  if (len) *len = logEntry.len;
+  return logEntry.len ? logEntry.buf : nullptr;
+}
+
+void snapshotCacheETag(uint32_t atVersion, char* buf, size_t size) {
+  snprintf(buf, size, "\"%08lx-%lu\"", (unsigned long)bootTag, (unsigned long)atVersion);
+}
+
+uint32_t snapshotCacheBuilds() {
+  return buildCount;
+}
+
+uint32_t snapshotCacheHits() {
+  return hitCount;
+}
@@ -0,0 +1,48 @@
+// File: SnapshotCache.h
+
+#pragma once
+#include "Config.h"
+#include "RadarPipeline.h"
+
+// Gemeinsamer Stand für MQTT <topic>, SSE und /api/radar. snapshotCacheUpdate()
+// holt einmal pro Loop den Radar-Snapshot und tastet die Status-Felder
+// (RSSI, BSSID, IP, Temperatur, Heap, MQTT-Link …) alle
+// SNAPSHOT_STATUS_SAMPLE_MS ab. Die Versionen steigen nur, wenn sich
+// Targets, Status oder Logs tatsächlich ändern; jedes Format wird höchstens
+// einmal pro Version seiner Teile serialisiert und von allen Abnehmern
+// geteilt.
+//
+// Versionen ändert nur der Loop (snapshotCacheUpdate). Andere Tasks – die
+// HTTP-Handler im async_tcp-Task – lesen über snapshotCacheCopy(); Aufbau
+// und Kopie laufen unter einem Mutex.
+
+#define STATUS_EVENT_JSON_SIZE 768
+#define LOG_EVENT_JSON_SIZE (SERIAL_LOG_LINES * SERIAL_LOG_LINE_LEN + 64)
+
+enum SnapshotFormat : uint8_t {
+  SNAPSHOT_DASHBOARD,   // /api/radar + SSE "init" (Status, Warnungen, Targets, logSeq, Logs)
+  SNAPSHOT_TARGETS,     // <topic> + SSE "targets": {"targetCount":n,"targets":[…]}
+  SNAPSHOT_STATUS,      // SSE "status": Status-Felder + Warnungen
+  SNAPSHOT_FORMAT_COUNT
+};
+
+void     snapshotCacheInit();
+void     snapshotCacheUpdate();                 // pro Loop, vor Web und Publish
+uint32_t snapshotCacheVersion();                // Radar, Status oder Logs geändert
+uint32_t snapshotCacheRadarVersion();           // nur Targets
+uint32_t snapshotCacheStatusVersion();          // nur Status-Felder
+// Zuletzt gelesener Snapshot (frame/rxUs aktuell, Targets = Stand der Version)
+const RadarSnapshot& snapshotCacheRadar();
+// Nur Loop: serialisiertes Format der aktuellen Version; nullptr = Puffer zu klein
+const char* snapshotCacheGet(SnapshotFormat fmt, size_t* len = nullptr);
+// Beliebiger Task: Kopie nach out (nullterminiert), *atVersion = zugehörige
+// Version für das ETag; 0 = Puffer zu klein
+size_t   snapshotCacheCopy(SnapshotFormat fmt, char* out, size_t size, uint32_t* atVersion);
+// logSeq, bis zu dem der zuletzt gebaute SNAPSHOT_DASHBOARD Logs enthält
+uint32_t snapshotCacheDashboardLogSeq();
+// SSE "log": {"seq":n,"lines":[…]} mit den Zeilen nach afterSeq; *upToSeq = n
+const char* snapshotCacheLogEvent(uint32_t afterSeq, uint32_t* upToSeq, size_t* len);
+// "<boot>-<version>" inkl. Anführungszeichen, als HTTP-ETag
+void     snapshotCacheETag(uint32_t atVersion, char* buf, size_t size);
+uint32_t snapshotCacheBuilds();                 // tatsächliche Serialisierungen
+uint32_t snapshotCacheHits();                   // aus dem Cache bedient
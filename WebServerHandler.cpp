@@ -1,1328 +1,700 @@
 // File: WebServerHandler.cpp
-// Uses standard ESP32 WebServer - no external libraries needed
+// Async HTTP server (ESPAsyncWebServer + AsyncTCP): Handler laufen im
+// async_tcp-Task, nicht im Loop. Alles, was Loop-Zustand ändert (Befehle,
+// SSE-Fan-out), wird an den Loop übergeben.
 
 #include "WebServerHandler.h"
 #include "Config.h"
 #include "RadarHandler.h"
+#include "RadarRecorder.h"
+#include "RadarHistory.h"
+#include "RadarZones.h"
+#include "Metrics.h"
+#include "LoopProfiler.h"
 #include "MQTTHandler.h"
-#include <ArduinoJson.h>
-#include <esp_system.h>
-
-WebServer webServer(80);
+#include "SnapshotCache.h"
+#include "JsonWriter.h"
+#include "DashboardAssets.h"
+#include "RadarBinary.h"
+// Nur hier einbinden: WiFiManager zieht <WebServer.h>, dessen HTTP_GET & Co.
+// mit ESPAsyncWebServer kollidieren
+#include <ESPAsyncWebServer.h>
+
+static AsyncWebServer   webServer(80);
+static AsyncEventSource sseEvents("/events");
+static AsyncWebSocket   wsRadar("/ws");
 static bool serverConfigured = false;
 static bool serverRunning = false;
 
-static const char* resetReasonToString(esp_reset_reason_t reason) {
-  switch (reason) {
-    case ESP_RST_POWERON:    return "power-on";
-    case ESP_RST_EXT:        return "external";
-    case ESP_RST_SW:         return "software";
-    case ESP_RST_PANIC:      return "panic";
-    case ESP_RST_INT_WDT:    return "int-watchdog";
-    case ESP_RST_TASK_WDT:   return "task-watchdog";
-    case ESP_RST_WDT:        return "watchdog";
-    case ESP_RST_DEEPSLEEP:  return "deep-sleep";
-    case ESP_RST_BROWNOUT:   return "brown-out";
-    case ESP_RST_SDIO:       return "sdio";
-    default:                 return "unknown";
-  }
-}
-
-static int hexNibble(char c) {
-  if (c >= '0' && c <= '9') return c - '0';
-  if (c >= 'a' && c <= 'f') return 10 + (c - 'a');
-  if (c >= 'A' && c <= 'F') return 10 + (c - 'A');
-  return -1;
-}
-
-static bool parseBssidString(const char* str, uint8_t out[6]) {
-  if (!str) return false;
-  for (int i = 0; i < 6; i++) {
-    int hi = hexNibble(str[i * 3]);
-    int lo = hexNibble(str[i * 3 + 1]);
-    if (hi < 0 || lo < 0) return false;
-    out[i] = static_cast<uint8_t>((hi << 4) | lo);
-    if (i < 5 && str[i * 3 + 2] != ':') return false;
-  }
-  return true;
-}
-
-static bool bssidEquals(const uint8_t a[6], const uint8_t b[6]) {
-  return memcmp(a, b, 6) == 0;
-}
-
-// Track SSE clients
+// SSE-Clients: Die Bibliothek hält je Client eine Nachrichten-Queue und
+// sendet selbst im async_tcp-Task. Der Loop reiht nur ein; stehen bei einem
+// Client schon SSE_CLIENT_MAX_PENDING Nachrichten aus, entfällt der
+// Targets-Frame (neuere Targets ersetzen ihn ohnehin).
 struct SSEClient {
-  WiFiClient client;
-  unsigned long lastPing;
-  bool active;
+  AsyncEventSourceClient* client;   // gehört der Bibliothek; nullptr = Slot frei
+  char          ip[16];
+  unsigned long connectedAt;
+  unsigned long lastQueued;     // letztes Event beliebigen Typs (für "ping")
+  unsigned long lastDrain;      // letztes Mal, dass die Queue kürzer wurde
+  unsigned long lastTargets;
+  unsigned long lastLog;
+  uint32_t      radarVersion;   // zuletzt eingereihte Versionen
+  uint32_t      statusVersion;
+  uint32_t      logSeq;
+  uint32_t      events;         // eingereihte Events
+  uint32_t      dropped;        // Targets-Frames verworfen (Queue voll)
+  uint32_t      bytes;          // eingereihte Payload-Bytes
+  size_t        lastWaiting;
+  bool          needInit;       // "init" schickt der Loop beim nächsten Broadcast
 };
 
-SSEClient sseClients[1];
-const int MAX_SSE_CLIENTS = 1;
-unsigned long lastSseBroadcast = 0;
-
-// Embedded HTML page
-const char INDEX_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>Radar Monitor</title>
-  <style>
-    * { margin: 0; padding: 0; box-sizing: border-box; }
-
-    :root {
-      --body-bg: #000000;
-      --body-text: #f5f5f7;
-      --muted-text: rgba(245, 245, 247, 0.7);
-      --card-bg: rgba(29, 29, 31, 0.72);
-      --card-border: rgba(255, 255, 255, 0.1);
-      --card-border-hover: rgba(255, 255, 255, 0.15);
-      --card-text: #f5f5f7;
-      --card-shadow: none;
-      --card-shadow-hover: 0 8px 32px rgba(0, 0, 0, 0.3);
-      --canvas-bg: rgba(0, 0, 0, 0.4);
-      --canvas-fill: #1a1a2a;
-      --canvas-border: rgba(255, 255, 255, 0.05);
-      --status-connected-bg: rgba(52, 199, 89, 0.15);
-      --status-connected-border: rgba(52, 199, 89, 0.3);
-      --status-connected-text: #34c759;
-      --status-disconnected-bg: rgba(255, 69, 58, 0.15);
-      --status-disconnected-border: rgba(255, 69, 58, 0.3);
-      --status-disconnected-text: #ff453a;
-      --btn-bg: rgba(99, 102, 241, 0.15);
-      --btn-hover-bg: rgba(99, 102, 241, 0.25);
-      --btn-text: #f5f5f7;
-      --btn-border: rgba(99, 102, 241, 0.35);
-      --btn-ripple: rgba(255, 255, 255, 0.1);
-      --esp-info-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.1), rgba(52, 199, 89, 0.1));
-      --radar-settings-gradient: linear-gradient(135deg, rgba(255, 204, 0, 0.1), rgba(255, 149, 0, 0.1));
-      --warnings-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.1), rgba(10, 132, 255, 0.1));
-      --button-shadow: 0 10px 20px rgba(0, 0, 0, 0.25);
-      --canvas-grid-color: #2a3a4a;
-      --canvas-arc-color: #3a4a5a;
-      --canvas-label-color: #6a7a8a;
-      --divider-color: rgba(255, 255, 255, 0.05);
-      --accent-color: #0a84ff;
-      --target-box-gradient: linear-gradient(135deg, rgba(255, 159, 10, 0.1), rgba(255, 204, 0, 0.1));
-      --target-strong-color: rgba(245, 245, 247, 0.6);
-    }
-
-    body {
-      font-family: -apple-system, BlinkMacSystemFont, "SF Pro Display", "SF Pro Text", "Segoe UI", Arial, sans-serif;
-      background: var(--body-bg);
-      color: var(--body-text);
-      margin: 0;
-      padding: 12px 20px;
-      min-height: 100vh;
-      -webkit-font-smoothing: antialiased;
-      -moz-osx-font-smoothing: grayscale;
-    }
-
-    body.dark-mode {
-      --body-bg: #000000;
-      --body-text: #f5f5f7;
-      --muted-text: rgba(245, 245, 247, 0.7);
-      --card-bg: rgba(29, 29, 31, 0.72);
-      --card-border: rgba(255, 255, 255, 0.1);
-      --card-border-hover: rgba(255, 255, 255, 0.15);
-      --card-text: #f5f5f7;
-      --card-shadow: none;
-      --card-shadow-hover: 0 8px 32px rgba(0, 0, 0, 0.3);
-      --canvas-bg: rgba(0, 0, 0, 0.4);
-      --canvas-fill: #1a1a2a;
-      --canvas-border: rgba(255, 255, 255, 0.05);
-      --status-connected-bg: rgba(52, 199, 89, 0.15);
-      --status-connected-border: rgba(52, 199, 89, 0.3);
-      --status-connected-text: #34c759;
-      --status-disconnected-bg: rgba(255, 69, 58, 0.15);
-      --status-disconnected-border: rgba(255, 69, 58, 0.3);
-      --status-disconnected-text: #ff453a;
-      --btn-bg: rgba(99, 102, 241, 0.15);
-      --btn-hover-bg: rgba(99, 102, 241, 0.25);
-      --btn-text: #f5f5f7;
-      --btn-border: rgba(99, 102, 241, 0.35);
-      --btn-ripple: rgba(255, 255, 255, 0.1);
-      --esp-info-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.1), rgba(52, 199, 89, 0.1));
-      --radar-settings-gradient: linear-gradient(135deg, rgba(255, 204, 0, 0.1), rgba(255, 149, 0, 0.1));
-      --warnings-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.1), rgba(10, 132, 255, 0.1));
-      --button-shadow: 0 10px 20px rgba(0, 0, 0, 0.25);
-      --canvas-grid-color: #2a3a4a;
-      --canvas-arc-color: #3a4a5a;
-      --canvas-label-color: #6a7a8a;
-      --divider-color: rgba(255, 255, 255, 0.05);
-      --accent-color: #0a84ff;
-      --target-box-gradient: linear-gradient(135deg, rgba(255, 159, 10, 0.1), rgba(255, 204, 0, 0.1));
-      --target-strong-color: rgba(245, 245, 247, 0.6);
-    }
-
-    body.light-mode {
-      --body-bg: #f5f5f7;
-      --body-text: #1c1c1e;
-      --muted-text: rgba(60, 60, 67, 0.6);
-      --card-bg: rgba(255, 255, 255, 0.92);
-      --card-border: rgba(0, 0, 0, 0.08);
-      --card-border-hover: rgba(0, 0, 0, 0.18);
-      --card-text: #1c1c1e;
-      --card-shadow: 0 4px 18px rgba(0, 0, 0, 0.08);
-      --card-shadow-hover: 0 16px 36px rgba(0, 0, 0, 0.12);
-      --canvas-bg: rgba(255, 255, 255, 0.65);
-      --canvas-fill: #ffffff;
-      --canvas-border: rgba(0, 0, 0, 0.08);
-      --status-connected-bg: rgba(76, 217, 100, 0.2);
-      --status-connected-border: rgba(76, 217, 100, 0.45);
-      --status-connected-text: #2c7c33;
-      --status-disconnected-bg: rgba(255, 69, 58, 0.18);
-      --status-disconnected-border: rgba(255, 69, 58, 0.35);
-      --status-disconnected-text: #b3261e;
-      --btn-bg: rgba(0, 122, 255, 0.12);
-      --btn-hover-bg: rgba(0, 122, 255, 0.2);
-      --btn-text: #0b1a33;
-      --btn-border: rgba(0, 122, 255, 0.25);
-      --btn-ripple: rgba(0, 0, 0, 0.12);
-      --esp-info-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.18), rgba(52, 199, 89, 0.18));
-      --radar-settings-gradient: linear-gradient(135deg, rgba(255, 204, 0, 0.22), rgba(255, 149, 0, 0.18));
-      --warnings-gradient: linear-gradient(135deg, rgba(0, 122, 255, 0.2), rgba(10, 132, 255, 0.16));
-      --button-shadow: 0 10px 25px rgba(15, 23, 42, 0.15);
-      --canvas-grid-color: rgba(60, 60, 67, 0.18);
-      --canvas-arc-color: rgba(60, 60, 67, 0.25);
-      --canvas-label-color: rgba(60, 60, 67, 0.45);
-      --divider-color: rgba(0, 0, 0, 0.08);
-      --accent-color: #0a84ff;
-      --target-box-gradient: linear-gradient(135deg, rgba(255, 183, 77, 0.18), rgba(255, 214, 102, 0.18));
-      --target-strong-color: rgba(60, 60, 67, 0.7);
-    }
-
-    #theme-switcher {
-      display: flex;
-      justify-content: flex-end;
-      align-items: center;
-      max-width: 1600px;
-      margin: 0 auto 12px;
-    }
-
-    .theme-toggle-btn {
-      border: 1px solid var(--btn-border);
-      background: var(--btn-bg);
-      color: var(--btn-text);
-      padding: 10px 20px;
-      border-radius: 999px;
-      font-size: 14px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: background 0.2s ease, transform 0.2s ease, box-shadow 0.2s ease;
-      box-shadow: var(--button-shadow);
-      backdrop-filter: blur(12px);
-    }
-
-    .theme-toggle-btn:hover {
-      background: var(--btn-hover-bg);
-      transform: translateY(-1px);
-    }
-
-    .toggle-btn {
-      border: 1px solid var(--btn-border);
-      background: var(--btn-bg);
-      color: var(--btn-text);
-      padding: 6px 14px;
-      border-radius: 999px;
-      font-size: 13px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: background 0.2s ease, transform 0.2s ease, box-shadow 0.2s ease;
-      box-shadow: var(--button-shadow);
-      backdrop-filter: blur(12px);
-    }
-
-    .toggle-btn:hover {
-      background: var(--btn-hover-bg);
-      transform: translateY(-1px);
-    }
-
-    .toggle-btn.active {
-      background: var(--btn-hover-bg);
-    }
-
-    h1 {
-      background: linear-gradient(90deg, #00d4ff, #0066ff);
-      -webkit-background-clip: text;
-      -webkit-text-fill-color: transparent;
-      background-clip: text;
-      text-align: center;
-      margin-bottom: 20px;
-      font-size: 32px;
-      font-weight: 700;
-      letter-spacing: -0.5px;
-    }
-
-    #status {
-      padding: 10px 20px;
-      border-radius: 20px;
-      margin: 0 auto 25px;
-      font-size: 14px;
-      text-align: center;
-      max-width: 200px;
-      font-weight: 500;
-      backdrop-filter: blur(20px);
-    }
-    #status.connected {
-      background: var(--status-connected-bg);
-      border: 1px solid var(--status-connected-border);
-      color: var(--status-connected-text);
-    }
-    #status.disconnected {
-      background: var(--status-disconnected-bg);
-      border: 1px solid var(--status-disconnected-border);
-      color: var(--status-disconnected-text);
-    }
-
-    /* Dashboard Grid */
-    #dashboard {
-      display: grid;
-      grid-template-columns: 260px 1fr 1fr 1fr;
-      grid-template-rows: auto auto auto auto;
-      grid-template-areas:
-        "esp radar radar radar"
-        "buttons radar radar radar"
-        "settings target1 target2 target3"
-        "warnings warnings warnings warnings";
-      gap: 16px;
-      max-width: 1600px;
-      margin: 0 auto;
-      align-items: stretch;
-    }
-
-    /* Card Base Style - Apple Glassmorphism */
-    .card {
-      background: var(--card-bg);
-      backdrop-filter: saturate(180%) blur(20px);
-      border-radius: 18px;
-      border: 1px solid var(--card-border);
-      padding: 24px;
-      transition: all 0.3s ease;
-      box-shadow: var(--card-shadow);
-      color: var(--card-text);
-    }
-    .card:hover {
-      border-color: var(--card-border-hover);
-      box-shadow: var(--card-shadow-hover);
-    }
-    .card h3 {
-      font-size: 17px;
-      font-weight: 600;
-      margin-bottom: 16px;
-      color: var(--card-text);
-      letter-spacing: -0.3px;
-    }
+static SSEClient         sseClients[SSE_MAX_CLIENTS];
+static SemaphoreHandle_t sseMutex    = nullptr;  // Slots: async_tcp-Task (connect/disconnect) vs. Loop; rekursiv
+static uint32_t          sseRejected = 0;        // abgewiesen, alle Slots belegt
+static uint32_t          sseKicked   = 0;        // wegen Stillstand getrennt
+
+// /ws-Clients: jeder neue Frame als RadarBinary-Payload (v1, 10 + n·12 Bytes),
+// gedrosselt auf die vom Client ausgehandelte Rate. Slots belegt/freigegeben
+// im async_tcp-Task, gesendet aus dem Loop; die Bibliothek hält die Clients,
+// hier nur über die ID angesprochen.
+struct WSClient {
+  uint32_t      id;             // 0 = Slot frei
+  char          ip[16];
+  unsigned long connectedAt;
+  unsigned long lastSent;
+  uint16_t      rateHz;         // 0 = jeder Frame
+  uint16_t      minIntervalMs;
+  uint32_t      frames;         // gesendete Frames
+  uint32_t      dropped;        // Sendepuffer voll, Frame entfallen
+  uint32_t      bytes;
+};
 
-    /* ESP Info Box */
-    #esp-info {
-      grid-area: esp;
-      background: var(--esp-info-gradient);
-    }
+static WSClient          wsClients[WS_MAX_CLIENTS];
+static SemaphoreHandle_t wsMutex      = nullptr;
+static uint32_t          wsRejected   = 0;
+static uint32_t          wsLastFrame  = 0;
+static unsigned long     wsLastCleanup = 0;
 
-    /* Radar Canvas */
-    canvas {
-      grid-area: radar;
-      background: var(--canvas-bg);
-      border-radius: 12px;
-      width: 100%;
-      height: auto;
-      aspect-ratio: 4 / 3;
-      border: 1px solid var(--canvas-border);
-    }
+// /api/cmd → Loop
+struct WebCommand {
+  char text[WEB_CMD_MAX_LEN];
+};
+static QueueHandle_t webCmdQueue = nullptr;
+
+// Handler laufen nacheinander im async_tcp-Task, daher reichen statische Puffer
+static char apiBuffer[JSON_BUFFER_SIZE];
+static bool exportActive = false;
+static AsyncWebServerRequest* importRequest = nullptr;   // laufender Upload
+static bool importFailed = false;                          // Datei ungültig, Rest wird ignoriert
+
+// Auslieferung der Dashboard-Dateien, nur im async_tcp-Task geschrieben
+struct AssetStats {
+  uint32_t served;        // 200 mit gzip-Body
+  uint32_t notModified;   // 304
+  uint32_t lastUs;        // Handler → letzter Chunk an TCP übergeben
+  uint32_t maxUs;
+};
+static AssetStats assetStats[DASHBOARD_ASSET_COUNT];
 
-    /* Control Buttons */
-    #control-buttons {
-      grid-area: buttons;
-      display: flex;
-      flex-direction: column;
-      gap: 12px;
-    }
 
-    /* Radar Settings */
-    #radar-settings {
-      grid-area: settings;
-      background: var(--radar-settings-gradient);
-    }
 
-    /* Target Info */
-    #target1-box { grid-area: target1; }
-    #target2-box { grid-area: target2; }
-    #target3-box { grid-area: target3; }
+static void sseLock() {
+  if (sseMutex) xSemaphoreTakeRecursive(sseMutex, portMAX_DELAY);
+}
 
-    /* Warnings */
-    #warnings {
-      grid-area: warnings;
-      background: var(--warnings-gradient);
-    }
-    /* Apple Buttons */
-    .btn {
-      padding: 14px 20px;
-      border-radius: 12px;
-      font-size: 15px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: all 0.2s cubic-bezier(0.4, 0, 0.2, 1);
-      width: 100%;
-      text-align: center;
-      letter-spacing: -0.2px;
-      position: relative;
-      overflow: hidden;
-      border: 1px solid var(--btn-border);
-      background: var(--btn-bg);
-      color: var(--btn-text);
-      box-shadow: var(--button-shadow);
-      backdrop-filter: blur(12px);
-    }
-    .btn::before {
-      content: '';
-      position: absolute;
-      top: 50%;
-      left: 50%;
-      width: 0;
-      height: 0;
-      border-radius: 50%;
-      background: var(--btn-ripple);
-      transform: translate(-50%, -50%);
-      transition: width 0.6s, height 0.6s;
-    }
-    .btn:hover::before {
-      width: 300px;
-      height: 300px;
-    }
-    .btn:hover {
-      background: var(--btn-hover-bg);
-    }
-    .btn-danger {
-      background: linear-gradient(135deg, #ff453a 0%, #ff2d55 100%);
-      color: white;
-      box-shadow: 0 4px 12px rgba(255, 69, 58, 0.3);
-    }
-    .btn-danger:hover {
-      box-shadow: 0 6px 20px rgba(255, 69, 58, 0.4);
-      transform: translateY(-1px);
-    }
-    .btn-warning {
-      background: linear-gradient(135deg, #ff9f0a 0%, #ff9500 100%);
-      color: white;
-      box-shadow: 0 4px 12px rgba(255, 159, 10, 0.3);
-    }
-    .btn-warning:hover {
-      box-shadow: 0 6px 20px rgba(255, 159, 10, 0.4);
-      transform: translateY(-1px);
-    }
+static void sseUnlock() {
+  if (sseMutex) xSemaphoreGiveRecursive(sseMutex);
+}
 
-    /* Info Items */
-    .info-item {
-      margin: 10px 0;
-      font-size: 14px;
-      display: flex;
-      justify-content: space-between;
-      padding: 8px 0;
-      border-bottom: 1px solid var(--divider-color);
-    }
-    .info-item:last-child {
-      border-bottom: none;
-    }
-    .info-label {
-      font-weight: 500;
-      color: var(--muted-text);
-    }
-    .info-value {
-      color: var(--accent-color);
-      font-weight: 600;
-    }
+// Ein Event an einen Client; false = Queue der Bibliothek voll
+static bool sseQueue(SSEClient& slot, const char* event, const char* data, size_t len) {
+  if (!slot.client->send(data, event)) return false;
+  slot.lastQueued = millis();
+  slot.events++;
+  slot.bytes += len;
+  return true;
+}
 
-    /* Target Boxes */
-    .target-box {
-      background: var(--target-box-gradient);
-      height: 100%;
-    }
-    .target-data {
-      font-size: 13px;
-      line-height: 1.6;
-    }
-    .target-data div {
-      margin: 8px 0;
-      display: flex;
-      justify-content: space-between;
-      padding: 6px 0;
-      border-bottom: 1px solid var(--divider-color);
-    }
-    .target-data div:last-child {
-      border-bottom: none;
-    }
-    .target-data strong {
-      color: var(--target-strong-color);
-      font-weight: 500;
-    }
+// Named Events auf /events:
+//   init     Verbindungsaufbau: komplettes Dashboard (wie /api/radar) inkl. logSeq
+//   targets  bei jeder Radar-Änderung, max. alle SSE_TARGETS_MIN_MS
+//   status   nur wenn sich ein Status-Feld ändert (Abtastung alle 2 s)
+//   log      nur neue Zeilen {"seq":n,"lines":[…]}, gesammelt je SSE_LOG_MIN_MS
+//   ping     nach SSE_KEEPALIVE_MS ohne anderes Event
+//
+// async_tcp-Task: nur Slot belegen, init folgt aus dem Loop
+static void onSseConnect(AsyncEventSourceClient* client) {
+  sseLock();
+  SSEClient* slot = nullptr;
+  for (int i = 0; i < SSE_MAX_CLIENTS && !slot; i++) {
+    if (!sseClients[i].client) slot = &sseClients[i];
+  }
+  if (slot) {
+    unsigned long now = millis();
+    memset(slot, 0, sizeof(*slot));
+    slot->client      = client;
+    slot->connectedAt = now;
+    slot->lastQueued  = now;
+    slot->lastDrain   = now;
+    slot->needInit    = true;
+    IPAddress addr = client->client()->remoteIP();
+    snprintf(slot->ip, sizeof(slot->ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+  }
+  sseUnlock();
+  if (!slot) {
+    sseRejected++;
+    client->close();   // Dashboard fällt aufs Polling zurück
+  }
+}
 
-    /* Warning Items */
-    .warning-item {
-      background: rgba(255, 159, 10, 0.1);
-      border-left: 3px solid #ff9f0a;
-      padding: 12px 16px;
-      border-radius: 8px;
-      margin: 8px 0;
-      font-size: 14px;
-      font-weight: 500;
-    }
-    .log-title {
-      margin: 16px 0 8px;
-      font-size: 13px;
-      text-transform: uppercase;
-      letter-spacing: 0.8px;
-      color: var(--muted-text);
-    }
-    #logList {
-      display: flex;
-      flex-direction: column;
-      gap: 6px;
-    }
-    .log-item {
-      background: rgba(0, 0, 0, 0.08);
-      border-left: 3px solid rgba(100, 210, 255, 0.6);
-      padding: 8px 12px;
-      border-radius: 8px;
-      font-size: 12px;
-      line-height: 1.4;
-      font-family: monospace;
-      word-break: break-word;
-    }
+static void onSseDisconnect(AsyncEventSourceClient* client) {
+  sseLock();
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (sseClients[i].client == client) sseClients[i].client = nullptr;
+  }
+  sseUnlock();
+}
 
-    @media (max-width: 880px) {
-      #theme-switcher {
-        justify-content: center;
-        margin-bottom: 8px;
-      }
-      #dashboard {
-        grid-template-columns: 1fr;
-        grid-template-areas:
-          "radar"
-          "esp"
-          "target1"
-          "target2"
-          "target3"
-          "settings"
-          "buttons"
-          "warnings";
-      }
-      canvas {
-        min-height: 300px;
-      }
-      #control-buttons {
-        flex-direction: column;
+// Loop: Payloads einmal pro Runde aus dem SnapshotCache holen und bei allen
+// fälligen Clients einreihen; die Bibliothek sendet im async_tcp-Task
+void broadcastRadarSSE() {
+  unsigned long now = millis();
+  uint32_t radarVersion  = snapshotCacheRadarVersion();
+  uint32_t statusVersion = snapshotCacheStatusVersion();
+  uint32_t logSeq        = getSerialLogSeq();
+  const char* targetsJson = nullptr;
+  const char* statusJson  = nullptr;
+  size_t targetsLen = 0, statusLen = 0;
+  bool targetsQueued = false;
+
+  sseLock();
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    SSEClient& c = sseClients[i];
+    if (!c.client) continue;
+
+    size_t waiting = c.client->packetsWaiting();
+    if (waiting == 0 || waiting < c.lastWaiting) c.lastDrain = now;
+    c.lastWaiting = waiting;
+    if (waiting && now - c.lastDrain > SSE_STALL_TIMEOUT_MS) {
+      logPrintf("SSE: Client %s haengt, getrennt\n", c.ip);
+      sseKicked++;
+      // Unter der Sperre: die Bibliothek löscht den Client erst nach
+      // onSseDisconnect(), das hier rekursiv sperrt und den Slot freigibt.
+      // Ein Disconnect des Peers im async_tcp-Task wartet solange.
+      c.client->close();
+      c.client = nullptr;
+      continue;
+    }
+
+    if (c.needInit) {
+      size_t len;
+      const char* json = snapshotCacheGet(SNAPSHOT_DASHBOARD, &len);
+      if (json && !sseQueue(c, "init", json, len)) continue;
+      c.needInit      = false;
+      c.lastTargets   = now;
+      c.lastLog       = now;
+      c.radarVersion  = snapshotCacheRadarVersion();
+      c.statusVersion = snapshotCacheStatusVersion();
+      c.logSeq        = snapshotCacheDashboardLogSeq();
+      continue;
+    }
+
+    bool full = waiting >= SSE_CLIENT_MAX_PENDING;
+    bool queued = false;
+
+    if (c.radarVersion != radarVersion && now - c.lastTargets >= SSE_TARGETS_MIN_MS) {
+      if (!targetsJson) targetsJson = snapshotCacheGet(SNAPSHOT_TARGETS, &targetsLen);
+      // Queue voll: Frame entfällt, Version bleibt offen → nächster Versuch mit neuerem Stand
+      if (!targetsJson) {
+        c.radarVersion = radarVersion;
+      } else if (!full && sseQueue(c, "targets", targetsJson, targetsLen)) {
+        c.radarVersion = radarVersion;
+        queued = targetsQueued = true;
+      } else {
+        c.dropped++;
       }
+      c.lastTargets = now;
     }
 
-    @media (max-width: 480px) {
-      body {
-        padding: 10px 14px;
-      }
-      #theme-switcher {
-        margin-bottom: 6px;
+    if (!full && c.statusVersion != statusVersion) {
+      if (!statusJson) statusJson = snapshotCacheGet(SNAPSHOT_STATUS, &statusLen);
+      if (!statusJson || sseQueue(c, "status", statusJson, statusLen)) {
+        c.statusVersion = statusVersion;
+        if (statusJson) queued = true;
       }
-      .theme-toggle-btn {
-        padding: 8px 16px;
-        font-size: 13px;
-      }
-      h1 {
-        font-size: 26px;
-        margin-bottom: 12px;
-      }
-      #status {
-        margin-bottom: 18px;
-        padding: 10px 16px;
-      }
-    }
-  </style>
-</head>
-<body class="dark-mode">
-  <div id="theme-switcher">
-    <button id="themeToggle" class="theme-toggle-btn" type="button">☀️ Light Mode</button>
-  </div>
-  <h1>🎯 Radar Live Monitor</h1>
-  <div id="status" class="connected">Verbunden</div>
-
-  <div id="dashboard">
-    <!-- ESP Infos -->
-    <div id="esp-info" class="card">
-      <h3>ESP Infos</h3>
-      <div class="info-item"><span class="info-label">Firmware:</span> <span id="fwVersion" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">Reset Reason:</span> <span id="resetReason" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">Temperatur:</span> <span id="temperature" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">Radar Restarts:</span> <span id="radarSerialRestarts" class="info-value">0</span></div>
-      <div class="info-item"><span class="info-label">IP:</span> <span id="ip" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">BSSID:</span> <span id="bssid" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">Access Point:</span> <span id="apName" class="info-value">-</span></div>
-      <div class="info-item"><span class="info-label">Uptime:</span> <span id="uptime" class="info-value">000:00</span></div>
-      <div class="info-item"><span class="info-label">RSSI:</span> <span id="rssi" class="info-value">0 dBm</span></div>
-      <div class="info-item"><span class="info-label">Heap:</span> <span id="heap" class="info-value">0 KB</span></div>
-      <div class="info-item"><span class="info-label">Targets:</span> <span id="targetCount" class="info-value">0</span></div>
-      <div class="info-item"><span class="info-label">X-Achse:</span> <button id="invertToggle" class="toggle-btn" type="button">Normal</button></div>
-    </div>
-
-    <!-- Radar Visualization -->
-    <canvas id="radar" width="800" height="450"></canvas>
-
-    <!-- Control Buttons -->
-    <div id="control-buttons">
-      <button class="btn btn-danger" onclick="if(confirm('ESP32 wirklich neustarten?')) sendCommand('reboot')">Restart ESP</button>
-      <button class="btn btn-danger" onclick="sendCommand('resetRadar')">Restart Radar</button>
-      <button class="btn btn-warning" onclick="sendCommand('config')">WiFiManager start</button>
-    </div>
-
-    <!-- Radar Settings -->
-    <div id="radar-settings" class="card">
-      <h3>Radar Setting Information</h3>
-      <div class="info-item"><span class="info-label">Range:</span> <span id="maxRange" class="info-value">0m</span></div>
-      <div class="info-item"><span class="info-label">Hold:</span> <span id="holdMs" class="info-value">0ms</span></div>
-    </div>
-
-    <!-- Target Informations -->
-    <div id="target1-box" class="target-box card">
-      <h3>Target 1</h3>
-      <div id="target1-data" class="target-data">No target detected</div>
-    </div>
-    <div id="target2-box" class="target-box card">
-      <h3>Target 2</h3>
-      <div id="target2-data" class="target-data">No target detected</div>
-    </div>
-    <div id="target3-box" class="target-box card">
-      <h3>Target 3</h3>
-      <div id="target3-data" class="target-data">No target detected</div>
-    </div>
-
-    <!-- Warnings -->
-    <div id="warnings" class="card">
-      <h3>⚠️ Warnings</h3>
-      <div id="warningList"></div>
-      <div class="log-title">Letzte Logs</div>
-      <div id="logList"></div>
-    </div>
-  </div>
-
-  <script>
-    const canvas = document.getElementById('radar');
-    const ctx = canvas.getContext('2d');
-    const statusEl = document.getElementById('status');
-    const themeToggle = document.getElementById('themeToggle');
-    const invertToggle = document.getElementById('invertToggle');
-    const THEME_STORAGE_KEY = 'rp-theme';
-    const INVERT_COOKIE_KEY = 'rp-invert-x';
-    const prefersDarkQuery = window.matchMedia ? window.matchMedia('(prefers-color-scheme: dark)') : null;
-
-    function varFallback(value, fallback) {
-      if (typeof value !== 'string') return fallback;
-      const trimmed = value.trim();
-      return trimmed.length ? trimmed : fallback;
     }
 
-    function readCookie(name) {
-      const match = document.cookie.match(new RegExp('(?:^|; )' + name + '=([^;]*)'));
-      return match ? decodeURIComponent(match[1]) : null;
-    }
-
-    function writeCookie(name, value, days) {
-      const maxAge = (days || 365) * 24 * 60 * 60;
-      document.cookie = name + '=' + encodeURIComponent(value) + '; path=/; max-age=' + maxAge + '; SameSite=Lax';
-    }
-
-    let configuredRange = 5; // Vom Sensor eingestellte Reichweite
-    const MAX_RANGE = 8; // Maximale Radar-Reichweite
-    const BASE_CANVAS_WIDTH = 800;
-    const BASE_CANVAS_HEIGHT = 600;
-    const BASE_PIXELS_PER_METER = 50;
-    const BASE_CENTER_X = 400;
-    const BASE_CENTER_Y = 30;
-
-    let canvasWidth = BASE_CANVAS_WIDTH;
-    let canvasHeight = BASE_CANVAS_HEIGHT;
-    let pixelsPerMeter = BASE_PIXELS_PER_METER;
-    let centerX = BASE_CENTER_X;
-    let centerY = BASE_CENTER_Y;
-    let uiScale = 1;
-    let resizePending = false;
-    let fallbackTimer = null;
-    let eventSource = null;
-    let sseWatchdogTimer = null;
-    let lastSseEventAt = 0;
-    const SSE_STALE_MS = 8000;
-    let invertXAxis = false;
-    let lastRadarPayload = null;
-
-    const resetReasonMap = {
-      1: 'POWERON_RESET',
-      3: 'SW_RESET',
-      4: 'OWDT_RESET',
-      5: 'DEEPSLEEP_RESET',
-      6: 'SDIO_RESET',
-      7: 'TG0WDT_SYS_RESET',
-      8: 'TG1WDT_SYS_RESET',
-      9: 'RTCWDT_SYS_RESET',
-      10: 'INTRUSION_RESET',
-      11: 'TGWDT_CPU_RESET',
-      12: 'SW_CPU_RESET',
-      13: 'RTCWDT_CPU_RESET',
-      14: 'EXT_CPU_RESET',
-      15: 'RTCWDT_BROWN_OUT_RESET',
-      16: 'RTCWDT_RTC_RESET'
-    };
-
-    function formatResetReason(code) {
-      if (code === undefined || code === null) return '-';
-      if (typeof code === 'string') return code;
-      return resetReasonMap[code] || ('code ' + code);
-    }
-
-    function escapeHtml(value) {
-      return String(value)
-        .replace(/&/g, '&amp;')
-        .replace(/</g, '&lt;')
-        .replace(/>/g, '&gt;')
-        .replace(/"/g, '&quot;')
-        .replace(/'/g, '&#39;');
-    }
-
-    function applyTheme(mode) {
-      const isLight = mode === 'light';
-      document.body.classList.toggle('light-mode', isLight);
-      document.body.classList.toggle('dark-mode', !isLight);
-      if (themeToggle) {
-        themeToggle.textContent = isLight ? '🌙 Dark Mode' : '☀️ Light Mode';
+    if (!full && c.logSeq != logSeq && now - c.lastLog >= SSE_LOG_MIN_MS) {
+      // Clients auf gleichem Stand teilen sich den gecachten Payload
+      uint32_t upTo;
+      size_t len;
+      const char* json = snapshotCacheLogEvent(c.logSeq, &upTo, &len);
+      if (!json || sseQueue(c, "log", json, len)) {
+        c.logSeq = upTo;
+        if (json) queued = true;
       }
+      c.lastLog = now;
     }
 
-    function updateInvertToggleLabel() {
-      if (!invertToggle) return;
-      invertToggle.textContent = invertXAxis ? 'Invertiert' : 'Normal';
-      invertToggle.classList.toggle('active', invertXAxis);
-      invertToggle.setAttribute('aria-pressed', invertXAxis ? 'true' : 'false');
+    if (!queued && waiting == 0 && now - c.lastQueued >= SSE_KEEPALIVE_MS) {
+      sseQueue(c, "ping", "{}", 2);
     }
+  }
+  sseUnlock();
 
-    function initTheme() {
-      let storedMode = null;
-      try {
-        storedMode = localStorage.getItem(THEME_STORAGE_KEY);
-      } catch (err) {
-        storedMode = null;
-      }
-
-      let initialMode = storedMode;
-      if (initialMode !== 'light' && initialMode !== 'dark') {
-        const prefersDark = prefersDarkQuery ? prefersDarkQuery.matches : true;
-        initialMode = prefersDark ? 'dark' : 'light';
-      }
-
-      applyTheme(initialMode);
-
-      if (themeToggle) {
-        themeToggle.addEventListener('click', () => {
-          const newMode = document.body.classList.contains('light-mode') ? 'dark' : 'light';
-          applyTheme(newMode);
-          try {
-            localStorage.setItem(THEME_STORAGE_KEY, newMode);
-          } catch (err) {
-            /* ignore storage errors */
-          }
-        });
-      }
+  if (targetsQueued) {
+    const RadarSnapshot& snap = snapshotCacheRadar();
+    if (snap.rxUs) metricsRecordLatency(LAT_SSE, micros() - snap.rxUs);
+  }
+}
 
-      const handleSystemThemeChange = (event) => {
-        let stored = null;
-        try {
-          stored = localStorage.getItem(THEME_STORAGE_KEY);
-        } catch (err) {
-          stored = null;
-        }
-        if (stored === 'light' || stored === 'dark') {
-          return; // user preference overrides system
-        }
-        applyTheme(event.matches ? 'dark' : 'light');
-      };
-
-      if (prefersDarkQuery) {
-        if (prefersDarkQuery.addEventListener) {
-          prefersDarkQuery.addEventListener('change', handleSystemThemeChange);
-        } else if (prefersDarkQuery.addListener) {
-          prefersDarkQuery.addListener(handleSystemThemeChange);
-        }
-      }
-    }
+uint8_t sseClientCount() {
+  uint8_t n = 0;
+  sseLock();
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (sseClients[i].client) n++;
+  }
+  sseUnlock();
+  return n;
+}
 
-    function initInvertToggle() {
-      const stored = readCookie(INVERT_COOKIE_KEY);
-      invertXAxis = stored === '1';
-      updateInvertToggleLabel();
-
-      if (invertToggle) {
-        invertToggle.addEventListener('click', () => {
-          invertXAxis = !invertXAxis;
-          updateInvertToggleLabel();
-          writeCookie(INVERT_COOKIE_KEY, invertXAxis ? '1' : '0', 365);
-          if (lastRadarPayload) {
-            updateRadar(lastRadarPayload);
-          } else {
-            drawRadar();
-          }
-        });
-      }
-    }
+size_t sseStatsJson(char* buf, size_t size) {
+  unsigned long now = millis();
+  JsonWriter w(buf, size);
+  w.beginObject();
+  w.field("max", SSE_MAX_CLIENTS);
+  w.field("rejected", (unsigned long)sseRejected);
+  w.field("kicked", (unsigned long)sseKicked);
+  w.beginArray("clients");
+  sseLock();
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    const SSEClient& c = sseClients[i];
+    if (!c.client) continue;
+    w.beginObject();
+    w.field("ip", c.ip);
+    w.field("ageS", (now - c.connectedAt) / 1000);
+    w.field("events", (unsigned long)c.events);
+    w.field("dropped", (unsigned long)c.dropped);
+    w.field("bytes", (unsigned long)c.bytes);
+    w.field("queued", (unsigned long)c.lastWaiting);
+    w.endObject();
+  }
+  sseUnlock();
+  w.endArray();
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
 
-    function resizeCanvas() {
-      if (!canvas || !ctx) return false;
-      const rect = canvas.getBoundingClientRect();
-      let width = Math.max(1, Math.round(rect.width));
-      if (width < 10 && canvas.parentElement) {
-        width = Math.max(1, Math.round(canvas.parentElement.clientWidth));
-      }
-      if (width < 10) {
-        requestAnimationFrame(resizeCanvas);
-        return false;
-      }
-      const aspectRatio = BASE_CANVAS_HEIGHT / BASE_CANVAS_WIDTH;
-      const height = Math.round(width * aspectRatio);
-      canvas.style.height = height + 'px';
-
-      const pixelRatio = window.devicePixelRatio || 1;
-      const internalWidth = Math.max(1, Math.round(width * pixelRatio));
-      const internalHeight = Math.max(1, Math.round(height * pixelRatio));
-      if (canvas.width !== internalWidth || canvas.height !== internalHeight) {
-        canvas.width = internalWidth;
-        canvas.height = internalHeight;
-      }
-      ctx.setTransform(pixelRatio, 0, 0, pixelRatio, 0, 0);
-
-      canvasWidth = width;
-      canvasHeight = height;
-      uiScale = canvasWidth / BASE_CANVAS_WIDTH;
-      pixelsPerMeter = BASE_PIXELS_PER_METER * uiScale;
-      centerX = BASE_CENTER_X * uiScale;
-      centerY = BASE_CENTER_Y * uiScale;
-      return true;
-    }
+static void wsLock() {
+  if (wsMutex) xSemaphoreTake(wsMutex, portMAX_DELAY);
+}
 
-    function redrawRadar() {
-      if (lastRadarPayload) {
-        updateRadar(lastRadarPayload);
-      } else {
-        drawRadar();
-      }
-    }
+static void wsUnlock() {
+  if (wsMutex) xSemaphoreGive(wsMutex);
+}
 
-    function scheduleCanvasRefresh() {
-      if (resizePending) return;
-      resizePending = true;
-      const attemptRefresh = () => {
-        if (resizeCanvas()) {
-          resizePending = false;
-          redrawRadar();
-        } else {
-          requestAnimationFrame(attemptRefresh);
-        }
-      };
-      requestAnimationFrame(attemptRefresh);
-    }
+static void wsSetRate(WSClient& slot, unsigned long hz) {
+  if (hz > WS_MAX_RATE_HZ) hz = WS_MAX_RATE_HZ;
+  slot.rateHz        = (uint16_t)hz;
+  slot.minIntervalMs = hz ? (uint16_t)(1000 / hz) : 0;
+}
 
-    function formatUptimeLabel(minutes, formatted) {
-      if (formatted && typeof formatted === 'string') {
-        return formatted;
-      }
-      const totalMinutes = Number.isFinite(minutes) ? Math.max(0, Math.floor(minutes)) : 0;
-      const hours = Math.min(999, Math.floor(totalMinutes / 60));
-      const mins = totalMinutes % 60;
-      return hours.toString().padStart(3, '0') + ':' + mins.toString().padStart(2, '0');
-    }
+// Bestätigung als Text-Frame: {"v":1,"rate":10}
+static void wsSendHello(AsyncWebSocketClient* client, uint16_t rateHz) {
+  char hello[40];
+  snprintf(hello, sizeof(hello), "{\"v\":%u,\"rate\":%u}", RADAR_BIN_VERSION, rateHz);
+  client->text(hello);
+}
 
-    function sendCommand(cmd) {
-      fetch('/api/cmd?cmd=' + cmd)
-        .then(res => res.text())
-        .then(data => {
-          alert('Befehl gesendet: ' + cmd + '\nAntwort: ' + data);
-        })
-        .catch(err => {
-          alert('Fehler beim Senden des Befehls: ' + err);
-        });
-    }
+// Rate beim Verbinden per /ws?rate=<Hz>, später per Text-Frame "rate:<Hz>";
+// 0 oder ohne Angabe = jeder Frame
+static void onWsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                      void* arg, uint8_t* data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    AsyncWebServerRequest* request = (AsyncWebServerRequest*)arg;
+    unsigned long hz = (request && request->hasArg("rate")) ? strtoul(request->arg("rate").c_str(), nullptr, 10) : 0;
+    wsLock();
+    WSClient* slot = nullptr;
+    for (int i = 0; i < WS_MAX_CLIENTS && !slot; i++) {
+      if (!wsClients[i].id) slot = &wsClients[i];
+    }
+    if (slot) {
+      memset(slot, 0, sizeof(*slot));
+      slot->id          = client->id();
+      slot->connectedAt = millis();
+      wsSetRate(*slot, hz);
+      IPAddress addr = client->remoteIP();
+      snprintf(slot->ip, sizeof(slot->ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+    }
+    uint16_t rate = slot ? slot->rateHz : 0;
+    wsUnlock();
+    if (!slot) {
+      wsRejected++;
+      client->close(1013, "busy");   // Dashboard bleibt bei SSE-Targets
+      return;
+    }
+    wsSendHello(client, rate);
+  } else if (type == WS_EVT_DISCONNECT) {
+    wsLock();
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+      if (wsClients[i].id == client->id()) wsClients[i].id = 0;
+    }
+    wsUnlock();
+  } else if (type == WS_EVT_DATA) {
+    // Nur kurze, unfragmentierte Text-Frames
+    AwsFrameInfo* info = (AwsFrameInfo*)arg;
+    if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT) return;
+    char text[16];
+    if (len >= sizeof(text) || len < 5 || memcmp(data, "rate:", 5) != 0) return;
+    memcpy(text, data, len);
+    text[len] = '\0';
+    int16_t rate = -1;
+    wsLock();
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+      if (wsClients[i].id != client->id()) continue;
+      wsSetRate(wsClients[i], strtoul(text + 5, nullptr, 10));
+      rate = wsClients[i].rateHz;
+    }
+    wsUnlock();
+    if (rate >= 0) wsSendHello(client, rate);
+  }
+}
 
-    function fetchData() {
-      fetch('/api/radar')
-        .then(res => res.json())
-        .then(data => {
-          statusEl.className = 'connected';
-          updateRadar(data);
-        })
-        .catch(err => {
-          statusEl.className = 'disconnected';
-          console.error('Fetch error:', err);
-        });
-    }
+// Loop: neuen Frame einmal kodieren und an alle fälligen Clients geben.
+// Der Ingest-Task veröffentlicht jeden Frame im Snapshot, der Loop liest
+// ihn pro Runde – /ws sieht damit die volle Sensorrate, unabhängig von
+// Publish-Modus und SSE-Drossel.
+void broadcastRadarWS() {
+  unsigned long now = millis();
+  if (now - wsLastCleanup >= WS_CLEANUP_MS) {
+    wsRadar.cleanupClients(WS_MAX_CLIENTS);
+    wsLastCleanup = now;
+  }
 
-    function startPollingFallback() {
-      if (fallbackTimer) return;
-      if (sseWatchdogTimer) {
-        clearInterval(sseWatchdogTimer);
-        sseWatchdogTimer = null;
-      }
-      fetchData();
-      fallbackTimer = setInterval(fetchData, 1000);
-    }
+  const RadarSnapshot& snap = snapshotCacheRadar();
+  if (snap.frame == wsLastFrame) return;
+  wsLastFrame = snap.frame;
+
+  uint8_t bin[RADAR_BIN_MAX_SIZE];
+  size_t len = radarBinaryEncode(snap, bin, sizeof(bin));
+  if (!len) return;
+
+  bool sent = false;
+  wsLock();
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    WSClient& c = wsClients[i];
+    if (!c.id || now - c.lastSent < c.minIntervalMs) continue;
+    // Puffer voll: Frame entfällt, der nächste bringt den neueren Stand
+    if (!wsRadar.availableForWrite(c.id) || !wsRadar.binary(c.id, bin, len)) {
+      c.dropped++;
+      continue;
+    }
+    c.lastSent = now;
+    c.frames++;
+    c.bytes += len;
+    sent = true;
+  }
+  wsUnlock();
 
-    function startSseWatchdog() {
-      if (sseWatchdogTimer) {
-        clearInterval(sseWatchdogTimer);
-      }
-      sseWatchdogTimer = setInterval(() => {
-        if (!eventSource) return;
-        if (Date.now() - lastSseEventAt > SSE_STALE_MS) {
-          console.warn('SSE stale, reconnecting');
-          eventSource.close();
-          eventSource = null;
-          setTimeout(setupRealtime, 500);
-        }
-      }, 2000);
-    }
+  if (sent && snap.rxUs) metricsRecordLatency(LAT_WS, micros() - snap.rxUs);
+}
 
-    function setupRealtime() {
-      if (fallbackTimer) {
-        clearInterval(fallbackTimer);
-        fallbackTimer = null;
-      }
-      if (!window.EventSource) {
-        startPollingFallback();
-        return;
-      }
+uint8_t wsClientCount() {
+  uint8_t n = 0;
+  wsLock();
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (wsClients[i].id) n++;
+  }
+  wsUnlock();
+  return n;
+}
 
-      if (eventSource) {
-        eventSource.close();
-      }
-      lastSseEventAt = Date.now();
-      startSseWatchdog();
-      eventSource = new EventSource('/events');
-      eventSource.onopen = () => {
-        statusEl.className = 'connected';
-        lastSseEventAt = Date.now();
-      };
-      eventSource.onmessage = (event) => {
-        try {
-          const payload = JSON.parse(event.data);
-          statusEl.className = 'connected';
-          lastSseEventAt = Date.now();
-          updateRadar(payload);
-        } catch (e) {
-          console.error('SSE parse error', e);
-        }
-      };
-      eventSource.onerror = (err) => {
-        console.warn('SSE error, fallback to polling', err);
-        statusEl.className = 'disconnected';
-        if (eventSource) {
-          eventSource.close();
-          eventSource = null;
-        }
-        startPollingFallback();
-      };
-    }
+size_t wsStatsJson(char* buf, size_t size) {
+  unsigned long now = millis();
+  JsonWriter w(buf, size);
+  w.beginObject();
+  w.field("max", WS_MAX_CLIENTS);
+  w.field("rejected", (unsigned long)wsRejected);
+  w.beginArray("clients");
+  wsLock();
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    const WSClient& c = wsClients[i];
+    if (!c.id) continue;
+    w.beginObject();
+    w.field("ip", c.ip);
+    w.field("ageS", (now - c.connectedAt) / 1000);
+    w.field("rateHz", (unsigned int)c.rateHz);
+    w.field("frames", (unsigned long)c.frames);
+    w.field("dropped", (unsigned long)c.dropped);
+    w.field("bytes", (unsigned long)c.bytes);
+    w.endObject();
+  }
+  wsUnlock();
+  w.endArray();
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
 
-    function drawRadar() {
-      const styles = getComputedStyle(document.body);
-      const gridColor = varFallback(styles.getPropertyValue('--canvas-grid-color'), '#2a3a4a');
-      const arcColor = varFallback(styles.getPropertyValue('--canvas-arc-color'), '#3a4a5a');
-      const labelColor = varFallback(styles.getPropertyValue('--canvas-label-color'), '#6a7a8a');
-
-      ctx.fillStyle = varFallback(styles.getPropertyValue('--canvas-fill'), '#1a1a2a');
-      ctx.clearRect(0, 0, canvasWidth, canvasHeight);
-      ctx.fillRect(0, 0, canvasWidth, canvasHeight);
-
-      const maxRadius = MAX_RANGE * pixelsPerMeter;
-      const configuredRadius = configuredRange * pixelsPerMeter;
-      const thinLineWidth = Math.max(1, uiScale);
-      const highlightLineWidth = Math.max(1.5, 3 * uiScale);
-      const labelFontSize = Math.max(10, Math.min(18, 12 * uiScale));
-      const labelOffset = 25 * uiScale;
-
-      // Radial lines (nach Süden: Halbkreis nach unten, -90° bis +90°)
-      ctx.strokeStyle = gridColor;
-      ctx.lineWidth = thinLineWidth;
-      for(let angle = -90; angle <= 90; angle += 15) {
-        const rad = (angle + 90) * Math.PI / 180;
-        const x = centerX + Math.cos(rad) * maxRadius;
-        const y = centerY + Math.sin(rad) * maxRadius;
-        ctx.beginPath();
-        ctx.moveTo(centerX, centerY);
-        ctx.lineTo(x, y);
-        ctx.stroke();
-      }
+static bool etagMatches(AsyncWebServerRequest* request, const char* etag) {
+  if (!request->hasHeader("If-None-Match")) return false;
+  const AsyncWebHeader* inm = request->getHeader("If-None-Match");
+  return inm && inm->value() == etag;
+}
 
-      // Concentric arcs für alle 15 Meter
-      ctx.strokeStyle = arcColor;
-      ctx.lineWidth = thinLineWidth;
-      for(let m = 1; m <= MAX_RANGE; m++) {
-        const r = m * pixelsPerMeter;
-        ctx.beginPath();
-        ctx.arc(centerX, centerY, r, 0, Math.PI, false);
-        ctx.stroke();
-      }
+// Dashboard-Dateien aus DashboardAssets.h (host/gen_dashboard.py): immer
+// gzip, ETag = Inhalts-Hash. CSS/JS sind per ?v=<hash> versioniert und
+// dürfen ein Jahr im Cache bleiben, index.html wird jedes Mal revalidiert.
+static void serveAsset(AsyncWebServerRequest* request, uint8_t idx) {
+  const DashboardAsset& asset = DASHBOARD_ASSETS[idx];
+  AssetStats& stats = assetStats[idx];
+  const char* cacheControl = asset.immutable ? "public, max-age=31536000, immutable" : "no-cache";
+
+  if (etagMatches(request, asset.etag)) {
+    stats.notModified++;
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+    return;
+  }
 
-      // Range labels für alle Meter
-      ctx.fillStyle = labelColor;
-      ctx.font = labelFontSize.toFixed(1) + 'px monospace';
-      ctx.textAlign = 'center';
-      for(let m = 1; m <= MAX_RANGE; m++) {
-        const y = centerY + m * pixelsPerMeter;
-        ctx.fillText(m + 'm', centerX + labelOffset, y + labelFontSize * 0.3);
-      }
+  uint32_t startUs = micros();
+  AsyncWebServerResponse* response = request->beginResponse(asset.contentType, asset.gzSize,
+    [idx, startUs](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      const DashboardAsset& a = DASHBOARD_ASSETS[idx];
+      if (index >= a.gzSize) return 0;
+      size_t n = a.gzSize - index < maxLen ? a.gzSize - index : maxLen;
+      memcpy_P(buf, a.gz + index, n);
+      if (index + n >= a.gzSize) {
+        AssetStats& st = assetStats[idx];
+        st.lastUs = micros() - startUs;
+        if (st.lastUs > st.maxUs) st.maxUs = st.lastUs;
+      }
+      return n;
+    });
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", cacheControl);
+  request->send(response);
+  stats.served++;
+}
 
-      // Gesamte Detection area (15m) - dezent
-      const gradientMax = ctx.createRadialGradient(centerX, centerY, 0, centerX, centerY, maxRadius);
-      gradientMax.addColorStop(0, 'rgba(70, 130, 180, 0.05)');
-      gradientMax.addColorStop(1, 'rgba(70, 130, 180, 0.02)');
-      ctx.fillStyle = gradientMax;
-      ctx.beginPath();
-      ctx.arc(centerX, centerY, maxRadius, 0, Math.PI, false);
-      ctx.lineTo(centerX, centerY);
-      ctx.closePath();
-      ctx.fill();
-
-      // Konfigurierte Reichweite - FARBIG hervorgehoben
-      const gradientConfigured = ctx.createRadialGradient(centerX, centerY, 0, centerX, centerY, configuredRadius);
-      gradientConfigured.addColorStop(0, 'rgba(52, 199, 89, 0.25)');
-      gradientConfigured.addColorStop(1, 'rgba(52, 199, 89, 0.1)');
-      ctx.fillStyle = gradientConfigured;
-      ctx.beginPath();
-      ctx.arc(centerX, centerY, configuredRadius, 0, Math.PI, false);
-      ctx.lineTo(centerX, centerY);
-      ctx.closePath();
-      ctx.fill();
-
-      // Markierung der konfigurierten Reichweite mit farbigem Bogen
-      ctx.strokeStyle = '#34c759';
-      ctx.lineWidth = highlightLineWidth;
-      ctx.beginPath();
-      ctx.arc(centerX, centerY, configuredRadius, 0, Math.PI, false);
-      ctx.stroke();
-
-      // Sensor position (oben/Norden)
-      const sensorRadius = Math.max(4, 8 * uiScale);
-      ctx.fillStyle = '#ff4444';
-      ctx.beginPath();
-      ctx.arc(centerX, centerY, sensorRadius, 0, Math.PI * 2);
-      ctx.fill();
-      ctx.strokeStyle = '#fff';
-      ctx.lineWidth = Math.max(1, 2 * uiScale);
-      ctx.stroke();
-    }
+size_t dashboardAssetsJson(char* buf, size_t size) {
+  JsonWriter w(buf, size);
+  w.beginObject();
+  w.field("raw", (unsigned long)DASHBOARD_RAW_SIZE);
+  w.field("gz", (unsigned long)DASHBOARD_GZ_SIZE);
+  w.beginArray("assets");
+  for (uint8_t i = 0; i < DASHBOARD_ASSET_COUNT; i++) {
+    const DashboardAsset& a = DASHBOARD_ASSETS[i];
+    const AssetStats& st = assetStats[i];
+    w.beginObject();
+    w.field("path", a.path);
+    w.field("raw", (unsigned long)a.rawSize);
+    w.field("gz", (unsigned long)a.gzSize);
+    w.field("served", (unsigned long)st.served);
+    w.field("notModified", (unsigned long)st.notModified);
+    w.field("lastUs", (unsigned long)st.lastUs);
+    w.field("maxUs", (unsigned long)st.maxUs);
+    w.endObject();
+  }
+  w.endArray();
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
 
-    function updateRadar(data) {
-      if (typeof data.range_m === 'number') {
-        configuredRange = data.range_m;
-      }
-      lastRadarPayload = data;
-      drawRadar();
-
-      // ESP Info aktualisieren
-      document.getElementById('fwVersion').textContent = data.fwVersion || '-';
-      document.getElementById('resetReason').textContent = formatResetReason(data.resetReason);
-      const temp = data.temp_c;
-      document.getElementById('temperature').textContent = (typeof temp === 'number' ? temp.toFixed(1) + ' °C' : '-');
-      document.getElementById('radarSerialRestarts').textContent = (data.radarSerialRestarts !== undefined ? data.radarSerialRestarts : 0);
-      document.getElementById('ip').textContent = data.ip || '-';
-      document.getElementById('bssid').textContent = data.bssid || '-';
-      document.getElementById('apName').textContent = data.apName || '-';
-      document.getElementById('targetCount').textContent = data.targetCount || 0;
-      document.getElementById('maxRange').textContent = (configuredRange || 0).toFixed(1) + 'm';
-      document.getElementById('uptime').textContent = formatUptimeLabel(data.uptime_min, data.uptime);
-      document.getElementById('rssi').textContent = (data.rssi || 0) + ' dBm';
-      document.getElementById('heap').textContent = Math.round((data.heap_free || 0) / 1024) + ' KB';
-      document.getElementById('holdMs').textContent = (data.holdMs || 500) + 'ms';
-
-      configuredRange = data.range_m || 5;
-
-      // Warnungen anzeigen
-      const warningList = document.getElementById('warningList');
-      if(data.warnings && data.warnings.length > 0) {
-        warningList.innerHTML = data.warnings.map(w => '<div class="warning-item">⚠️ ' + w + '</div>').join('');
-      } else {
-        warningList.innerHTML = '<div style="color: var(--muted-text); font-size: 13px;">Keine Warnungen</div>';
-      }
+// ETag = Boot + Cache-Version: Poller mit If-None-Match bekommen ein
+// leeres 304, solange sich weder Targets noch Status geändert haben
+static void handleRadarAPI(AsyncWebServerRequest* request) {
+  char etag[24];
+  snapshotCacheETag(snapshotCacheVersion(), etag, sizeof(etag));
+  if (etagMatches(request, etag)) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    response->addHeader("Access-Control-Allow-Origin", "*");
+    request->send(response);
+    return;
+  }
 
-      const logList = document.getElementById('logList');
-      if (data.serialLogs && data.serialLogs.length > 0) {
-        logList.innerHTML = data.serialLogs.map(l => '<div class="log-item">' + escapeHtml(l) + '</div>').join('');
-      } else {
-        logList.innerHTML = '<div style="color: var(--muted-text); font-size: 12px;">Keine Logs</div>';
-      }
+  uint32_t atVersion;
+  size_t len = snapshotCacheCopy(SNAPSHOT_DASHBOARD, apiBuffer, sizeof(apiBuffer), &atVersion);
+  if (!len) {
+    request->send(500, "text/plain", "radar JSON overflow");
+    return;
+  }
+  snapshotCacheETag(atVersion, etag, sizeof(etag));
+  AsyncResponseStream* response = request->beginResponseStream("application/json", len);
+  response->write(reinterpret_cast<const uint8_t*>(apiBuffer), len);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
 
-      // Targets zeichnen und Boxen aktualisieren
-      for(let i = 1; i <= 3; i++) {
-        const t = data['target' + i];
-        const targetData = document.getElementById('target' + i + '-data');
-
-        if(!t || !t.presence) {
-          targetData.innerHTML = '<div style="color: var(--muted-text); text-align: center; padding: 20px;">No target detected</div>';
-          continue;
-        }
-
-        const rawX = typeof t.x === 'number' ? t.x : 0;
-        const rawY = typeof t.y === 'number' ? t.y : 0;
-        const rawAngle = typeof t.angleDeg === 'number' ? t.angleDeg : 0;
-        const xMeters = (invertXAxis ? -rawX : rawX) / 1000.0;
-        const yMeters = rawY / 1000.0;
-        const displayAngle = invertXAxis ? -rawAngle : rawAngle;
-        const displayDistance = typeof t.distance === 'number' ? t.distance / 1000.0 : (typeof t.distRaw === 'number' ? t.distRaw / 1000.0 : 0);
-        const displaySpeed = typeof t.speed === 'number' ? t.speed : 0;
-
-        // Target Box aktualisieren
-        targetData.innerHTML = `
-          <div><strong>Distance:</strong> ${displayDistance.toFixed(2)}m</div>
-          <div><strong>Angle:</strong> ${displayAngle.toFixed(0)}°</div>
-          <div><strong>X:</strong> ${xMeters.toFixed(2)}m</div>
-          <div><strong>Y:</strong> ${yMeters.toFixed(2)}m</div>
-          <div><strong>Speed:</strong> ${displaySpeed}</div>
-        `;
-
-        // 180° gedreht: Y jetzt nach unten positiv
-        const screenX = centerX + xMeters * pixelsPerMeter;
-        const screenY = centerY + yMeters * pixelsPerMeter;
-
-        // Target glow
-        const glowRadius = Math.max(10, 15 * uiScale);
-        const coreRadius = Math.max(3, 5 * uiScale);
-        const labelFontSize = Math.max(11, Math.min(22, 12 * uiScale));
-        const labelOffsetY = 20 * uiScale;
-        const outlineWidth = Math.max(2, 3 * uiScale);
-        const gradient = ctx.createRadialGradient(screenX, screenY, 0, screenX, screenY, glowRadius);
-        gradient.addColorStop(0, 'rgba(255, 100, 100, 0.8)');
-        gradient.addColorStop(1, 'rgba(255, 100, 100, 0)');
-        ctx.fillStyle = gradient;
-        ctx.beginPath();
-        ctx.arc(screenX, screenY, glowRadius, 0, Math.PI * 2);
-        ctx.fill();
-
-        // Target core
-        ctx.fillStyle = '#ff6464';
-        ctx.beginPath();
-        ctx.arc(screenX, screenY, coreRadius, 0, Math.PI * 2);
-        ctx.fill();
-
-        // Label
-        ctx.fillStyle = '#fff';
-        ctx.font = 'bold ' + labelFontSize.toFixed(1) + 'px monospace';
-        ctx.textAlign = 'center';
-        ctx.strokeStyle = '#000';
-        ctx.lineWidth = outlineWidth;
-        ctx.strokeText('T' + i, screenX, screenY - labelOffsetY);
-        ctx.fillText('T' + i, screenX, screenY - labelOffsetY);
-      }
-    }
+static void handleMetricsAPI(AsyncWebServerRequest* request) {
+  static char profile[LOOP_PROFILER_JSON_SIZE];
+  static char latency[METRICS_JSON_SIZE];
+  static char sse[SSE_STATS_JSON_SIZE];
+  static char assets[DASHBOARD_STATS_JSON_SIZE];
+  static char ws[WS_STATS_JSON_SIZE];
+  if (!loopProfilerCopy(profile, sizeof(profile))) strcpy(profile, "{}");
+  if (!metricsLatencyJson(latency, sizeof(latency))) strcpy(latency, "{}");
+  if (!sseStatsJson(sse, sizeof(sse))) strcpy(sse, "{}");
+  if (!dashboardAssetsJson(assets, sizeof(assets))) strcpy(assets, "{}");
+  if (!wsStatsJson(ws, sizeof(ws))) strcpy(ws, "{}");
+
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  response->printf("{\"unit\":\"us\",\"loop\":%s,\"latency\":%s,\"sse\":%s,\"ws\":%s,\"dashboard\":%s}",
+                   profile, latency, sse, ws, assets);
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
 
-    initTheme();
-    initInvertToggle();
-    const initialCanvasReady = resizeCanvas();
-    if (initialCanvasReady) {
-      redrawRadar();
-    }
-    setupRealtime();
+static void finishExport() {
+  if (!exportActive) return;
+  radarRecorderExportEnd();
+  exportActive = false;
+}
 
-    if (!initialCanvasReady) {
-      scheduleCanvasRefresh();
-    }
+// Gestreamt: die Bibliothek fragt Stück für Stück nach, sobald TCP Platz hat
+static void handleRecording(AsyncWebServerRequest* request) {
+  if (exportActive || importRequest) {
+    request->send(409, "text/plain", "Export läuft bereits");
+    return;
+  }
+  size_t total = radarRecorderExportBegin();
+  exportActive = true;
+
+  AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", total,
+    [total](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      size_t n = radarRecorderExportRead(index, buf, maxLen);
+      if (index + n >= total) finishExport();
+      return n;
+    });
+  char disposition[64];
+  snprintf(disposition, sizeof(disposition), "attachment; filename=\"%s.rdr\"", g_host.c_str());
+  response->addHeader("Content-Disposition", disposition);
+  request->onDisconnect(finishExport);   // Abbruch mittendrin
+  request->send(response);
+}
 
-    window.addEventListener('resize', () => {
-      scheduleCanvasRefresh();
+// Upload einer .rdr-Datei (Body roh, wie GET /api/recording sie liefert) in
+// den Recorder-Ring; abgespielt wird danach mit replay:on. Die Chunks kommen
+// in Reihenfolge im async_tcp-Task, parallele Uploads werden abgewiesen.
+static void handleRecordingBody(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                                size_t index, size_t total) {
+  if (index == 0) {
+    if (importRequest || exportActive || !radarRecorderImportBegin()) return;
+    importRequest = request;
+    importFailed = false;
+    request->onDisconnect([request]() {
+      if (importRequest != request) return;
+      if (!importFailed) radarRecorderImportEnd(false);   // Abbruch mittendrin
+      importRequest = nullptr;
     });
-  </script>
-</body>
-</html>
-)rawliteral";
-
-static size_t buildRadarJson(char* buffer, size_t bufsize) {
-  StaticJsonDocument<JSON_BUFFER_SIZE> doc;
-
-  doc["targetCount"] = 0;
-  for (auto &t: smoothed) if (t.presence) doc["targetCount"] = doc["targetCount"].as<int>() + 1;
-
-  doc["fwVersion"] = FW_VERSION;
-  doc["resetReason"] = resetReasonToString(esp_reset_reason());
-  doc["temp_c"] = temperatureRead();
-  doc["radarSerialRestarts"] = radarSerialRestartCount;
-  doc["range_m"] = g_maxRangeMeters;
-  doc["uptime_min"] = millis() / 60000;
-  char uptimeStr[8];
-  formatUptime(uptimeStr, sizeof(uptimeStr));
-  doc["uptime"] = uptimeStr;
-  doc["rssi"] = WiFi.RSSI();
-  doc["ip"] = WiFi.localIP().toString();
-  doc["heap_free"] = ESP.getFreeHeap();
-  doc["holdMs"] = g_holdIntervalMs;
-  char bssidBuf[18];
-  bssidBuf[0] = '\0';
-  uint8_t bssidBytes[6] = {0};
-  bool haveBssidBytes = false;
-  if (WiFi.status() == WL_CONNECTED && WiFi.BSSID() != nullptr) {
-    memcpy(bssidBytes, WiFi.BSSID(), sizeof(bssidBytes));
-    haveBssidBytes = true;
-    snprintf(bssidBuf, sizeof(bssidBuf), "%02X:%02X:%02X:%02X:%02X:%02X",
-             bssidBytes[0], bssidBytes[1], bssidBytes[2],
-             bssidBytes[3], bssidBytes[4], bssidBytes[5]);
-    strncpy(g_lastBssid, bssidBuf, sizeof(g_lastBssid) - 1);
-    g_lastBssid[sizeof(g_lastBssid) - 1] = '\0';
-  } else if (g_lastBssid[0] != '\0') {
-    strncpy(bssidBuf, g_lastBssid, sizeof(bssidBuf) - 1);
-    bssidBuf[sizeof(bssidBuf) - 1] = '\0';
-    if (parseBssidString(bssidBuf, bssidBytes)) {
-      haveBssidBytes = true;
-    }
   }
-  doc["bssid"] = (bssidBuf[0] != '\0') ? bssidBuf : "-";
-  const char* apName = "-";
-  if (haveBssidBytes) {
-    const uint8_t apFlur[6]       = {0xAE,0x42,0xA1,0x5F,0x78,0x98};
-    const uint8_t apWohnzimmer[6] = {0xAE,0x42,0xA1,0x5F,0x78,0xAE};
-    const uint8_t apKueche[6]     = {0xAE,0x42,0xA1,0x5F,0x78,0xCE};
-    if (bssidEquals(bssidBytes, apFlur)) {
-      apName = "AP-Flur";
-    } else if (bssidEquals(bssidBytes, apWohnzimmer)) {
-      apName = "AP-Wohnzimmer";
-    } else if (bssidEquals(bssidBytes, apKueche)) {
-      apName = "AP-Kueche";
-    }
+  if (importRequest != request || importFailed) return;
+  if (!radarRecorderImportWrite(index, data, len)) {
+    radarRecorderImportEnd(false);
+    importFailed = true;
   }
-  doc["apName"] = apName;
+}
 
-  JsonArray warnings = doc.createNestedArray("warnings");
-  if (WiFi.RSSI() < -80) {
-    warnings.add("Schwaches WiFi-Signal");
-  }
-  if (ESP.getFreeHeap() < 10000) {
-    warnings.add("Wenig freier Heap");
-  }
-  if (radarTimeoutCount > 0) {
-    warnings.add("Radar-Timeouts erkannt");
+static void handleRecordingUpload(AsyncWebServerRequest* request) {
+  if (importRequest != request) {
+    request->send(409, "text/plain", "Upload abgelehnt: Aufnahme, Replay, Export oder Upload aktiv");
+    return;
   }
-  if (millis() - lastRadarDataTime > NO_DATA_TIMEOUT) {
-    warnings.add("Keine Radar-Daten");
+  uint32_t loaded = importFailed ? 0 : radarRecorderImportEnd(true);
+  importRequest = nullptr;
+  if (!loaded) {
+    request->send(400, "text/plain", "Ungültige oder unvollständige .rdr-Datei");
+    return;
   }
+  char msg[64];
+  snprintf(msg, sizeof(msg), "%u Frames geladen, replay:on spielt sie ab", (unsigned)loaded);
+  request->send(200, "text/plain", msg);
+}
 
-  JsonArray serialLogs = doc.createNestedArray("serialLogs");
-  uint8_t logCount = getSerialLogCount();
-  for (uint8_t i = 0; i < logCount; i++) {
-    char line[SERIAL_LOG_LINE_LEN];
-    getSerialLogLine(i, line, sizeof(line));
-    if (line[0] != '\0') {
-      serialLogs.add(line);
-    }
+// Belegungsverlauf binär (RadarHistory.h), gestreamt direkt aus den Ringen.
+//   from  Uptime-Sekunde, negativ = relativ zu jetzt (from=-3600: letzte Stunde)
+//   res   1, 60 oder 600 Sekunden
+// X-Zones nennt die Zonen zu den Bits (Slot-Reihenfolge, leer = frei).
+static void handleHistory(AsyncWebServerRequest* request) {
+  RadarHistoryRes res = RADAR_HISTORY_1S;
+  if (request->hasArg("res") &&
+      !radarHistoryResFromSeconds(strtoul(request->arg("res").c_str(), nullptr, 10), res)) {
+    request->send(400, "text/plain", "res: 1, 60 oder 600");
+    return;
   }
-
-  for (int i = 0; i < 3; i++) {
-    char key[12];
-    snprintf(key, sizeof(key), "target%d", i + 1);
-    auto t = doc.createNestedObject(key);
-
-    if (!smoothed[i].presence) {
-      t["presence"] = false;
-    } else {
-      t["presence"] = true;
-      t["x"] = round(smoothed[i].x);
-      t["y"] = round(smoothed[i].y);
-      t["speed"] = round(smoothed[i].speed);
-      t["distance"] = round(smoothed[i].distanceXY);
-      t["angleDeg"] = round(smoothed[i].angleDeg);
-    }
+  long from = request->hasArg("from") ? strtol(request->arg("from").c_str(), nullptr, 10) : 0;
+  if (from < 0) {
+    long now = (long)radarHistoryNowSec();
+    from = now + from > 0 ? now + from : 0;
   }
 
-  return serializeJson(doc, buffer, bufsize);
-}
+  RadarHistoryRange range;
+  size_t total = radarHistoryExportBegin(res, (uint32_t)from, range);
+  AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", total,
+    [range](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      return radarHistoryExportRead(range, index, buf, maxLen);
+    });
 
-void handleSSE() {
-  SSEClient& slot = sseClients[0];
-  if (slot.active) {
-    slot.client.stop();
-    slot.active = false;
+  RadarZoneState zones[RADAR_ZONE_MAX];
+  radarZonesSnapshot(zones);
+  char names[RADAR_ZONE_MAX * RADAR_ZONE_NAME_LEN];
+  size_t n = 0;
+  for (uint8_t z = 0; z < RADAR_ZONE_MAX; z++) {
+    n += snprintf(names + n, sizeof(names) - n, "%s%s", z ? "," : "", zones[z].defined ? zones[z].name : "");
   }
+  response->addHeader("X-Zones", names);
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
 
-  WiFiClient client = webServer.client();
-  if (!client.connected()) {
+// Befehle ändern Loop-Zustand: nur einreihen, handleWebServer() führt sie aus.
+// Das Ergebnis kommt wie bei MQTT über das ack-Topic.
+static void handleCommand(AsyncWebServerRequest* request) {
+  if (!request->hasArg("cmd")) {
+    request->send(400, "text/plain", "ERROR: Kein Befehl angegeben");
     return;
   }
 
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/event-stream");
-  client.println("Cache-Control: no-cache");
-  client.println("Connection: keep-alive");
-  client.println();
-  client.flush();
-
-  slot.client = client;
-  slot.lastPing = millis();
-  slot.active = true;
-  lastSseBroadcast = 0;
-
-  char buffer[JSON_BUFFER_SIZE];
-  size_t len = buildRadarJson(buffer, sizeof(buffer));
-  slot.client.print("data: ");
-  slot.client.write(buffer, len);
-  slot.client.print("\n\n");
-  slot.client.flush();
-  lastSseBroadcast = slot.lastPing;
-}
-
-void broadcastRadarSSE() {
-  SSEClient& slot = sseClients[0];
-  if (!slot.active) return;
-  if (!slot.client.connected()) {
-    slot.client.stop();
-    slot.active = false;
+  const String& cmd = request->arg("cmd");
+  WebCommand entry;
+  if (cmd.length() >= sizeof(entry.text)) {
+    request->send(413, "text/plain", "ERROR: Befehl zu lang");
     return;
   }
-
-  unsigned long now = millis();
-  if (now - lastSseBroadcast < 500) return;
-
-  char buffer[JSON_BUFFER_SIZE];
-  size_t len = buildRadarJson(buffer, sizeof(buffer));
-
-  slot.client.print("data: ");
-  slot.client.write(buffer, len);
-  slot.client.print("\n\n");
-  slot.client.flush();
-
-  slot.lastPing = now;
-  lastSseBroadcast = now;
-}
-
-void handleRoot() {
-  webServer.send_P(200, "text/html", INDEX_HTML);
-}
-
-void handleRadarAPI() {
-  char buffer[JSON_BUFFER_SIZE];
-  buildRadarJson(buffer, sizeof(buffer));
-  webServer.sendHeader("Access-Control-Allow-Origin", "*");
-  webServer.send(200, "application/json", buffer);
-}
-
-void handleCommand() {
-  if (!webServer.hasArg("cmd")) {
-    webServer.send(400, "text/plain", "ERROR: Kein Befehl angegeben");
+  strcpy(entry.text, cmd.c_str());
+  if (!webCmdQueue || xQueueSend(webCmdQueue, &entry, 0) != pdTRUE) {
+    request->send(503, "text/plain", "ERROR: Befehlswarteschlange voll");
     return;
   }
-
-  String cmd = webServer.arg("cmd");
-  processMqttCommand(cmd);
-
-  webServer.send(200, "text/plain", "OK: Befehl '" + cmd + "' wurde ausgeführt");
+  request->send(200, "text/plain", "OK: Befehl '" + cmd + "' eingereiht");
 }
 
 void setupWebServer() {
   if (!serverConfigured) {
-    webServer.on("/", handleRoot);
-    webServer.on("/api/radar", handleRadarAPI);
-    webServer.on("/events", handleSSE);
-    webServer.on("/api/cmd", handleCommand);
+    sseMutex = xSemaphoreCreateRecursiveMutex();
+    wsMutex = xSemaphoreCreateMutex();
+    webCmdQueue = xQueueCreate(WEB_CMD_QUEUE_LEN, sizeof(WebCommand));
+    sseEvents.onConnect(onSseConnect);
+    sseEvents.onDisconnect(onSseDisconnect);
+    webServer.addHandler(&sseEvents);
+    wsRadar.onEvent(onWsEvent);
+    webServer.addHandler(&wsRadar);
+    for (uint8_t i = 0; i < DASHBOARD_ASSET_COUNT; i++) {
+      webServer.on(DASHBOARD_ASSETS[i].path, HTTP_GET, [i](AsyncWebServerRequest* request) { serveAsset(request, i); });
+    }
+    webServer.on("/api/radar", HTTP_GET, handleRadarAPI);
+    webServer.on("/api/metrics", HTTP_GET, handleMetricsAPI);
+    webServer.on("/api/cmd", HTTP_ANY, handleCommand);
+    webServer.on("/api/recording", HTTP_GET, handleRecording);
+    webServer.on("/api/recording", HTTP_POST, handleRecordingUpload, nullptr, handleRecordingBody);
+    webServer.on("/api/history", HTTP_GET, handleHistory);
     serverConfigured = true;
   }
 
@@ -1335,21 +707,22 @@ void setupWebServer() {
 
 void stopWebServer() {
   if (!serverRunning) return;
-  for (int i = 0; i < MAX_SSE_CLIENTS; i++) {
-    if (sseClients[i].client.connected()) {
-      sseClients[i].client.stop();
-    }
-    sseClients[i].active = false;
-  }
-  webServer.stop();
+  sseEvents.close();
+  wsRadar.closeAll();
+  webServer.end();
   serverRunning = false;
   logPrintln("WebServer stopped");
 }
 
+// Loop: eingereihte Befehle ausführen, SSE- und /ws-Fan-out. HTTP selbst läuft im async_tcp-Task.
 void handleWebServer() {
   if (!serverRunning) return;
-  webServer.handleClient();
+  WebCommand entry;
+  while (webCmdQueue && xQueueReceive(webCmdQueue, &entry, 0) == pdTRUE) {
+    processMqttCommand(String(entry.text));
+  }
   broadcastRadarSSE();
+  broadcastRadarWS();
 }
 
 bool isWebServerRunning() {
@@ -2,12 +2,15 @@
 
 #pragma once
 
-#include <WebServer.h>
+#include <Arduino.h>
 
 void setupWebServer();
 void handleWebServer();
 void stopWebServer();
 bool isWebServerRunning();
 void sendRadarData();
-
-extern WebServer webServer;
+uint8_t sseClientCount();
+uint8_t wsClientCount();
+size_t sseStatsJson(char* buf, size_t size);          // /api/metrics "sse"
+size_t dashboardAssetsJson(char* buf, size_t size);   // /api/metrics "dashboard"
+size_t wsStatsJson(char* buf, size_t size);           // /api/metrics "ws"
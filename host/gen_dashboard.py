@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# File: host/gen_dashboard.py
+#
+# Baut aus web/ (index.html, dashboard.css, dashboard.js) den Header
+# DashboardAssets.h: gzip-komprimierte PROGMEM-Arrays plus Tabelle mit
+# Pfad, Content-Type, ETag (Hash des Rohinhalts) und Größen.
+#
+# CSS und JS werden in index.html als /dashboard.css?v=<hash> referenziert
+# und dürfen daher unbegrenzt gecacht werden; index.html selbst wird per
+# ETag revalidiert.
+#
+#   python3 host/gen_dashboard.py            # DashboardAssets.h neu schreiben
+#   python3 host/gen_dashboard.py --check    # Exit 1, wenn der Header veraltet ist
+#
+# Nach jeder Änderung in web/ ausführen und den Header mit einchecken
+# (die Arduino-IDE kennt keinen Pre-Build-Schritt). Der Host-Build prüft
+# mit --check, dass beides zusammenpasst.
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+WEB = os.path.join(ROOT, "web")
+OUT = os.path.join(ROOT, "DashboardAssets.h")
+
+# (Datei, URL, Content-Type, Symbol, immutable)
+ASSETS = [
+    ("dashboard.css", "/dashboard.css", "text/css", "DASHBOARD_CSS_GZ", True),
+    ("dashboard.js", "/dashboard.js", "application/javascript", "DASHBOARD_JS_GZ", True),
+    ("index.html", "/", "text/html; charset=utf-8", "DASHBOARD_INDEX_GZ", False),
+]
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def c_array(symbol, data):
+    lines = ["static const uint8_t %s[] PROGMEM = {" % symbol]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def build():
+    raw = {}
+    for name, *_ in ASSETS:
+        with open(os.path.join(WEB, name), "rb") as f:
+            raw[name] = f.read()
+
+    # Versionierte Referenzen in index.html: neuer Inhalt → neue URL
+    index = raw["index.html"].decode("utf-8")
+    for name, url, _, _, immutable in ASSETS:
+        if immutable:
+            index = index.replace('"%s"' % url, '"%s?v=%s"' % (url, content_hash(raw[name])[:8]))
+    raw["index.html"] = index.encode("utf-8")
+
+    arrays, table = [], []
+    total_raw = total_gz = 0
+    for name, url, ctype, symbol, immutable in ASSETS:
+        data = raw[name]
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        total_raw += len(data)
+        total_gz += len(gz)
+        arrays.append("// %s: %d B roh, %d B gzip\n%s" % (name, len(data), len(gz), c_array(symbol, gz)))
+        table.append('  { "%s", "%s", "\\"%s\\"", %s, sizeof(%s), %d, %s },'
+                     % (url, ctype, content_hash(data), symbol, symbol, len(data),
+                        "true" if immutable else "false"))
+
+    return "\n".join([
+        "// File: DashboardAssets.h",
+        "// Generiert von host/gen_dashboard.py aus web/ – nicht von Hand ändern.",
+        "",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "struct DashboardAsset {",
+        "  const char*    path;",
+        "  const char*    contentType;",
+        "  const char*    etag;        // Hash des Rohinhalts, inkl. Anführungszeichen",
+        "  const uint8_t* gz;",
+        "  uint32_t       gzSize;",
+        "  uint32_t       rawSize;",
+        "  bool           immutable;   // über ?v=<hash> referenziert, lange cachebar",
+        "};",
+        "",
+        "#define DASHBOARD_RAW_SIZE %d" % total_raw,
+        "#define DASHBOARD_GZ_SIZE  %d" % total_gz,
+        "",
+        "\n\n".join(arrays),
+        "",
+        "static const DashboardAsset DASHBOARD_ASSETS[] = {",
+        "\n".join(table),
+        "};",
+        "static const uint8_t DASHBOARD_ASSET_COUNT = sizeof(DASHBOARD_ASSETS) / sizeof(DASHBOARD_ASSETS[0]);",
+        "",
+    ])
+
+
+def main():
+    ap = argparse.ArgumentParser(description="gzip web/ into DashboardAssets.h")
+    ap.add_argument("--check", action="store_true", help="fail if DashboardAssets.h is out of date")
+    args = ap.parse_args()
+
+    header = build()
+    if args.check:
+        try:
+            with open(OUT, encoding="utf-8") as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != header:
+            print("DashboardAssets.h ist veraltet: python3 host/gen_dashboard.py ausführen", file=sys.stderr)
+            return 1
+        return 0
+
+    with open(OUT, "w", encoding="utf-8") as f:
+        f.write(header)
+    print("DashboardAssets.h geschrieben")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,251 @@
+// File: host/json_bench.cpp
+// Vergleicht die Radar-JSON-Erzeugung über JsonWriter (direkt in den
+// Ausgabepuffer) mit dem früheren ArduinoJson-Pfad (StaticJsonDocument +
+// serializeJson): CPU-Zeit pro Payload und Spitzen-Stack pro Aufruf.
+//
+// Zwei Payloads: "targets" ist <topic> (radarTargetsJson aus der Firmware),
+// "dashboard" bildet SNAPSHOT_DASHBOARD (SnapshotCache) mit festen Werten
+// und vollem Serial-Log nach (die Firmware-Funktion hängt an WiFi/ESP).
+//
+// ArduinoJson holt CMake in der gepinnten v6 (ARDUINOJSON_VERSION), wie
+// sie die Firmware nutzt; StaticJsonDocument gibt es ab v7 nicht mehr.
+//
+//   json_bench [--iterations N] [--print]
+
+#include <Arduino.h>
+#include "Config.h"
+#include "RadarJson.h"
+
+#include <ArduinoJson.h>
+#if ARDUINOJSON_VERSION_MAJOR != 6
+#error "json_bench vergleicht mit ArduinoJson v6 (StaticJsonDocument)"
+#endif
+
+#include <chrono>
+#include <pthread.h>
+
+static RadarSnapshot sampleSnapshot() {
+  RadarSnapshot s{};
+  s.frame = 48211;
+  s.timeMs = 5123007;
+  s.targets[0] = {true, 17, 120, -45, -523, 130, 128, -2058, 34};
+  s.targets[1] = {true, 18, -2310, 3904, 12, 4540, 4536, 12061, 51};
+  s.targets[2] = {true, 21, 1501, 1198, 1830, 1920, 1920, 3860, 40};
+  return s;
+}
+
+static const char* const LOG_LINES[SERIAL_LOG_LINES] = {
+  "WiFi event: GOT_IP 192.168.178.57",
+  "WiFi IP-Info: GW 192.168.178.1, MASK 255.255.255.0, DNS1 192.168.178.1, DNS2 0.0.0.0",
+  "WiFi AP BSSID AE:42:A1:5F:78:AE, CH 6, RSSI -61, AUTH WPA2_PSK",
+  "MQTT connect #1 to 192.168.178.10:1883",
+  "MQTT connected OK id=RD03D-4F2A host=192.168.178.10:1883",
+  "Radar: Konfiguration OK (geschrieben 0, unverändert 2)",
+  "MQTT CMD: setPublish:change",
+  "MQTT CMD: setDeadband:100,5,10",
+  "MQTT CMD: zone:set:desk:-500,1000;500,1000;500,2000;-500,2000",
+  "MQTT CMD: getStatus",
+};
+
+// --- JsonWriter --------------------------------------------------------
+
+static size_t writerTargets(char* buf, size_t size, const RadarSnapshot& snap) {
+  return radarTargetsJson(buf, size, snap);
+}
+
+static size_t writerDashboard(char* buf, size_t size, const RadarSnapshot& snap) {
+  JsonWriter w(buf, size);
+  w.beginObject();
+  w.field("targetCount", radarTargetCount(snap.targets));
+  w.field("fwVersion", FW_VERSION);
+  w.field("resetReason", "software");
+  w.field("temp_c", 45.5f);
+  w.field("radarSerialRestarts", 1U);
+  w.field("range_m", 2.1f);
+  w.field("uptime_min", 85UL);
+  w.field("uptime", "001:25");
+  w.field("rssi", -61);
+  w.field("ip", "192.168.178.57");
+  w.field("heap_free", 234567U);
+  w.field("holdMs", 500U);
+  w.field("mqttLink", "up");
+  w.field("mqttBackoffMs", 0U);
+  w.field("bssid", "AE:42:A1:5F:78:AE");
+  w.field("apName", "AP-Wohnzimmer");
+  w.beginArray("warnings").value("Radar-Timeouts erkannt").endArray();
+  radarJsonTargets(w, snap.targets, false);
+  w.beginArray("serialLogs");
+  for (uint8_t i = 0; i < SERIAL_LOG_LINES; i++) w.value(LOG_LINES[i]);
+  w.endArray();
+  w.endObject();
+  return w.ok() ? w.length() : 0;
+}
+
+// --- ArduinoJson (früherer Firmware-Pfad) ------------------------------
+
+static size_t domTargets(char* buf, size_t size, const RadarSnapshot& snap) {
+  const RadarTarget* targets = snap.targets;
+  StaticJsonDocument<640> doc;
+  int cnt = 0;
+  for (int i = 0; i < 3; i++) if (targets[i].presence) cnt++;
+  doc["targetCount"] = cnt;
+  JsonArray list = doc.createNestedArray("targets");
+  for (int i = 0; i < 3; i++) {
+    if (!targets[i].presence) continue;
+    auto o = list.createNestedObject();
+    o["id"]        = targets[i].id;
+    o["x"]         = targets[i].x;
+    o["y"]         = targets[i].y;
+    o["speed"]     = radarSpeedCmS(targets[i]);
+    o["distRaw"]   = targets[i].distRaw;
+    o["distance"]  = targets[i].distanceXY;
+    o["angleDeg"]  = radarAngleDeg(targets[i]);
+    if (targets[i].sigma) o["sigma"] = targets[i].sigma;
+  }
+  return serializeJson(doc, buf, size);
+}
+
+static size_t domDashboard(char* buf, size_t size, const RadarSnapshot& snap) {
+  const RadarTarget* targets = snap.targets;
+  StaticJsonDocument<JSON_BUFFER_SIZE> doc;
+  doc["targetCount"] = 0;
+  for (int i = 0; i < 3; i++) if (targets[i].presence) doc["targetCount"] = doc["targetCount"].as<int>() + 1;
+  doc["fwVersion"] = FW_VERSION;
+  doc["resetReason"] = "software";
+  doc["temp_c"] = 45.5f;
+  doc["radarSerialRestarts"] = 1U;
+  doc["range_m"] = 2.1f;
+  doc["uptime_min"] = 85UL;
+  doc["uptime"] = "001:25";
+  doc["rssi"] = -61;
+  doc["ip"] = "192.168.178.57";
+  doc["heap_free"] = 234567U;
+  doc["holdMs"] = 500U;
+  doc["mqttLink"] = "up";
+  doc["mqttBackoffMs"] = 0U;
+  doc["bssid"] = "AE:42:A1:5F:78:AE";
+  doc["apName"] = "AP-Wohnzimmer";
+  JsonArray warnings = doc.createNestedArray("warnings");
+  warnings.add("Radar-Timeouts erkannt");
+  JsonArray serialLogs = doc.createNestedArray("serialLogs");
+  // Kopie wie getSerialLogLine(): ArduinoJson dupliziert char*-Werte ins Dokument
+  for (uint8_t i = 0; i < SERIAL_LOG_LINES; i++) {
+    char line[SERIAL_LOG_LINE_LEN];
+    strncpy(line, LOG_LINES[i], sizeof(line) - 1);
+    line[sizeof(line) - 1] = '\0';
+    serialLogs.add(line);
+  }
+  JsonArray list = doc.createNestedArray("targets");
+  for (int i = 0; i < 3; i++) {
+    if (!targets[i].presence) continue;
+    auto t = list.createNestedObject();
+    t["id"] = targets[i].id;
+    t["x"] = targets[i].x;
+    t["y"] = targets[i].y;
+    t["speed"] = radarSpeedCmS(targets[i]);
+    t["distance"] = targets[i].distanceXY;
+    t["angleDeg"] = radarAngleDeg(targets[i]);
+    if (targets[i].sigma) t["sigma"] = targets[i].sigma;
+  }
+  return serializeJson(doc, buf, size);
+}
+
+// --- Messung -----------------------------------------------------------
+
+typedef size_t (*BuildFn)(char* buf, size_t size, const RadarSnapshot& snap);
+
+// Ausgabepuffer liegt auf dem Aufrufer-Stack und zählt mit (die Firmware
+// hält ihn inzwischen statisch im SnapshotCache, der Vergleich bleibt fair)
+template <size_t BUF>
+static size_t callWithStackBuffer(BuildFn fn, const RadarSnapshot& snap) {
+  char buf[BUF];
+  size_t n = fn(buf, sizeof(buf), snap);
+  __asm__ __volatile__("" : : "r"(buf) : "memory");
+  return n;
+}
+
+struct StackProbe {
+  BuildFn              fn;
+  bool                 dashboard;
+  const RadarSnapshot* snap;
+};
+
+static const size_t PROBE_STACK = 256 * 1024;
+static const uint8_t PAINT = 0xA5;
+
+static void* probeThread(void* arg) {
+  StackProbe* p = (StackProbe*)arg;
+  if (!p->fn) return nullptr;
+  if (p->dashboard) callWithStackBuffer<JSON_BUFFER_SIZE>(p->fn, *p->snap);
+  else              callWithStackBuffer<RADAR_TARGETS_JSON_SIZE>(p->fn, *p->snap);
+  return nullptr;
+}
+
+// Eigener Thread mit vorher gefülltem Stack: berührte Bytes = Spitzenbedarf;
+// fn == nullptr misst den Thread-Einstieg, der von allen Werten abgezogen wird
+static size_t measureStack(BuildFn fn, bool dashboard, const RadarSnapshot& snap) {
+  uint8_t* stack = (uint8_t*)aligned_alloc(4096, PROBE_STACK);
+  memset(stack, PAINT, PROBE_STACK);
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstack(&attr, stack, PROBE_STACK);
+  StackProbe probe{fn, dashboard, &snap};
+  pthread_t th;
+  pthread_create(&th, &attr, probeThread, &probe);
+  pthread_join(th, nullptr);
+  pthread_attr_destroy(&attr);
+
+  size_t untouched = 0;
+  while (untouched < PROBE_STACK && stack[untouched] == PAINT) untouched++;
+  free(stack);
+  return PROBE_STACK - untouched;
+}
+
+static double measureNs(BuildFn fn, bool dashboard, const RadarSnapshot& snap, unsigned iterations) {
+  size_t sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < iterations; i++) {
+    sink += dashboard ? callWithStackBuffer<JSON_BUFFER_SIZE>(fn, snap)
+                      : callWithStackBuffer<RADAR_TARGETS_JSON_SIZE>(fn, snap);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  if (sink == 0) fprintf(stderr, "empty output\n");
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+}
+
+static size_t stackBaseline = 0;
+
+static void run(const char* payload, const char* impl, BuildFn fn, bool dashboard,
+                const RadarSnapshot& snap, unsigned iterations, bool print) {
+  char out[JSON_BUFFER_SIZE];
+  size_t len = fn(out, sizeof(out), snap);
+  double ns = measureNs(fn, dashboard, snap, iterations);
+  size_t stack = measureStack(fn, dashboard, snap) - stackBaseline;
+  printf("%-10s %-12s %6zu %10.0f %10zu\n", payload, impl, len, ns, stack);
+  if (print) printf("  %s\n", out);
+}
+
+int main(int argc, char** argv) {
+  unsigned iterations = 200000;
+  bool print = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--print")) print = true;
+    else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = strtoul(argv[++i], nullptr, 10);
+    else {
+      fprintf(stderr, "usage: %s [--iterations N] [--print]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (iterations == 0) iterations = 1;
+
+  RadarSnapshot snap = sampleSnapshot();
+  stackBaseline = measureStack(nullptr, false, snap);
+  printf("%-10s %-12s %6s %10s %10s\n", "payload", "impl", "bytes", "ns/call", "stack B");
+  printf("# stack B: peak per call incl. output buffer (%u / %u B), thread entry (%zu B) subtracted\n",
+         RADAR_TARGETS_JSON_SIZE, JSON_BUFFER_SIZE, stackBaseline);
+  run("targets", "JsonWriter", writerTargets, false, snap, iterations, print);
+  run("targets", "ArduinoJson", domTargets, false, snap, iterations, print);
+  run("dashboard", "JsonWriter", writerDashboard, true, snap, iterations, print);
+  run("dashboard", "ArduinoJson", domDashboard, true, snap, iterations, print);
+  return 0;
+}
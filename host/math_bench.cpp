@@ -0,0 +1,218 @@
+// File: host/math_bench.cpp
+// Vergleicht den früheren Float-Pfad von parseRadarFrame() (sqrtf/atan2f,
+// Float-EMA) mit dem Ganzzahl-Pfad der Firmware (RadarMath + Q8-EMA):
+// Laufzeit pro Frame und Genauigkeit. Exit-Code 1, wenn eine Fehlerschranke
+// verletzt ist.
+//
+//   math_bench [--frames N] [--repeat N]
+
+#include <Arduino.h>
+#include "Config.h"
+#include "RadarMath.h"
+#include "RadarPipeline.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Fehlerschranken des Ganzzahl-Pfads
+static const double MAX_ATAN_ERR_CDEG  = 1.0;
+static const double MAX_ISQRT_ERR      = 0.5;
+static const double MAX_TRACK_ERR_MM   = 2.0;
+static const double MAX_TRACK_ERR_DEG  = 0.1;
+
+// Referenz: Float-Pfad, wie er vor der Umstellung in RadarPipeline.cpp lief
+struct FloatTarget {
+  bool presence;
+  float x, y, speed, distRaw, distanceXY, angleDeg;
+};
+
+static FloatTarget   refSmoothed[3];
+static unsigned long refLastSeen[3];
+
+static float refDecode(const uint8_t* b) {
+  int16_t raw = (int16_t)((b[1] << 8) | b[0]);
+  return (b[1] & 0x80) ? (float)(raw & 0x7FFF) : -(float)(raw & 0x7FFF);
+}
+
+static void refParseFrame(const uint8_t* buf, unsigned long now) {
+  for (int i = 0; i < 3; i++) {
+    const uint8_t* b = buf + 4 + i * RADAR_TARGET_BLOCKSIZE;
+    FloatTarget cur = {};
+    bool seen = false;
+    for (int j = 0; j < RADAR_TARGET_BLOCKSIZE; j++) {
+      if (b[j]) { seen = true; break; }
+    }
+    if (seen) {
+      refLastSeen[i]  = now;
+      cur.presence    = true;
+      cur.x           = refDecode(b);
+      cur.y           = refDecode(b + 2);
+      cur.speed       = refDecode(b + 4);
+      cur.distRaw     = (float)(b[6] | (b[7] << 8));
+      cur.distanceXY  = sqrtf(cur.x * cur.x + cur.y * cur.y);
+      cur.angleDeg    = atan2f(cur.y, cur.x) * 180.0f / PI;
+    } else if (now - refLastSeen[i] <= g_holdIntervalMs) {
+      cur = refSmoothed[i];
+      cur.presence = true;
+    }
+    if (!refSmoothed[i].presence) {
+      refSmoothed[i] = cur;
+    } else if (cur.presence) {
+      refSmoothed[i].x          = ALPHA * refSmoothed[i].x + (1 - ALPHA) * cur.x;
+      refSmoothed[i].y          = ALPHA * refSmoothed[i].y + (1 - ALPHA) * cur.y;
+      refSmoothed[i].speed      = ALPHA * refSmoothed[i].speed + (1 - ALPHA) * cur.speed;
+      refSmoothed[i].distRaw    = cur.distRaw;
+      refSmoothed[i].distanceXY = sqrtf(refSmoothed[i].x * refSmoothed[i].x +
+                                        refSmoothed[i].y * refSmoothed[i].y);
+      refSmoothed[i].angleDeg   = atan2f(refSmoothed[i].y, refSmoothed[i].x) * 180.0f / PI;
+    }
+    refSmoothed[i].presence = cur.presence;
+  }
+}
+
+static void putSigned(uint8_t* b, int v) {
+  uint16_t mag = (uint16_t)std::min(abs(v), 0x7FFF);
+  b[0] = mag & 0xFF;
+  b[1] = ((mag >> 8) & 0x7F) | (v >= 0 ? 0x80 : 0x00);
+}
+
+// Zufällige Ziele im Erfassungsbereich (±4 m quer, 0..8 m tief), Ziele
+// wandern langsam und verschwinden gelegentlich
+static std::vector<uint8_t> buildFrames(size_t count) {
+  std::vector<uint8_t> out(count * RADAR_FRAME_SIZE, 0);
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> step(-60, 60);
+  std::uniform_int_distribution<int> pct(0, 99);
+  int xs[3] = {-2000, 500, 3000}, ys[3] = {1500, 4000, 6500};
+  for (size_t n = 0; n < count; n++) {
+    uint8_t* f = out.data() + n * RADAR_FRAME_SIZE;
+    f[0] = 0xAA; f[1] = 0xFF; f[2] = 0x03; f[3] = 0x00;
+    for (int i = 0; i < 3; i++) {
+      xs[i] = std::max(-4000, std::min(4000, xs[i] + step(rng)));
+      ys[i] = std::max(0, std::min(8000, ys[i] + step(rng)));
+      if (pct(rng) < 5) continue;
+      uint8_t* b = f + 4 + i * RADAR_TARGET_BLOCKSIZE;
+      putSigned(b, xs[i]);
+      putSigned(b + 2, ys[i]);
+      putSigned(b + 4, step(rng));
+      uint16_t dist = (uint16_t)sqrt((double)xs[i] * xs[i] + (double)ys[i] * ys[i]);
+      b[6] = dist & 0xFF;
+      b[7] = dist >> 8;
+    }
+    f[RADAR_FRAME_SIZE - 2] = 0x55;
+    f[RADAR_FRAME_SIZE - 1] = 0xCC;
+  }
+  return out;
+}
+
+static bool checkAtan2() {
+  double maxErr = 0;
+  for (int y = -2048; y <= 2048; y += 3) {
+    for (int x = -2048; x <= 2048; x += 3) {
+      double ref = atan2((double)y, (double)x) * 18000.0 / M_PI;
+      double err = fabs(radarAtan2Cdeg(y, x) - ref);
+      if (err > 18000.0) err = 36000.0 - err;     // ±180° sind gleichwertig
+      maxErr = std::max(maxErr, err);
+    }
+  }
+  for (int32_t v = 1; v <= 65535; v += 7) {
+    double refA = atan2((double)v, 65535.0) * 18000.0 / M_PI;
+    maxErr = std::max(maxErr, fabs(radarAtan2Cdeg(v, 65535) - refA));
+  }
+  bool ok = maxErr <= MAX_ATAN_ERR_CDEG;
+  printf("# atan2:  max error %.3f cdeg (bound %.1f) %s\n", maxErr, MAX_ATAN_ERR_CDEG,
+         ok ? "ok" : "FAIL");
+  return ok;
+}
+
+static bool checkIsqrt() {
+  double maxErr = 0;
+  for (uint64_t v = 0; v <= 0xFFFFFFFFULL; v += (v < 1000000 ? 1 : 9973)) {
+    // Ergebnis sättigt bei 65535 (uint16_t)
+    double ref = std::min(sqrt((double)v), 65535.0);
+    maxErr = std::max(maxErr, fabs(radarIsqrt32((uint32_t)v) - ref));
+  }
+  maxErr = std::max(maxErr, fabs(radarIsqrt32(0xFFFFFFFFUL) - 65535.0));
+  bool ok = maxErr <= MAX_ISQRT_ERR;
+  printf("# isqrt:  max error %.3f (bound %.1f) %s\n", maxErr, MAX_ISQRT_ERR,
+         ok ? "ok" : "FAIL");
+  return ok;
+}
+
+static bool checkTracks(const std::vector<uint8_t>& frames) {
+  memset(refSmoothed, 0, sizeof(refSmoothed));
+  memset(refLastSeen, 0, sizeof(refLastSeen));
+  radarPipelineInit();
+  hostSetMicros(0);
+
+  double errMm = 0, errDeg = 0;
+  size_t count = frames.size() / RADAR_FRAME_SIZE;
+  for (size_t n = 0; n < count; n++) {
+    hostAdvanceMicros(100000);
+    const uint8_t* f = frames.data() + n * RADAR_FRAME_SIZE;
+    refParseFrame(f, millis());
+    parseRadarFrame(f, RADAR_FRAME_SIZE);
+
+    RadarTarget t[3];
+    getRadarTargets(t);
+    for (int i = 0; i < 3; i++) {
+      if (t[i].presence != refSmoothed[i].presence) return false;
+      if (!t[i].presence) continue;
+      errMm = std::max(errMm, fabs((double)t[i].x - refSmoothed[i].x));
+      errMm = std::max(errMm, fabs((double)t[i].y - refSmoothed[i].y));
+      errMm = std::max(errMm, fabs((double)t[i].distanceXY - refSmoothed[i].distanceXY));
+      double da = fabs(t[i].angleCdeg / 100.0 - refSmoothed[i].angleDeg);
+      if (da > 180.0) da = 360.0 - da;
+      errDeg = std::max(errDeg, da);
+    }
+  }
+  bool ok = errMm <= MAX_TRACK_ERR_MM && errDeg <= MAX_TRACK_ERR_DEG;
+  printf("# tracks: max error %.2f mm / %.3f deg (bounds %.1f / %.1f) %s\n", errMm, errDeg,
+         MAX_TRACK_ERR_MM, MAX_TRACK_ERR_DEG, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+template <typename F>
+static double timePerFrame(const std::vector<uint8_t>& frames, unsigned repeat, F parse) {
+  size_t count = frames.size() / RADAR_FRAME_SIZE;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned r = 0; r < repeat; r++) {
+    for (size_t n = 0; n < count; n++) {
+      hostAdvanceMicros(100000);
+      parse(frames.data() + n * RADAR_FRAME_SIZE);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  return ns / ((double)count * repeat);
+}
+
+int main(int argc, char** argv) {
+  size_t   frameCount = 20000;
+  unsigned repeat     = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if      (!strcmp(argv[i], "--frames")) frameCount = strtoul(argv[i + 1], nullptr, 10);
+    else if (!strcmp(argv[i], "--repeat")) repeat = strtoul(argv[i + 1], nullptr, 10);
+    else {
+      fprintf(stderr, "usage: %s [--frames N] [--repeat N]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (frameCount == 0) frameCount = 1;
+  if (repeat == 0) repeat = 1;
+
+  std::vector<uint8_t> frames = buildFrames(frameCount);
+
+  bool ok = checkAtan2();
+  ok = checkIsqrt() && ok;
+  ok = checkTracks(frames) && ok;
+
+  double floatNs = timePerFrame(frames, repeat,
+                                [](const uint8_t* f) { refParseFrame(f, millis()); });
+  double fixedNs = timePerFrame(frames, repeat,
+                                [](const uint8_t* f) { parseRadarFrame(f, RADAR_FRAME_SIZE); });
+  printf("# float path: %.1f ns/frame\n", floatNs);
+  printf("# fixed path: %.1f ns/frame (%.2fx)\n", fixedNs, floatNs / fixedNs);
+  return ok ? 0 : 1;
+}
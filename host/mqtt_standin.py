@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+# File: host/mqtt_standin.py
+#
+# Minimaler MQTT-3.1.1-Stand-in-Broker zum Testen des Reconnect-Verhaltens.
+# Jede eingehende Verbindung bekommt den nächsten Modus aus --modes
+# (zyklisch):
+#
+#   ok        CONNACK 0, danach PINGREQ beantworten und PUBLISH-Topics loggen
+#   drop      TCP annehmen und sofort schließen
+#   delay:S   S Sekunden warten, dann wie ok
+#   silent    annehmen, nie antworten (Sensor läuft in den CONNACK-Timeout)
+#   refuse:RC CONNACK mit Return-Code RC (z. B. 5 = not authorized)
+#
+# Beispiel: erst drei Fehlversuche, dann verbinden, nach 30 s trennen
+#   python3 host/mqtt_standin.py --port 1883 --modes drop,silent,delay:20,ok --drop-after 30
+#
+# Der Sensor wird per setServer/WiFiManager auf die IP des Rechners gestellt.
+# Während der Fehlversuche müssen Dashboard und /api/radar flüssig bleiben;
+# /api/metrics → loop.stages.mqttConnect sollte nahe 0 bleiben.
+
+import argparse
+import itertools
+import socket
+import threading
+import time
+
+CONNECT, CONNACK, PUBLISH, SUBSCRIBE, SUBACK, PINGREQ, PINGRESP, DISCONNECT = 1, 2, 3, 8, 9, 12, 13, 14
+
+
+def log(peer, msg):
+    print("%s %s:%d %s" % (time.strftime("%H:%M:%S"), peer[0], peer[1], msg), flush=True)
+
+
+def read_exact(sock, n):
+    buf = b""
+    while len(buf) < n:
+        chunk = sock.recv(n - len(buf))
+        if not chunk:
+            raise ConnectionError("closed")
+        buf += chunk
+    return buf
+
+
+def read_packet(sock):
+    header = read_exact(sock, 1)[0]
+    length, shift = 0, 0
+    while True:
+        b = read_exact(sock, 1)[0]
+        length |= (b & 0x7F) << shift
+        if not b & 0x80:
+            break
+        shift += 7
+    return header >> 4, header & 0x0F, read_exact(sock, length)
+
+
+def serve_ok(sock, peer, drop_after):
+    sock.sendall(bytes([CONNACK << 4, 2, 0, 0]))
+    log(peer, "CONNACK 0")
+    if drop_after:
+        sock.settimeout(0.5)
+    started = time.monotonic()
+    while True:
+        if drop_after and time.monotonic() - started > drop_after:
+            log(peer, "drop-after reached, closing")
+            return
+        try:
+            ptype, flags, body = read_packet(sock)
+        except socket.timeout:
+            continue
+        if ptype == PUBLISH:
+            tlen = (body[0] << 8) | body[1]
+            topic = body[2:2 + tlen].decode(errors="replace")
+            offset = 2 + tlen + (2 if flags & 0x06 else 0)
+            log(peer, "PUBLISH %s (%d bytes)" % (topic, len(body) - offset))
+        elif ptype == SUBSCRIBE:
+            pid = body[:2]
+            count = 0
+            i = 2
+            while i < len(body):
+                tlen = (body[i] << 8) | body[i + 1]
+                log(peer, "SUBSCRIBE %s" % body[i + 2:i + 2 + tlen].decode(errors="replace"))
+                i += 2 + tlen + 1
+                count += 1
+            sock.sendall(bytes([SUBACK << 4, 2 + count]) + pid + bytes(count))
+        elif ptype == PINGREQ:
+            sock.sendall(bytes([PINGRESP << 4, 0]))
+        elif ptype == DISCONNECT:
+            log(peer, "DISCONNECT")
+            return
+
+
+def handle(sock, peer, mode, drop_after):
+    name, _, arg = mode.partition(":")
+    try:
+        if name == "drop":
+            log(peer, "drop")
+            return
+        ptype, _, _ = read_packet(sock)
+        if ptype != CONNECT:
+            log(peer, "expected CONNECT, got type %d" % ptype)
+            return
+        log(peer, "CONNECT (mode %s)" % mode)
+        if name == "silent":
+            while sock.recv(256):
+                pass
+            return
+        if name == "refuse":
+            sock.sendall(bytes([CONNACK << 4, 2, 0, int(arg or 5)]))
+            log(peer, "CONNACK %d" % int(arg or 5))
+            return
+        if name == "delay":
+            time.sleep(float(arg or 10))
+        serve_ok(sock, peer, drop_after)
+    except (ConnectionError, OSError) as e:
+        log(peer, "closed (%s)" % e)
+    finally:
+        sock.close()
+
+
+def main():
+    ap = argparse.ArgumentParser(description="MQTT stand-in broker for reconnect tests")
+    ap.add_argument("--host", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=1883)
+    ap.add_argument("--modes", default="ok", help="comma separated, cycled per connection")
+    ap.add_argument("--drop-after", type=float, default=0, help="close ok sessions after N seconds")
+    args = ap.parse_args()
+
+    modes = itertools.cycle([m.strip() for m in args.modes.split(",") if m.strip()])
+    srv = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    srv.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    srv.bind((args.host, args.port))
+    srv.listen(4)
+    print("MQTT stand-in on %s:%d, modes %s" % (args.host, args.port, args.modes), flush=True)
+    while True:
+        sock, peer = srv.accept()
+        threading.Thread(target=handle, args=(sock, peer, next(modes), args.drop_after),
+                         daemon=True).start()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,281 @@
+// File: host/radar_bench.cpp
+// Replays RD-03D byte streams through the firmware radar pipeline
+// (RadarParser → dedupe → parseRadarFrame → smoothing) on the host and
+// reports throughput plus the resulting tracks. Device recordings (.rdr,
+// see RadarRecorder.h) are replayed frame by frame at their capture times.
+//
+//   radar_bench [--synthetic N] [--file capture.bin] [--recording dump.rdr]
+//               [--write out.bin] [--chunk BYTES] [--repeat N]
+//               [--period-ms MS] [--noise PCT] [--swap PCT] [--tracks]
+
+#include <Arduino.h>
+#include "Config.h"
+#include "RadarPipeline.h"
+#include "RadarRecorder.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+struct BenchOptions {
+  size_t      syntheticFrames = 2000;
+  const char* inputFile       = nullptr;
+  const char* recordingFile   = nullptr;
+  const char* outputFile      = nullptr;
+  size_t      chunk           = 64;
+  unsigned    repeat          = 50;
+  unsigned    periodMs        = 100;
+  unsigned    noisePct        = 0;
+  unsigned    swapPct         = 0;
+  bool        printTracks     = false;
+};
+
+static void usage(const char* prog) {
+  fprintf(stderr,
+          "usage: %s [--synthetic N] [--file capture.bin] [--recording dump.rdr]\n"
+          "          [--write out.bin] [--chunk BYTES] [--repeat N] [--period-ms MS]\n"
+          "          [--noise PCT] [--swap PCT] [--tracks]\n",
+          prog);
+}
+
+static bool parseArgs(int argc, char** argv, BenchOptions& o) {
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (!strcmp(a, "--tracks")) { o.printTracks = true; continue; }
+    if (!v) return false;
+    if      (!strcmp(a, "--synthetic")) o.syntheticFrames = strtoul(v, nullptr, 10);
+    else if (!strcmp(a, "--file"))      o.inputFile = v;
+    else if (!strcmp(a, "--recording")) o.recordingFile = v;
+    else if (!strcmp(a, "--write"))     o.outputFile = v;
+    else if (!strcmp(a, "--chunk"))     o.chunk = strtoul(v, nullptr, 10);
+    else if (!strcmp(a, "--repeat"))    o.repeat = strtoul(v, nullptr, 10);
+    else if (!strcmp(a, "--period-ms")) o.periodMs = strtoul(v, nullptr, 10);
+    else if (!strcmp(a, "--noise"))     o.noisePct = strtoul(v, nullptr, 10);
+    else if (!strcmp(a, "--swap"))      o.swapPct = strtoul(v, nullptr, 10);
+    else return false;
+    i++;
+  }
+  if (o.chunk == 0) o.chunk = 1;
+  if (o.repeat == 0) o.repeat = 1;
+  return true;
+}
+
+// RD-03D Vorzeichenformat: Bit 15 gesetzt = positiv, sonst negativ
+static void putSigned(uint8_t* b, int v) {
+  uint16_t mag = (uint16_t)std::min(abs(v), 0x7FFF);
+  b[0] = mag & 0xFF;
+  b[1] = ((mag >> 8) & 0x7F) | (v >= 0 ? 0x80 : 0x00);
+}
+
+static void appendFrame(std::vector<uint8_t>& out, const int xs[3], const int ys[3],
+                        const int speeds[3], const bool present[3]) {
+  uint8_t f[RADAR_FRAME_SIZE] = {0xAA, 0xFF, 0x03, 0x00};
+  for (int i = 0; i < 3; i++) {
+    uint8_t* b = f + 4 + i * RADAR_TARGET_BLOCKSIZE;
+    if (!present[i]) continue;
+    putSigned(b, xs[i]);
+    putSigned(b + 2, ys[i]);
+    putSigned(b + 4, speeds[i]);
+    uint16_t dist = (uint16_t)std::min(65535.0, sqrt((double)xs[i] * xs[i] + (double)ys[i] * ys[i]));
+    b[6] = dist & 0xFF;
+    b[7] = dist >> 8;
+  }
+  f[RADAR_FRAME_SIZE - 2] = 0x55;
+  f[RADAR_FRAME_SIZE - 1] = 0xCC;
+  out.insert(out.end(), f, f + RADAR_FRAME_SIZE);
+}
+
+// Drei Personen: eine läuft quer durch den Raum, eine sitzt mit Mikro-
+// Bewegung, eine kommt und geht. Messrauschen ±30 mm.
+static std::vector<uint8_t> buildSyntheticStream(const BenchOptions& o) {
+  std::vector<uint8_t> out;
+  out.reserve(o.syntheticFrames * (RADAR_FRAME_SIZE + 4));
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> jitter(-30, 30);
+  std::uniform_int_distribution<int> pct(0, 99);
+  std::uniform_int_distribution<int> byteDist(0, 255);
+
+  for (size_t n = 0; n < o.syntheticFrames; n++) {
+    double t = n * o.periodMs / 1000.0;
+    int xs[3], ys[3], speeds[3];
+    bool present[3];
+
+    double phase = fmod(t, 20.0) / 20.0;              // 20 s pro Durchgang
+    xs[0] = (int)(-2500 + 5000 * phase) + jitter(rng);
+    ys[0] = 2000 + jitter(rng);
+    speeds[0] = 25;                                  // cm/s
+    present[0] = true;
+
+    xs[1] = 800 + jitter(rng) / 3;
+    ys[1] = 3200 + jitter(rng) / 3;
+    speeds[1] = 0;
+    present[1] = true;
+
+    present[2] = fmod(t, 30.0) < 12.0;
+    xs[2] = -1200 + jitter(rng);
+    ys[2] = (int)(1000 + 150 * t) % 5000 + 500 + jitter(rng);
+    speeds[2] = -15;
+
+    // Der Sensor vertauscht gelegentlich seine Slots
+    if (o.swapPct && pct(rng) < (int)o.swapPct) {
+      int a = byteDist(rng) % 3, b = (a + 1 + byteDist(rng) % 2) % 3;
+      std::swap(xs[a], xs[b]);
+      std::swap(ys[a], ys[b]);
+      std::swap(speeds[a], speeds[b]);
+      std::swap(present[a], present[b]);
+    }
+
+    if (o.noisePct && pct(rng) < (int)o.noisePct) {
+      int garbage = 1 + byteDist(rng) % 24;
+      for (int g = 0; g < garbage; g++) out.push_back((uint8_t)byteDist(rng));
+    }
+    appendFrame(out, xs, ys, speeds, present);
+  }
+  return out;
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+static bool writeFile(const char* path, const std::vector<uint8_t>& data) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+  return ok;
+}
+
+static void printTargets(const char* prefix) {
+  RadarTarget t[3];
+  getRadarTargets(t);
+  for (int i = 0; i < 3; i++) {
+    if (!t[i].presence) {
+      printf("%s,%lu,%d,0,,,,,,\n", prefix, millis(), i + 1);
+      continue;
+    }
+    printf("%s,%lu,%d,1,%u,%d,%d,%ld,%u,%.2f\n", prefix, millis(), i + 1, t[i].id,
+           t[i].x, t[i].y, radarSpeedCmS(t[i]), t[i].distanceXY, t[i].angleCdeg / 100.0);
+  }
+}
+
+// Stream in UART-großen Häppchen einspeisen. Der Sensor sendet einen Frame
+// pro Periode, daher läuft die virtuelle Uhr mit periodMs / RADAR_FRAME_SIZE
+// pro Byte – so greifen Hold-Intervall und Zeitlogik wie auf dem Gerät.
+static uint32_t replay(const std::vector<uint8_t>& stream, size_t chunk, unsigned periodMs,
+                       bool printTracks) {
+  const RadarParser& parser = radarPipelineParser();
+  uint32_t framesBefore = parser.frames;
+  for (size_t i = 0; i < stream.size(); i += chunk) {
+    size_t n = std::min(chunk, stream.size() - i);
+    hostAdvanceMicros((uint64_t)n * periodMs * 1000ULL / RADAR_FRAME_SIZE);
+    uint32_t seen = parser.frames;
+    radarPipelineFeed(stream.data() + i, n);
+    if (printTracks && parser.frames != seen) printTargets("track");
+  }
+  return parser.frames - framesBefore;
+}
+
+// .rdr-Records mit ihren Aufnahmezeitpunkten einspielen; baseUs verschiebt
+// die Zeitachse, damit wiederholte Durchläufe monoton weiterlaufen
+static uint32_t replayRecording(const std::vector<uint8_t>& file, uint32_t count,
+                                uint64_t& baseUs, bool printTracks) {
+  const uint8_t* rec = file.data() + RADAR_REC_HEADER_SIZE;
+  uint32_t firstMs = 0, lastMs = 0;
+  for (uint32_t n = 0; n < count; n++, rec += RADAR_REC_RECORD_SIZE) {
+    uint32_t ms = rec[0] | (rec[1] << 8) | (rec[2] << 16) | ((uint32_t)rec[3] << 24);
+    if (n == 0) firstMs = ms;
+    lastMs = ms;
+    hostSetMicros(baseUs + (uint64_t)(ms - firstMs) * 1000ULL);
+    radarPipelineFrame(rec + 4);
+    if (printTracks) printTargets("track");
+  }
+  baseUs += (uint64_t)(lastMs - firstMs + 1000) * 1000ULL;
+  return count;
+}
+
+static int runRecording(const BenchOptions& o) {
+  std::vector<uint8_t> file;
+  uint32_t count = 0;
+  if (!readFile(o.recordingFile, file) ||
+      !radarRecordingParseHeader(file.data(), file.size(), count)) {
+    fprintf(stderr, "cannot read recording %s\n", o.recordingFile);
+    return 1;
+  }
+
+  radarPipelineInit();
+  uint64_t baseUs = 0;
+  if (o.printTracks) printf("kind,ms,slot,presence,id,x,y,speed,distance,angleDeg\n");
+  replayRecording(file, count, baseUs, o.printTracks);
+
+  uint64_t frames = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned r = 0; r < o.repeat; r++) {
+    frames += replayRecording(file, count, baseUs, false);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  printf("# recording: %s, %u frames, repeat %u\n", o.recordingFile, count, o.repeat);
+  if (frames) {
+    printf("# throughput: %.0f frames/s, %.1f ns/frame\n", frames / (ns / 1e9), ns / frames);
+  }
+  printTargets("final");
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  BenchOptions o;
+  if (!parseArgs(argc, argv, o)) {
+    usage(argv[0]);
+    return 2;
+  }
+  if (o.recordingFile) return runRecording(o);
+
+  std::vector<uint8_t> stream;
+  if (o.inputFile) {
+    if (!readFile(o.inputFile, stream)) {
+      fprintf(stderr, "cannot read %s\n", o.inputFile);
+      return 1;
+    }
+  } else {
+    stream = buildSyntheticStream(o);
+  }
+  if (o.outputFile && !writeFile(o.outputFile, stream)) {
+    fprintf(stderr, "cannot write %s\n", o.outputFile);
+    return 1;
+  }
+
+  radarPipelineInit();
+
+  // Erster Durchlauf mit optionaler Track-Ausgabe, danach reine Messläufe
+  if (o.printTracks) printf("kind,ms,slot,presence,id,x,y,speed,distance,angleDeg\n");
+  replay(stream, o.chunk, o.periodMs, o.printTracks);
+
+  uint64_t frames = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned r = 0; r < o.repeat; r++) {
+    frames += replay(stream, o.chunk, o.periodMs, false);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  const RadarParser& parser = radarPipelineParser();
+  printf("# input: %s, %zu bytes, chunk %zu, repeat %u\n",
+         o.inputFile ? o.inputFile : "synthetic", stream.size(), o.chunk, o.repeat);
+  printf("# frames: %llu, resyncs: %u, discarded bytes: %u\n",
+         (unsigned long long)frames, parser.resyncs, parser.discardedBytes);
+  if (frames) {
+    printf("# throughput: %.0f frames/s, %.1f ns/frame, %.2f MB/s\n",
+           frames / (ns / 1e9), ns / frames, (double)stream.size() * o.repeat / (ns / 1e3));
+  }
+  printTargets("final");
+  return 0;
+}
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# File: host/radar_bin.py
+#
+# Decoder für <topic>/bin (RadarBinary.h, Layout v1) zum Einbinden in
+# Ingestion-Dienste:
+#
+#   from radar_bin import decode
+#   snap = decode(msg.payload)   # dict wie <topic>, plus frame/timeMs
+#
+# Als Skript: Hex-Payloads zeilenweise von stdin, z. B.
+#   mosquitto_sub -t radar/bin -F %x | python3 host/radar_bin.py
+#
+# distance/angleDeg/speed werden hier mit Fließkomma gerechnet und können um
+# 1 Einheit von der Ganzzahl-Rechnung der Firmware (radar_decode)
+# abweichen.
+
+import json
+import math
+import struct
+import sys
+
+VERSION = 1
+HEADER = struct.Struct("<BBII")       # version, count, frame, timeMs
+TARGET = struct.Struct("<HhhhHH")     # id, x, y, speed mm/s, distRaw, sigma
+
+
+def decode(payload):
+    if len(payload) < HEADER.size:
+        raise ValueError("payload too short")
+    version, count, frame, time_ms = HEADER.unpack_from(payload)
+    if version != VERSION:
+        raise ValueError("unsupported version %d" % version)
+    if count > 3 or len(payload) != HEADER.size + count * TARGET.size:
+        raise ValueError("bad length %d for %d targets" % (len(payload), count))
+
+    targets = []
+    for i in range(count):
+        tid, x, y, speed, dist_raw, sigma = TARGET.unpack_from(payload, HEADER.size + i * TARGET.size)
+        t = {
+            "id": tid,
+            "x": x,
+            "y": y,
+            "speed": int(round(speed / 10.0)),      # cm/s wie im JSON
+            "distRaw": dist_raw,
+            "distance": int(round(math.hypot(x, y))),
+            "angleDeg": int(round(math.degrees(math.atan2(y, x)))),
+        }
+        if sigma:
+            t["sigma"] = sigma
+        targets.append(t)
+    return {"frame": frame, "timeMs": time_ms, "targetCount": count, "targets": targets}
+
+
+def main():
+    rc = 0
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+        try:
+            print(json.dumps(decode(bytes.fromhex(line))), flush=True)
+        except ValueError as e:
+            print("invalid payload: %s" % e, file=sys.stderr)
+            rc = 1
+    return rc
+
+
+if __name__ == "__main__":
+    sys.exit(main())
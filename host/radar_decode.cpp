@@ -0,0 +1,99 @@
+// File: host/radar_decode.cpp
+// Decodes <topic>/bin payloads (RadarBinary.h, layout v1) back into the
+// JSON form of <topic>, using the firmware decoder so distance/angle match
+// the sensor bit for bit. Reference for ingestion services.
+//
+//   mosquitto_sub -t radar/bin -F %x | radar_decode      (one hex payload per line)
+//   radar_decode --hex 010100...                         (single payload)
+//   radar_decode --file payload.bin                      (raw payload file)
+
+#include <Arduino.h>
+#include "Config.h"
+#include "RadarBinary.h"
+
+#include <vector>
+
+static void usage(const char* prog) {
+  fprintf(stderr, "usage: %s [--hex HEX | --file payload.bin]  (default: hex lines on stdin)\n", prog);
+}
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static bool parseHex(const char* s, std::vector<uint8_t>& out) {
+  out.clear();
+  int hi = -1;
+  for (; *s; s++) {
+    if (isspace((unsigned char)*s)) continue;
+    int v = hexNibble(*s);
+    if (v < 0) return false;
+    if (hi < 0) {
+      hi = v;
+    } else {
+      out.push_back((uint8_t)(hi << 4 | v));
+      hi = -1;
+    }
+  }
+  return hi < 0;
+}
+
+static bool printPayload(const std::vector<uint8_t>& data) {
+  RadarSnapshot snap;
+  if (!radarBinaryDecode(data.data(), data.size(), snap)) {
+    fprintf(stderr, "invalid payload (%zu bytes, version %d)\n",
+            data.size(), data.empty() ? -1 : data[0]);
+    return false;
+  }
+  int count = 0;
+  for (int i = 0; i < 3; i++) if (snap.targets[i].presence) count++;
+  printf("{\"frame\":%u,\"timeMs\":%lu,\"targetCount\":%d,\"targets\":[",
+         snap.frame, snap.timeMs, count);
+  for (int i = 0; i < count; i++) {
+    const RadarTarget& t = snap.targets[i];
+    printf("%s{\"id\":%u,\"x\":%d,\"y\":%d,\"speed\":%ld,\"distRaw\":%u,\"distance\":%u,\"angleDeg\":%ld",
+           i ? "," : "", t.id, t.x, t.y, radarSpeedCmS(t), t.distRaw, t.distanceXY, radarAngleDeg(t));
+    if (t.sigma) printf(",\"sigma\":%u", t.sigma);
+    printf("}");
+  }
+  printf("]}\n");
+  return true;
+}
+
+int main(int argc, char** argv) {
+  std::vector<uint8_t> data;
+  if (argc == 3 && !strcmp(argv[1], "--hex")) {
+    if (!parseHex(argv[2], data)) {
+      fprintf(stderr, "invalid hex\n");
+      return 1;
+    }
+    return printPayload(data) ? 0 : 1;
+  }
+  if (argc == 3 && !strcmp(argv[1], "--file")) {
+    FILE* f = fopen(argv[2], "rb");
+    if (!f) {
+      fprintf(stderr, "cannot read %s\n", argv[2]);
+      return 1;
+    }
+    uint8_t buf[256];
+    size_t n = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+    data.assign(buf, buf + n);
+    return printPayload(data) ? 0 : 1;
+  }
+  if (argc != 1) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  char line[512];
+  unsigned bad = 0;
+  while (fgets(line, sizeof(line), stdin)) {
+    if (!parseHex(line, data) || !printPayload(data)) bad++;
+    fflush(stdout);
+  }
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+// File: host/shim/Arduino.h
+// Minimaler Arduino-Ersatz für den Host-Build der Radar-Pipeline.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#ifndef PI
+#define PI 3.14159265358979323846f
+#endif
+#define PROGMEM
+
+using std::min;
+using std::max;
+
+// Virtuelle Uhr: der Benchmark schreibt die Zeit aus dem Replay-Stream fort
+unsigned long millis();
+unsigned long micros();
+void hostSetMicros(uint64_t us);
+void hostAdvanceMicros(uint64_t us);
+inline void yield() {}
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+
+// Kein PSRAM auf dem Host
+inline bool psramFound() { return false; }
+inline void* ps_malloc(size_t n) { return malloc(n); }
+
+// FreeRTOS-Kritische Abschnitte sind im Single-Thread-Host no-ops
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(m) ((void)(m))
+#define portEXIT_CRITICAL(m)  ((void)(m))
+
+class String {
+ public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const char* o) const { return s_ != o; }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+ private:
+  std::string s_;
+};
+
+class HostSerial {
+ public:
+  explicit HostSerial(FILE* out) : out_(out) {}
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t read(uint8_t*, size_t) { return 0; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+  size_t print(const char* s) { return out_ ? fputs(s, out_), strlen(s) : 0; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t println(const char* s = "") { size_t n = print(s); print("\n"); return n + 1; }
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+ private:
+  FILE* out_;
+};
+
+extern HostSerial Serial;
+extern HostSerial Serial1;
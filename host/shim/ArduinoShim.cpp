@@ -0,0 +1,24 @@
+// File: host/shim/ArduinoShim.cpp
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+static uint64_t hostMicros = 0;
+
+unsigned long millis() { return (unsigned long)(hostMicros / 1000ULL); }
+unsigned long micros() { return (unsigned long)hostMicros; }
+void hostSetMicros(uint64_t us) { hostMicros = us; }
+void hostAdvanceMicros(uint64_t us) { hostMicros += us; }
+
+// Log-Ausgaben der Firmware landen auf stderr, Messwerte auf stdout
+HostSerial Serial(stderr);
+HostSerial Serial1(nullptr);
+
+size_t HostSerial::printf(const char* fmt, ...) {
+  if (!out_) return 0;
+  va_list args;
+  va_start(args, fmt);
+  int n = vfprintf(out_, fmt, args);
+  va_end(args);
+  return n > 0 ? (size_t)n : 0;
+}
@@ -0,0 +1,15 @@
+// File: host/shim/Preferences.h
+
+#pragma once
+#include <Arduino.h>
+
+class Preferences {
+ public:
+  bool begin(const char*, bool = false) { return true; }
+  void end() {}
+  String getString(const char*, const String& def = String()) { return def; }
+  size_t putString(const char*, const String&) { return 0; }
+  size_t putBytes(const char*, const void*, size_t) { return 0; }
+  size_t getBytes(const char*, void*, size_t) { return 0; }
+  size_t getBytesLength(const char*) { return 0; }
+};
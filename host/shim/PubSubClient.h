@@ -0,0 +1,12 @@
+// File: host/shim/PubSubClient.h
+
+#pragma once
+#include <WiFi.h>
+
+class PubSubClient {
+ public:
+  explicit PubSubClient(WiFiClient&) {}
+  bool loop() { return true; }
+  bool connected() { return false; }
+  bool publish(const char*, const char*, bool = false) { return false; }
+};
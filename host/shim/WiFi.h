@@ -0,0 +1,6 @@
+// File: host/shim/WiFi.h
+
+#pragma once
+#include <Arduino.h>
+
+class WiFiClient {};
@@ -0,0 +1,17 @@
+// File: host/shim/WiFiManager.h
+
+#pragma once
+#include <WiFi.h>
+
+class WiFiManagerParameter {
+ public:
+  WiFiManagerParameter(const char*, const char*, const char*, int, const char* = "") {}
+};
+
+class WiFiManager {
+ public:
+  void setSaveParamsCallback(void (*)()) {}
+  void addParameter(WiFiManagerParameter*) {}
+  void setConfigPortalTimeout(unsigned long) {}
+  bool autoConnect(const char*, const char*) { return false; }
+};
@@ -0,0 +1,198 @@
+// File: host/tracker_bench.cpp
+// Vergleicht EMA- und Kalman-Glättung von parseRadarFrame() an einer
+// synthetischen Person mit bekannter Bahn: stehen, gehen, stehen, mit
+// Messrauschen und Aussetzern innerhalb des Hold-Intervalls.
+//
+//   tracker_bench [--loops N] [--period-ms MS] [--dropout PCT] [--repeat N]
+
+#include <Arduino.h>
+#include "Config.h"
+#include "RadarPipeline.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+struct Waypoint {
+  float t, x, y;     // s, mm
+};
+
+// Eine Schleife: stehen → gehen (~0,8 m/s) → stehen → zurückgehen → stehen
+static const Waypoint PATH[] = {
+  {  0.0f, -1500.0f, 2500.0f },
+  {  3.0f, -1500.0f, 2500.0f },
+  {  7.0f,  1500.0f, 3500.0f },
+  { 10.0f,  1500.0f, 3500.0f },
+  { 13.0f,     0.0f, 1200.0f },
+  { 16.0f,     0.0f, 1200.0f },
+};
+static const int   PATH_LEN    = sizeof(PATH) / sizeof(PATH[0]);
+static const float LOOP_S      = 16.0f;
+static const float SETTLE_S    = 1.0f;    // Einschwingzeit nach Phasenwechsel, nicht gewertet
+
+struct Truth {
+  float x, y, vx, vy;
+  bool  moving;
+  float phaseAge;    // s seit Beginn der aktuellen Phase
+};
+
+static Truth truthAt(float t) {
+  float lt = fmodf(t, LOOP_S);
+  for (int i = 0; i + 1 < PATH_LEN; i++) {
+    const Waypoint& a = PATH[i];
+    const Waypoint& b = PATH[i + 1];
+    if (lt > b.t) continue;
+    float span = b.t - a.t;
+    float f = (lt - a.t) / span;
+    Truth tr;
+    tr.vx = (b.x - a.x) / span;
+    tr.vy = (b.y - a.y) / span;
+    tr.x = a.x + (b.x - a.x) * f;
+    tr.y = a.y + (b.y - a.y) * f;
+    tr.moving = tr.vx != 0.0f || tr.vy != 0.0f;
+    tr.phaseAge = lt - a.t;
+    return tr;
+  }
+  return Truth{ PATH[0].x, PATH[0].y, 0, 0, false, lt };
+}
+
+static void putSigned(uint8_t* b, int v) {
+  uint16_t mag = (uint16_t)std::min(abs(v), 0x7FFF);
+  b[0] = mag & 0xFF;
+  b[1] = ((mag >> 8) & 0x7F) | (v >= 0 ? 0x80 : 0x00);
+}
+
+struct Sample {
+  uint8_t frame[RADAR_FRAME_SIZE];
+  Truth   truth;
+};
+
+static std::vector<Sample> buildScenario(unsigned loops, unsigned periodMs, unsigned dropoutPct) {
+  std::vector<Sample> out;
+  std::mt19937 rng(1234);
+  std::normal_distribution<float> posNoise(0.0f, KALMAN_POS_NOISE);
+  std::normal_distribution<float> speedNoise(0.0f, KALMAN_SPEED_NOISE);
+  std::uniform_int_distribution<int> pct(0, 99);
+
+  unsigned count = (unsigned)(loops * LOOP_S * 1000.0f / periodMs);
+  for (unsigned n = 0; n < count; n++) {
+    Sample s;
+    memset(s.frame, 0, sizeof(s.frame));
+    s.frame[0] = 0xAA; s.frame[1] = 0xFF; s.frame[2] = 0x03; s.frame[3] = 0x00;
+    s.frame[RADAR_FRAME_SIZE - 2] = 0x55;
+    s.frame[RADAR_FRAME_SIZE - 1] = 0xCC;
+    s.truth = truthAt(n * periodMs / 1000.0f);
+
+    // Erstes Frame nie auslassen, sonst startet der Track verspätet
+    if (n == 0 || pct(rng) >= (int)dropoutPct) {
+      const Truth& tr = s.truth;
+      float range = sqrtf(tr.x * tr.x + tr.y * tr.y);
+      float vr = (tr.x * tr.vx + tr.y * tr.vy) / range;       // positiv = entfernt sich
+      int mx = (int)lroundf(tr.x + posNoise(rng));
+      int my = (int)lroundf(tr.y + posNoise(rng));
+      uint8_t* b = s.frame + 4;
+      putSigned(b, mx);
+      putSigned(b + 2, my);
+      putSigned(b + 4, (int)lroundf((vr + speedNoise(rng)) / 10.0f));   // cm/s
+      uint16_t dist = (uint16_t)sqrtf((float)mx * mx + (float)my * my);
+      b[6] = dist & 0xFF;
+      b[7] = dist >> 8;
+    }
+    out.push_back(s);
+  }
+  return out;
+}
+
+struct Stats {
+  double stillSq = 0, moveSq = 0, lagS = 0, sigma = 0;
+  unsigned stillN = 0, moveN = 0, sigmaN = 0, lost = 0;
+  double nsPerFrame = 0;
+};
+
+static Stats run(const std::vector<Sample>& scenario, unsigned periodMs, unsigned repeat,
+                 RadarFilterMode mode) {
+  Stats st;
+  radarPipelineInit();
+  radarPipelineSetFilter(mode);
+  hostSetMicros(0);
+
+  for (const Sample& s : scenario) {
+    hostAdvanceMicros(periodMs * 1000ULL);
+    parseRadarFrame(s.frame, RADAR_FRAME_SIZE);
+    RadarTarget t[3];
+    getRadarTargets(t);
+
+    // Nach einem Sprung der Bahn kann kurz ein zweiter (auslaufender) Track
+    // existieren – gewertet wird der Track am nächsten zur Wahrheit
+    const RadarTarget* best = nullptr;
+    float bestSq = 0;
+    for (const RadarTarget& c : t) {
+      if (!c.presence) continue;
+      float dx = c.x - s.truth.x, dy = c.y - s.truth.y;
+      if (!best || dx * dx + dy * dy < bestSq) { best = &c; bestSq = dx * dx + dy * dy; }
+    }
+    if (!best) { st.lost++; continue; }
+    if (s.truth.phaseAge < SETTLE_S) continue;
+
+    float ex = best->x - s.truth.x, ey = best->y - s.truth.y;
+    if (s.truth.moving) {
+      float v = sqrtf(s.truth.vx * s.truth.vx + s.truth.vy * s.truth.vy);
+      st.moveSq += ex * ex + ey * ey;
+      st.lagS   += -(ex * s.truth.vx + ey * s.truth.vy) / (v * v);   // hinter der Bahn = positiv
+      st.moveN++;
+    } else {
+      st.stillSq += ex * ex + ey * ey;
+      st.stillN++;
+    }
+    if (best->sigma) { st.sigma += best->sigma; st.sigmaN++; }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned r = 0; r < repeat; r++) {
+    for (const Sample& s : scenario) {
+      hostAdvanceMicros(periodMs * 1000ULL);
+      parseRadarFrame(s.frame, RADAR_FRAME_SIZE);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  st.nsPerFrame = ns / ((double)scenario.size() * repeat);
+  return st;
+}
+
+static void report(const char* name, const Stats& st) {
+  printf("%-7s %10.1f %10.1f %8.0f %9.1f %8u %10.1f\n", name,
+         st.stillN ? sqrt(st.stillSq / st.stillN) : 0.0,
+         st.moveN ? sqrt(st.moveSq / st.moveN) : 0.0,
+         st.moveN ? st.lagS / st.moveN * 1000.0 : 0.0,
+         st.sigmaN ? st.sigma / st.sigmaN : 0.0,
+         st.lost, st.nsPerFrame);
+}
+
+int main(int argc, char** argv) {
+  unsigned loops = 50, periodMs = 100, dropoutPct = 10, repeat = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    unsigned v = strtoul(argv[i + 1], nullptr, 10);
+    if      (!strcmp(argv[i], "--loops"))     loops = v;
+    else if (!strcmp(argv[i], "--period-ms")) periodMs = v;
+    else if (!strcmp(argv[i], "--dropout"))   dropoutPct = v;
+    else if (!strcmp(argv[i], "--repeat"))    repeat = v;
+    else {
+      fprintf(stderr, "usage: %s [--loops N] [--period-ms MS] [--dropout PCT] [--repeat N]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (!loops) loops = 1;
+  if (!periodMs) periodMs = 1;
+  if (!repeat) repeat = 1;
+
+  std::vector<Sample> scenario = buildScenario(loops, periodMs, dropoutPct);
+  printf("# %zu frames, period %u ms, dropout %u %%, hold %u ms\n",
+         scenario.size(), periodMs, dropoutPct, g_holdIntervalMs);
+  printf("%-7s %10s %10s %8s %9s %8s %10s\n", "filter", "still_mm", "moving_mm", "lag_ms",
+         "sigma_mm", "lost", "ns/frame");
+  report("ema", run(scenario, periodMs, repeat, RADAR_FILTER_EMA));
+  report("kalman", run(scenario, periodMs, repeat, RADAR_FILTER_KALMAN));
+  return 0;
+}
@@ -0,0 +1,903 @@
+const canvas = document.getElementById('radar');
+const ctx = canvas.getContext('2d');
+const statusEl = document.getElementById('status');
+const themeToggle = document.getElementById('themeToggle');
+const invertToggle = document.getElementById('invertToggle');
+const THEME_STORAGE_KEY = 'rp-theme';
+const INVERT_COOKIE_KEY = 'rp-invert-x';
+const prefersDarkQuery = window.matchMedia ? window.matchMedia('(prefers-color-scheme: dark)') : null;
+
+function varFallback(value, fallback) {
+  if (typeof value !== 'string') return fallback;
+  const trimmed = value.trim();
+  return trimmed.length ? trimmed : fallback;
+}
+
+function readCookie(name) {
+  const match = document.cookie.match(new RegExp('(?:^|; )' + name + '=([^;]*)'));
+  return match ? decodeURIComponent(match[1]) : null;
+}
+
+function writeCookie(name, value, days) {
+  const maxAge = (days || 365) * 24 * 60 * 60;
+  document.cookie = name + '=' + encodeURIComponent(value) + '; path=/; max-age=' + maxAge + '; SameSite=Lax';
+}
+
+let configuredRange = 5; // Vom Sensor eingestellte Reichweite
+const MAX_RANGE = 8; // Maximale Radar-Reichweite
+const BASE_CANVAS_WIDTH = 800;
+const BASE_CANVAS_HEIGHT = 600;
+const BASE_PIXELS_PER_METER = 50;
+const BASE_CENTER_X = 400;
+const BASE_CENTER_Y = 30;
+
+let canvasWidth = BASE_CANVAS_WIDTH;
+let canvasHeight = BASE_CANVAS_HEIGHT;
+let pixelsPerMeter = BASE_PIXELS_PER_METER;
+let centerX = BASE_CENTER_X;
+let centerY = BASE_CENTER_Y;
+let uiScale = 1;
+let resizePending = false;
+let fallbackTimer = null;
+let eventSource = null;
+let sseWatchdogTimer = null;
+let lastSseEventAt = 0;
+const SSE_STALE_MS = 8000;
+let invertXAxis = false;
+let lastRadarPayload = null;   // Stand aus init/Polling, per SSE-Events fortgeschrieben
+let lastLogSeq = 0;
+const LOG_LINES_MAX = 10;
+// /ws: Targets binär mit Sensorrate (?rate=<Hz> an der Dashboard-URL drosselt)
+const WS_RATE_HZ = parseInt(new URLSearchParams(location.search).get('rate') || '0', 10) || 0;
+const WS_RETRY_MS = 3000;
+const TRAIL_MS = 2000;
+let radarSocket = null;
+let wsActive = false;         // Targets kommen über /ws, SSE-"targets" werden ignoriert
+let wsRateHz = 0;
+let targetsDrawPending = false;
+const trails = new Map();     // Track-ID → [{x, y, at}]
+const historyCanvas = document.getElementById('historyChart');
+const historyCtx = historyCanvas ? historyCanvas.getContext('2d') : null;
+const HISTORY_REFRESH_MS = { 1: 10000, 60: 60000, 600: 300000 };
+const HISTORY_ZONE_COLORS = ['#0a84ff', '#ff9f0a', '#bf5af2', '#64d2ff', '#ffd60a', '#ff375f', '#30d158', '#ac8e68'];
+let historyRes = 1;
+let historySpan = 3600;
+let historyTimer = null;
+let lastHistory = null;
+
+const resetReasonMap = {
+  1: 'POWERON_RESET',
+  3: 'SW_RESET',
+  4: 'OWDT_RESET',
+  5: 'DEEPSLEEP_RESET',
+  6: 'SDIO_RESET',
+  7: 'TG0WDT_SYS_RESET',
+  8: 'TG1WDT_SYS_RESET',
+  9: 'RTCWDT_SYS_RESET',
+  10: 'INTRUSION_RESET',
+  11: 'TGWDT_CPU_RESET',
+  12: 'SW_CPU_RESET',
+  13: 'RTCWDT_CPU_RESET',
+  14: 'EXT_CPU_RESET',
+  15: 'RTCWDT_BROWN_OUT_RESET',
+  16: 'RTCWDT_RTC_RESET'
+};
+
+function formatResetReason(code) {
+  if (code === undefined || code === null) return '-';
+  if (typeof code === 'string') return code;
+  return resetReasonMap[code] || ('code ' + code);
+}
+
+function escapeHtml(value) {
+  return String(value)
+    .replace(/&/g, '&amp;')
+    .replace(/</g, '&lt;')
+    .replace(/>/g, '&gt;')
+    .replace(/"/g, '&quot;')
+    .replace(/'/g, '&#39;');
+}
+
+function applyTheme(mode) {
+  const isLight = mode === 'light';
+  document.body.classList.toggle('light-mode', isLight);
+  document.body.classList.toggle('dark-mode', !isLight);
+  if (themeToggle) {
+    themeToggle.textContent = isLight ? '🌙 Dark Mode' : '☀️ Light Mode';
+  }
+}
+
+function updateInvertToggleLabel() {
+  if (!invertToggle) return;
+  invertToggle.textContent = invertXAxis ? 'Invertiert' : 'Normal';
+  invertToggle.classList.toggle('active', invertXAxis);
+  invertToggle.setAttribute('aria-pressed', invertXAxis ? 'true' : 'false');
+}
+
+function initTheme() {
+  let storedMode = null;
+  try {
+    storedMode = localStorage.getItem(THEME_STORAGE_KEY);
+  } catch (err) {
+    storedMode = null;
+  }
+
+  let initialMode = storedMode;
+  if (initialMode !== 'light' && initialMode !== 'dark') {
+    const prefersDark = prefersDarkQuery ? prefersDarkQuery.matches : true;
+    initialMode = prefersDark ? 'dark' : 'light';
+  }
+
+  applyTheme(initialMode);
+
+  if (themeToggle) {
+    themeToggle.addEventListener('click', () => {
+      const newMode = document.body.classList.contains('light-mode') ? 'dark' : 'light';
+      applyTheme(newMode);
+      try {
+        localStorage.setItem(THEME_STORAGE_KEY, newMode);
+      } catch (err) {
+        /* ignore storage errors */
+      }
+    });
+  }
+
+  const handleSystemThemeChange = (event) => {
+    let stored = null;
+    try {
+      stored = localStorage.getItem(THEME_STORAGE_KEY);
+    } catch (err) {
+      stored = null;
+    }
+    if (stored === 'light' || stored === 'dark') {
+      return; // user preference overrides system
+    }
+    applyTheme(event.matches ? 'dark' : 'light');
+  };
+
+  if (prefersDarkQuery) {
+    if (prefersDarkQuery.addEventListener) {
+      prefersDarkQuery.addEventListener('change', handleSystemThemeChange);
+    } else if (prefersDarkQuery.addListener) {
+      prefersDarkQuery.addListener(handleSystemThemeChange);
+    }
+  }
+}
+
+function initInvertToggle() {
+  const stored = readCookie(INVERT_COOKIE_KEY);
+  invertXAxis = stored === '1';
+  updateInvertToggleLabel();
+
+  if (invertToggle) {
+    invertToggle.addEventListener('click', () => {
+      invertXAxis = !invertXAxis;
+      updateInvertToggleLabel();
+      writeCookie(INVERT_COOKIE_KEY, invertXAxis ? '1' : '0', 365);
+      if (lastRadarPayload) {
+        updateRadar(lastRadarPayload);
+      } else {
+        drawRadar();
+      }
+    });
+  }
+}
+
+function resizeCanvas() {
+  if (!canvas || !ctx) return false;
+  const rect = canvas.getBoundingClientRect();
+  let width = Math.max(1, Math.round(rect.width));
+  if (width < 10 && canvas.parentElement) {
+    width = Math.max(1, Math.round(canvas.parentElement.clientWidth));
+  }
+  if (width < 10) {
+    requestAnimationFrame(resizeCanvas);
+    return false;
+  }
+  const aspectRatio = BASE_CANVAS_HEIGHT / BASE_CANVAS_WIDTH;
+  const height = Math.round(width * aspectRatio);
+  canvas.style.height = height + 'px';
+
+  const pixelRatio = window.devicePixelRatio || 1;
+  const internalWidth = Math.max(1, Math.round(width * pixelRatio));
+  const internalHeight = Math.max(1, Math.round(height * pixelRatio));
+  if (canvas.width !== internalWidth || canvas.height !== internalHeight) {
+    canvas.width = internalWidth;
+    canvas.height = internalHeight;
+  }
+  ctx.setTransform(pixelRatio, 0, 0, pixelRatio, 0, 0);
+
+  canvasWidth = width;
+  canvasHeight = height;
+  uiScale = canvasWidth / BASE_CANVAS_WIDTH;
+  pixelsPerMeter = BASE_PIXELS_PER_METER * uiScale;
+  centerX = BASE_CENTER_X * uiScale;
+  centerY = BASE_CENTER_Y * uiScale;
+  return true;
+}
+
+function redrawRadar() {
+  if (lastRadarPayload) {
+    updateRadar(lastRadarPayload);
+  } else {
+    drawRadar();
+  }
+}
+
+function scheduleCanvasRefresh() {
+  if (resizePending) return;
+  resizePending = true;
+  const attemptRefresh = () => {
+    if (resizeCanvas()) {
+      resizePending = false;
+      redrawRadar();
+    } else {
+      requestAnimationFrame(attemptRefresh);
+    }
+  };
+  requestAnimationFrame(attemptRefresh);
+}
+
+function formatUptimeLabel(minutes, formatted) {
+  if (formatted && typeof formatted === 'string') {
+    return formatted;
+  }
+  const totalMinutes = Number.isFinite(minutes) ? Math.max(0, Math.floor(minutes)) : 0;
+  const hours = Math.min(999, Math.floor(totalMinutes / 60));
+  const mins = totalMinutes % 60;
+  return hours.toString().padStart(3, '0') + ':' + mins.toString().padStart(2, '0');
+}
+
+function sendCommand(cmd) {
+  fetch('/api/cmd?cmd=' + cmd)
+    .then(res => res.text())
+    .then(data => {
+      alert('Befehl gesendet: ' + cmd + '\nAntwort: ' + data);
+    })
+    .catch(err => {
+      alert('Fehler beim Senden des Befehls: ' + err);
+    });
+}
+
+function fetchData() {
+  fetch('/api/radar')
+    .then(res => res.json())
+    .then(data => {
+      statusEl.className = 'connected';
+      if (wsActive && lastRadarPayload) {
+        // Targets von /ws sind aktueller als der Poll
+        data.targetCount = lastRadarPayload.targetCount;
+        data.targets = lastRadarPayload.targets;
+      }
+      updateRadar(data);
+    })
+    .catch(err => {
+      statusEl.className = 'disconnected';
+      console.error('Fetch error:', err);
+    });
+}
+
+function formatUs(us) {
+  if (typeof us !== 'number') return '-';
+  return us >= 1000 ? (us / 1000).toFixed(1) + ' ms' : us + ' µs';
+}
+
+function updateMetrics(data) {
+  const loop = data.loop || {};
+  const it = loop.iterations;
+  document.getElementById('loopIter').textContent = it
+    ? [it.p50, it.p95, it.p99, it.max].map(formatUs).join(' / ')
+    : '-';
+  const mqtt = data.latency && data.latency.mqtt;
+  document.getElementById('latMqtt').textContent = mqtt && mqtt.n ? formatUs(mqtt.p95) : '-';
+  const ws = data.latency && data.latency.ws;
+  document.getElementById('latWs').textContent = ws && ws.n ? formatUs(ws.p95) : '-';
+
+  const stages = loop.stages || {};
+  document.getElementById('loopStages').innerHTML = Object.keys(stages).map(name => {
+    const s = stages[name];
+    return '<tr><td>' + escapeHtml(name) + '</td><td>' + formatUs(s.min) + '</td><td>' +
+           formatUs(s.avg) + '</td><td>' + formatUs(s.max) + '</td></tr>';
+  }).join('');
+
+  const slowest = Array.isArray(loop.slowest) ? loop.slowest : [];
+  document.getElementById('loopSlowest').innerHTML = slowest.length
+    ? slowest.map(s => '<div class="log-item">' + formatUs(s.us) + ' – ' + escapeHtml(s.stage) +
+        ' (' + formatUs(s.stageUs) + ') bei ' + formatUptimeLabel(s.atMs / 60000) + '</div>').join('')
+    : '<div style="color: var(--muted-text); font-size: 12px;">Noch keine Daten</div>';
+}
+
+function fetchMetrics() {
+  fetch('/api/metrics')
+    .then(res => res.json())
+    .then(updateMetrics)
+    .catch(err => console.error('Metrics fetch error:', err));
+}
+
+// /api/history (RadarHistory.h): Header 20 B, je Sample occ | targets | zones
+function decodeHistory(buffer, zonesHeader) {
+  const view = new DataView(buffer);
+  if (view.byteLength < 20) return null;
+  const magic = String.fromCharCode(view.getUint8(0), view.getUint8(1), view.getUint8(2), view.getUint8(3));
+  if (magic !== 'RHST' || view.getUint8(4) !== 1) return null;
+  const sampleSize = view.getUint8(5);
+  const count = view.getUint32(12, true);
+  if (sampleSize < 3 || view.byteLength < 20 + count * sampleSize) return null;
+  return {
+    res: view.getUint16(6, true),
+    firstSec: view.getUint32(8, true),
+    count: count,
+    nowSec: view.getUint32(16, true),
+    sampleSize: sampleSize,
+    samples: new Uint8Array(buffer, 20, count * sampleSize),
+    zones: (zonesHeader || '').split(','),
+    receivedAt: Date.now()
+  };
+}
+
+function formatClock(ms) {
+  const d = new Date(ms);
+  return d.getHours().toString().padStart(2, '0') + ':' + d.getMinutes().toString().padStart(2, '0');
+}
+
+function drawHistory() {
+  if (!historyCtx || !lastHistory) return;
+  const h = lastHistory;
+  const width = Math.max(1, Math.round(historyCanvas.getBoundingClientRect().width));
+  const height = 160;
+  const pixelRatio = window.devicePixelRatio || 1;
+  if (historyCanvas.width !== Math.round(width * pixelRatio) || historyCanvas.height !== Math.round(height * pixelRatio)) {
+    historyCanvas.width = Math.round(width * pixelRatio);
+    historyCanvas.height = Math.round(height * pixelRatio);
+  }
+  historyCtx.setTransform(pixelRatio, 0, 0, pixelRatio, 0, 0);
+
+  const styles = getComputedStyle(document.body);
+  const labelColor = varFallback(styles.getPropertyValue('--canvas-label-color'), '#6a7a8a');
+  const gridColor = varFallback(styles.getPropertyValue('--canvas-grid-color'), '#2a3a4a');
+  historyCtx.clearRect(0, 0, width, height);
+
+  const definedZones = [];
+  h.zones.forEach((name, bit) => { if (name) definedZones.push({ name: name, bit: bit }); });
+  const axisH = 16;
+  const zoneRowH = 8;
+  const plotH = height - axisH - definedZones.length * (zoneRowH + 2) - 4;
+  const startSec = h.nowSec - historySpan;
+  const xOf = (sec) => (sec - startSec) / historySpan * width;
+  const sampleW = Math.max(1, h.res / historySpan * width);
+
+  historyCtx.strokeStyle = gridColor;
+  historyCtx.lineWidth = 1;
+  for (let k = 1; k <= 3; k++) {
+    const y = plotH - k / 3 * plotH + 0.5;
+    historyCtx.beginPath();
+    historyCtx.moveTo(0, y);
+    historyCtx.lineTo(width, y);
+    historyCtx.stroke();
+  }
+
+  let lastOccupiedSec = -1;
+  for (let i = 0; i < h.count; i++) {
+    const occ = h.samples[i * h.sampleSize];
+    const targets = h.samples[i * h.sampleSize + 1];
+    const zones = h.samples[i * h.sampleSize + 2];
+    const sec = h.firstSec + i * h.res;
+    const x = xOf(sec);
+    if (x + sampleW < 0) continue;
+    if (targets === 0xFF) {
+      // keine Radar-Frames
+      historyCtx.fillStyle = 'rgba(128, 128, 128, 0.25)';
+      historyCtx.fillRect(x, 0, sampleW, plotH);
+      continue;
+    }
+    if (occ) lastOccupiedSec = sec + h.res;
+    historyCtx.fillStyle = 'rgba(52, 199, 89, 0.55)';
+    historyCtx.fillRect(x, plotH - occ / 255 * plotH, sampleW, occ / 255 * plotH);
+    if (targets) {
+      historyCtx.fillStyle = '#ff6464';
+      historyCtx.fillRect(x, plotH - targets / 3 * plotH - 1, sampleW, 2);
+    }
+    definedZones.forEach((z, row) => {
+      if (!(zones & (1 << z.bit))) return;
+      historyCtx.fillStyle = HISTORY_ZONE_COLORS[z.bit % HISTORY_ZONE_COLORS.length];
+      historyCtx.fillRect(x, plotH + 4 + row * (zoneRowH + 2), sampleW, zoneRowH);
+    });
+  }
+
+  // Zeitachse in lokaler Uhrzeit (Uptime → jetzt minus Abstand)
+  historyCtx.fillStyle = labelColor;
+  historyCtx.font = '11px monospace';
+  for (let k = 0; k <= 4; k++) {
+    const sec = startSec + k / 4 * historySpan;
+    historyCtx.textAlign = k === 0 ? 'left' : (k === 4 ? 'right' : 'center');
+    historyCtx.fillText(formatClock(h.receivedAt - (h.nowSec - sec) * 1000), k / 4 * width, height - 3);
+  }
+
+  document.getElementById('historyInfo').textContent = lastOccupiedSec < 0
+    ? 'im Zeitraum nicht belegt'
+    : 'zuletzt belegt: ' + formatClock(h.receivedAt - (h.nowSec - Math.min(lastOccupiedSec, h.nowSec)) * 1000);
+  document.getElementById('historyLegend').innerHTML =
+    '<span style="color:#34c759">■ Belegung</span><span style="color:#ff6464">▬ max. Targets</span>' +
+    definedZones.map(z => '<span style="color:' + HISTORY_ZONE_COLORS[z.bit % HISTORY_ZONE_COLORS.length] + '">■ ' +
+      escapeHtml(z.name) + '</span>').join('');
+}
+
+function fetchHistory() {
+  fetch('/api/history?res=' + historyRes + '&from=-' + historySpan)
+    .then(res => {
+      const zones = res.headers.get('X-Zones');
+      return res.arrayBuffer().then(buf => decodeHistory(buf, zones));
+    })
+    .then(h => {
+      if (!h) return;
+      lastHistory = h;
+      drawHistory();
+    })
+    .catch(err => console.error('History fetch error:', err));
+}
+
+function initHistory() {
+  if (!historyCtx) return;
+  const buttons = document.querySelectorAll('.history-controls button');
+  buttons.forEach(btn => {
+    btn.addEventListener('click', () => {
+      buttons.forEach(b => b.classList.toggle('active', b === btn));
+      historyRes = parseInt(btn.dataset.res, 10);
+      historySpan = parseInt(btn.dataset.span, 10);
+      if (historyTimer) clearInterval(historyTimer);
+      historyTimer = setInterval(fetchHistory, HISTORY_REFRESH_MS[historyRes]);
+      fetchHistory();
+    });
+  });
+  fetchHistory();
+  historyTimer = setInterval(fetchHistory, HISTORY_REFRESH_MS[historyRes]);
+}
+
+function startPollingFallback() {
+  if (fallbackTimer) return;
+  if (sseWatchdogTimer) {
+    clearInterval(sseWatchdogTimer);
+    sseWatchdogTimer = null;
+  }
+  fetchData();
+  fallbackTimer = setInterval(fetchData, 1000);
+  updateLiveStreamLabel();
+}
+
+function startSseWatchdog() {
+  if (sseWatchdogTimer) {
+    clearInterval(sseWatchdogTimer);
+  }
+  sseWatchdogTimer = setInterval(() => {
+    if (!eventSource) return;
+    if (Date.now() - lastSseEventAt > SSE_STALE_MS) {
+      console.warn('SSE stale, reconnecting');
+      eventSource.close();
+      eventSource = null;
+      setTimeout(setupRealtime, 500);
+    }
+  }, 2000);
+}
+
+function updateLiveStreamLabel() {
+  const el = document.getElementById('liveStream');
+  if (!el) return;
+  if (wsActive) el.textContent = 'WebSocket ' + (wsRateHz ? wsRateHz + ' Hz' : '(Sensorrate)');
+  else if (eventSource) el.textContent = 'SSE';
+  else if (fallbackTimer) el.textContent = 'Polling';
+  else el.textContent = '-';
+}
+
+// RadarBinary v1 (RadarBinary.h): Header 10 B, je Target 12 B, little endian.
+// Abgeleitete Felder wie host/radar_bin.py.
+function decodeRadarBinary(buffer) {
+  const view = new DataView(buffer);
+  if (view.byteLength < 10 || view.getUint8(0) !== 1) return null;
+  const count = view.getUint8(1);
+  if (count > 3 || view.byteLength !== 10 + count * 12) return null;
+  const targets = [];
+  for (let i = 0, p = 10; i < count; i++, p += 12) {
+    const x = view.getInt16(p + 2, true);
+    const y = view.getInt16(p + 4, true);
+    const sigma = view.getUint16(p + 10, true);
+    const t = {
+      id: view.getUint16(p, true),
+      x: x,
+      y: y,
+      speed: Math.round(view.getInt16(p + 6, true) / 10),   // cm/s wie im JSON
+      distRaw: view.getUint16(p + 8, true),
+      distance: Math.round(Math.hypot(x, y)),
+      angleDeg: Math.round(Math.atan2(y, x) * 180 / Math.PI)
+    };
+    if (sigma) t.sigma = sigma;
+    targets.push(t);
+  }
+  return { frame: view.getUint32(2, true), timeMs: view.getUint32(6, true), targetCount: count, targets: targets };
+}
+
+function recordTrails(targets) {
+  const now = Date.now();
+  (targets || []).forEach(t => {
+    let points = trails.get(t.id);
+    if (!points) {
+      points = [];
+      trails.set(t.id, points);
+    }
+    points.push({ x: t.x, y: t.y, at: now });
+  });
+  trails.forEach((points, id) => {
+    while (points.length && now - points[0].at > TRAIL_MS) points.shift();
+    if (!points.length) trails.delete(id);
+  });
+}
+
+function drawTrails() {
+  const now = Date.now();
+  ctx.lineWidth = Math.max(1, 2 * uiScale);
+  trails.forEach(points => {
+    for (let i = 1; i < points.length; i++) {
+      const a = points[i - 1];
+      const b = points[i];
+      const alpha = Math.max(0, 1 - (now - b.at) / TRAIL_MS) * 0.6;
+      ctx.strokeStyle = 'rgba(255, 100, 100, ' + alpha.toFixed(2) + ')';
+      ctx.beginPath();
+      ctx.moveTo(centerX + (invertXAxis ? -a.x : a.x) / 1000.0 * pixelsPerMeter, centerY + a.y / 1000.0 * pixelsPerMeter);
+      ctx.lineTo(centerX + (invertXAxis ? -b.x : b.x) / 1000.0 * pixelsPerMeter, centerY + b.y / 1000.0 * pixelsPerMeter);
+      ctx.stroke();
+    }
+  });
+}
+
+// Neue Targets aus SSE oder /ws: höchstens einmal pro Bildschirm-Frame zeichnen
+function applyTargets(targetCount, targets) {
+  if (!lastRadarPayload) return;
+  lastRadarPayload.targetCount = targetCount;
+  lastRadarPayload.targets = targets;
+  recordTrails(targets);
+  if (targetsDrawPending) return;
+  targetsDrawPending = true;
+  requestAnimationFrame(() => {
+    targetsDrawPending = false;
+    updateTargets(lastRadarPayload);
+  });
+}
+
+function setupWebSocket() {
+  if (!window.WebSocket || radarSocket) return;
+  const url = (location.protocol === 'https:' ? 'wss://' : 'ws://') + location.host + '/ws' +
+              (WS_RATE_HZ ? '?rate=' + WS_RATE_HZ : '');
+  radarSocket = new WebSocket(url);
+  radarSocket.binaryType = 'arraybuffer';
+  radarSocket.onmessage = (event) => {
+    if (typeof event.data === 'string') {
+      // {"v":1,"rate":n}: Bestätigung nach Verbinden bzw. "rate:<Hz>"
+      try {
+        const hello = JSON.parse(event.data);
+        wsRateHz = hello.rate || 0;
+        wsActive = hello.v === 1;
+      } catch (e) {
+        console.error('WS parse error', e);
+      }
+      updateLiveStreamLabel();
+      return;
+    }
+    if (!wsActive) return;
+    const snap = decodeRadarBinary(event.data);
+    if (snap) applyTargets(snap.targetCount, snap.targets);
+  };
+  radarSocket.onclose = () => {
+    radarSocket = null;
+    wsActive = false;
+    updateLiveStreamLabel();
+    setTimeout(setupWebSocket, WS_RETRY_MS);
+  };
+  radarSocket.onerror = () => {
+    if (radarSocket) radarSocket.close();
+  };
+}
+
+function parseSseEvent(event) {
+  statusEl.className = 'connected';
+  lastSseEventAt = Date.now();
+  try {
+    return JSON.parse(event.data);
+  } catch (e) {
+    console.error('SSE parse error', event.type, e);
+    return null;
+  }
+}
+
+function setupRealtime() {
+  if (fallbackTimer) {
+    clearInterval(fallbackTimer);
+    fallbackTimer = null;
+  }
+  if (!window.EventSource) {
+    startPollingFallback();
+    return;
+  }
+
+  if (eventSource) {
+    eventSource.close();
+  }
+  lastSseEventAt = Date.now();
+  startSseWatchdog();
+  eventSource = new EventSource('/events');
+  eventSource.onopen = () => {
+    statusEl.className = 'connected';
+    lastSseEventAt = Date.now();
+    updateLiveStreamLabel();
+  };
+  eventSource.addEventListener('init', (event) => {
+    const payload = parseSseEvent(event);
+    if (!payload) return;
+    lastLogSeq = payload.logSeq || 0;
+    updateRadar(payload);
+  });
+  eventSource.addEventListener('targets', (event) => {
+    const patch = parseSseEvent(event);
+    if (!patch || wsActive) return;
+    applyTargets(patch.targetCount, patch.targets);
+  });
+  eventSource.addEventListener('status', (event) => {
+    const patch = parseSseEvent(event);
+    if (!patch || !lastRadarPayload) return;
+    const rangeChanged = patch.range_m !== lastRadarPayload.range_m;
+    Object.assign(lastRadarPayload, patch);
+    updateStatus(lastRadarPayload);
+    if (rangeChanged) updateTargets(lastRadarPayload);
+  });
+  eventSource.addEventListener('log', (event) => {
+    const patch = parseSseEvent(event);
+    if (!patch || !lastRadarPayload || patch.seq <= lastLogSeq) return;
+    lastLogSeq = patch.seq;
+    lastRadarPayload.serialLogs = (lastRadarPayload.serialLogs || []).concat(patch.lines || []).slice(-LOG_LINES_MAX);
+    updateLogs(lastRadarPayload.serialLogs);
+  });
+  eventSource.addEventListener('ping', (event) => {
+    parseSseEvent(event);
+  });
+  eventSource.onerror = (err) => {
+    console.warn('SSE error, fallback to polling', err);
+    statusEl.className = 'disconnected';
+    if (eventSource) {
+      eventSource.close();
+      eventSource = null;
+    }
+    startPollingFallback();
+  };
+}
+
+function drawRadar() {
+  const styles = getComputedStyle(document.body);
+  const gridColor = varFallback(styles.getPropertyValue('--canvas-grid-color'), '#2a3a4a');
+  const arcColor = varFallback(styles.getPropertyValue('--canvas-arc-color'), '#3a4a5a');
+  const labelColor = varFallback(styles.getPropertyValue('--canvas-label-color'), '#6a7a8a');
+
+  ctx.fillStyle = varFallback(styles.getPropertyValue('--canvas-fill'), '#1a1a2a');
+  ctx.clearRect(0, 0, canvasWidth, canvasHeight);
+  ctx.fillRect(0, 0, canvasWidth, canvasHeight);
+
+  const maxRadius = MAX_RANGE * pixelsPerMeter;
+  const configuredRadius = configuredRange * pixelsPerMeter;
+  const thinLineWidth = Math.max(1, uiScale);
+  const highlightLineWidth = Math.max(1.5, 3 * uiScale);
+  const labelFontSize = Math.max(10, Math.min(18, 12 * uiScale));
+  const labelOffset = 25 * uiScale;
+
+  // Radial lines (nach Süden: Halbkreis nach unten, -90° bis +90°)
+  ctx.strokeStyle = gridColor;
+  ctx.lineWidth = thinLineWidth;
+  for(let angle = -90; angle <= 90; angle += 15) {
+    const rad = (angle + 90) * Math.PI / 180;
+    const x = centerX + Math.cos(rad) * maxRadius;
+    const y = centerY + Math.sin(rad) * maxRadius;
+    ctx.beginPath();
+    ctx.moveTo(centerX, centerY);
+    ctx.lineTo(x, y);
+    ctx.stroke();
+  }
+
+  // Concentric arcs für alle 15 Meter
+  ctx.strokeStyle = arcColor;
+  ctx.lineWidth = thinLineWidth;
+  for(let m = 1; m <= MAX_RANGE; m++) {
+    const r = m * pixelsPerMeter;
+    ctx.beginPath();
+    ctx.arc(centerX, centerY, r, 0, Math.PI, false);
+    ctx.stroke();
+  }
+
+  // Range labels für alle Meter
+  ctx.fillStyle = labelColor;
+  ctx.font = labelFontSize.toFixed(1) + 'px monospace';
+  ctx.textAlign = 'center';
+  for(let m = 1; m <= MAX_RANGE; m++) {
+    const y = centerY + m * pixelsPerMeter;
+    ctx.fillText(m + 'm', centerX + labelOffset, y + labelFontSize * 0.3);
+  }
+
+  // Gesamte Detection area (15m) - dezent
+  const gradientMax = ctx.createRadialGradient(centerX, centerY, 0, centerX, centerY, maxRadius);
+  gradientMax.addColorStop(0, 'rgba(70, 130, 180, 0.05)');
+  gradientMax.addColorStop(1, 'rgba(70, 130, 180, 0.02)');
+  ctx.fillStyle = gradientMax;
+  ctx.beginPath();
+  ctx.arc(centerX, centerY, maxRadius, 0, Math.PI, false);
+  ctx.lineTo(centerX, centerY);
+  ctx.closePath();
+  ctx.fill();
+
+  // Konfigurierte Reichweite - FARBIG hervorgehoben
+  const gradientConfigured = ctx.createRadialGradient(centerX, centerY, 0, centerX, centerY, configuredRadius);
+  gradientConfigured.addColorStop(0, 'rgba(52, 199, 89, 0.25)');
+  gradientConfigured.addColorStop(1, 'rgba(52, 199, 89, 0.1)');
+  ctx.fillStyle = gradientConfigured;
+  ctx.beginPath();
+  ctx.arc(centerX, centerY, configuredRadius, 0, Math.PI, false);
+  ctx.lineTo(centerX, centerY);
+  ctx.closePath();
+  ctx.fill();
+
+  // Markierung der konfigurierten Reichweite mit farbigem Bogen
+  ctx.strokeStyle = '#34c759';
+  ctx.lineWidth = highlightLineWidth;
+  ctx.beginPath();
+  ctx.arc(centerX, centerY, configuredRadius, 0, Math.PI, false);
+  ctx.stroke();
+
+  // Sensor position (oben/Norden)
+  const sensorRadius = Math.max(4, 8 * uiScale);
+  ctx.fillStyle = '#ff4444';
+  ctx.beginPath();
+  ctx.arc(centerX, centerY, sensorRadius, 0, Math.PI * 2);
+  ctx.fill();
+  ctx.strokeStyle = '#fff';
+  ctx.lineWidth = Math.max(1, 2 * uiScale);
+  ctx.stroke();
+}
+
+function updateRadar(data) {
+  updateStatus(data);
+  updateLogs(data.serialLogs);
+  updateTargets(data);
+}
+
+function updateStatus(data) {
+  if (typeof data.range_m === 'number') {
+    configuredRange = data.range_m;
+  }
+
+  // ESP Info aktualisieren
+  document.getElementById('fwVersion').textContent = data.fwVersion || '-';
+  document.getElementById('resetReason').textContent = formatResetReason(data.resetReason);
+  const temp = data.temp_c;
+  document.getElementById('temperature').textContent = (typeof temp === 'number' ? temp.toFixed(1) + ' °C' : '-');
+  document.getElementById('radarSerialRestarts').textContent = (data.radarSerialRestarts !== undefined ? data.radarSerialRestarts : 0);
+  document.getElementById('ip').textContent = data.ip || '-';
+  document.getElementById('bssid').textContent = data.bssid || '-';
+  document.getElementById('apName').textContent = data.apName || '-';
+  document.getElementById('maxRange').textContent = (configuredRange || 0).toFixed(1) + 'm';
+  document.getElementById('uptime').textContent = formatUptimeLabel(data.uptime_min, data.uptime);
+  document.getElementById('rssi').textContent = (data.rssi || 0) + ' dBm';
+  document.getElementById('heap').textContent = Math.round((data.heap_free || 0) / 1024) + ' KB';
+  document.getElementById('holdMs').textContent = (data.holdMs || 500) + 'ms';
+  const link = data.mqttLink || '-';
+  document.getElementById('mqttLink').textContent = (link === 'connecting' && data.mqttBackoffMs)
+    ? link + ' (retry ' + (data.mqttBackoffMs / 1000).toFixed(1) + ' s)'
+    : link;
+
+  configuredRange = data.range_m || 5;
+
+  // Warnungen anzeigen
+  const warningList = document.getElementById('warningList');
+  if(data.warnings && data.warnings.length > 0) {
+    warningList.innerHTML = data.warnings.map(w => '<div class="warning-item">⚠️ ' + w + '</div>').join('');
+  } else {
+    warningList.innerHTML = '<div style="color: var(--muted-text); font-size: 13px;">Keine Warnungen</div>';
+  }
+}
+
+function updateLogs(lines) {
+  const logList = document.getElementById('logList');
+  if (lines && lines.length > 0) {
+    logList.innerHTML = lines.map(l => '<div class="log-item">' + escapeHtml(l) + '</div>').join('');
+  } else {
+    logList.innerHTML = '<div style="color: var(--muted-text); font-size: 12px;">Keine Logs</div>';
+  }
+}
+
+function updateTargets(data) {
+  lastRadarPayload = data;
+  drawRadar();
+  drawTrails();
+  document.getElementById('targetCount').textContent = data.targetCount || 0;
+
+  // Targets zeichnen und Boxen aktualisieren
+  // Boxen zeigen die Tracks in Slot-Reihenfolge, beschriftet mit ihrer persistenten ID
+  const targets = Array.isArray(data.targets) ? data.targets : [];
+  for(let i = 1; i <= 3; i++) {
+    const t = targets[i - 1];
+    const targetData = document.getElementById('target' + i + '-data');
+    const targetTitle = document.getElementById('target' + i + '-title');
+    targetTitle.textContent = t ? 'Target #' + t.id : 'Target ' + i;
+
+    if(!t) {
+      targetData.innerHTML = '<div style="color: var(--muted-text); text-align: center; padding: 20px;">No target detected</div>';
+      continue;
+    }
+
+    const rawX = typeof t.x === 'number' ? t.x : 0;
+    const rawY = typeof t.y === 'number' ? t.y : 0;
+    const rawAngle = typeof t.angleDeg === 'number' ? t.angleDeg : 0;
+    const xMeters = (invertXAxis ? -rawX : rawX) / 1000.0;
+    const yMeters = rawY / 1000.0;
+    const displayAngle = invertXAxis ? -rawAngle : rawAngle;
+    const displayDistance = typeof t.distance === 'number' ? t.distance / 1000.0 : (typeof t.distRaw === 'number' ? t.distRaw / 1000.0 : 0);
+    const displaySpeed = typeof t.speed === 'number' ? t.speed : 0;
+
+    // Target Box aktualisieren
+    targetData.innerHTML = `
+      <div><strong>Distance:</strong> ${displayDistance.toFixed(2)}m</div>
+      <div><strong>Angle:</strong> ${displayAngle.toFixed(0)}°</div>
+      <div><strong>X:</strong> ${xMeters.toFixed(2)}m</div>
+      <div><strong>Y:</strong> ${yMeters.toFixed(2)}m</div>
+      <div><strong>Speed:</strong> ${displaySpeed}</div>
+      ${typeof t.sigma === 'number' ? `<div><strong>σ:</strong> ${(t.sigma / 1000.0).toFixed(2)}m</div>` : ''}
+    `;
+
+    // 180° gedreht: Y jetzt nach unten positiv
+    const screenX = centerX + xMeters * pixelsPerMeter;
+    const screenY = centerY + yMeters * pixelsPerMeter;
+
+    // Target glow
+    const glowRadius = Math.max(10, 15 * uiScale);
+    const coreRadius = Math.max(3, 5 * uiScale);
+    const labelFontSize = Math.max(11, Math.min(22, 12 * uiScale));
+    const labelOffsetY = 20 * uiScale;
+    const outlineWidth = Math.max(2, 3 * uiScale);
+    const gradient = ctx.createRadialGradient(screenX, screenY, 0, screenX, screenY, glowRadius);
+    gradient.addColorStop(0, 'rgba(255, 100, 100, 0.8)');
+    gradient.addColorStop(1, 'rgba(255, 100, 100, 0)');
+    ctx.fillStyle = gradient;
+    ctx.beginPath();
+    ctx.arc(screenX, screenY, glowRadius, 0, Math.PI * 2);
+    ctx.fill();
+
+    // Target core
+    ctx.fillStyle = '#ff6464';
+    ctx.beginPath();
+    ctx.arc(screenX, screenY, coreRadius, 0, Math.PI * 2);
+    ctx.fill();
+
+    // Label
+    ctx.fillStyle = '#fff';
+    ctx.font = 'bold ' + labelFontSize.toFixed(1) + 'px monospace';
+    ctx.textAlign = 'center';
+    ctx.strokeStyle = '#000';
+    ctx.lineWidth = outlineWidth;
+    ctx.strokeText('T' + t.id, screenX, screenY - labelOffsetY);
+    ctx.fillText('T' + t.id, screenX, screenY - labelOffsetY);
+  }
+}
+
+initTheme();
+initInvertToggle();
+const initialCanvasReady = resizeCanvas();
+if (initialCanvasReady) {
+  redrawRadar();
+}
+setupRealtime();
+setupWebSocket();
+initHistory();
+fetchMetrics();
+setInterval(fetchMetrics, 5000);
+
+if (!initialCanvasReady) {
+  scheduleCanvasRefresh();
+}
+
+window.addEventListener('resize', () => {
+  scheduleCanvasRefresh();
+  drawHistory();
+});